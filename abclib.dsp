@@ -2971,6 +2971,10 @@ SOURCE=.\src\opt\sfm\sfmNtk.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\sfm\sfmPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\sfm\sfmSat.c
 # End Source File
 # Begin Source File
@@ -3879,6 +3883,14 @@ SOURCE=.\src\misc\util\utilMem.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilMmap.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilMmap.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilNam.c
 # End Source File
 # Begin Source File
@@ -3887,6 +3899,14 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilPool.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilPool.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSignal.c
 # End Source File
 # Begin Source File
@@ -3895,12 +3915,24 @@ SOURCE=.\src\misc\util\utilSignal.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
 
 SOURCE=.\src\misc\util\utilTruth.h
 # End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilTsim.h
+# End Source File
 # End Group
 # Begin Group "nm"
 
@@ -4831,6 +4863,10 @@ SOURCE=.\src\aig\gia\giaPat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaPool.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaPf.c
 # End Source File
 # Begin Source File
@@ -5603,6 +5639,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
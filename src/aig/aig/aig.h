@@ -111,6 +111,7 @@ struct Aig_Man_t_
     // AIG node counters
     int              nObjs[AIG_OBJ_VOID];// the number of objects by type
     int              nDeleted;       // the number of deleted objects
+    int              nChanges;       // the number of fanin and phase updates
     // structural hash table
     Aig_Obj_t **     pTable;         // structural hash table
     int              nTableSize;     // structural hash table size
@@ -661,6 +662,7 @@ extern void            Aig_ManDumpBlif( Aig_Man_t * p, char * pFileName, Vec_Ptr
 extern void            Aig_ManDumpVerilog( Aig_Man_t * p, char * pFileName );
 extern void            Aig_ManSetCioIds( Aig_Man_t * p );
 extern void            Aig_ManCleanCioIds( Aig_Man_t * p );
+extern Vec_Int_t *     Aig_ManCompactNodes( Aig_Man_t * p, int fUsePhase );
 extern int             Aig_ManChoiceNum( Aig_Man_t * p );
 extern char *          Aig_FileNameGenericAppend( char * pBase, char * pSuffix );
 extern unsigned        Aig_ManRandom( int fReset );
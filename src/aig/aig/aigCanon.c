@@ -79,7 +79,7 @@ struct Aig_RMan_t_
     int           nUniqueVars;
 };
 
-static Aig_RMan_t * s_pRMan = NULL;
+static ABC_THREAD_LOCAL Aig_RMan_t * s_pRMan = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -98,7 +98,7 @@ static Aig_RMan_t * s_pRMan = NULL;
 ***********************************************************************/
 Aig_RMan_t * Aig_RManStart()
 {
-    static Bdc_Par_t Pars = {0}, * pPars = &Pars;
+    static ABC_THREAD_LOCAL Bdc_Par_t Pars = {0}; Bdc_Par_t * pPars = &Pars;
     Aig_RMan_t * p;
     p = ABC_ALLOC( Aig_RMan_t, 1 );
     memset( p, 0, sizeof(Aig_RMan_t) );
@@ -127,6 +127,7 @@ void Aig_ObjConnect( Aig_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pFan0, Aig_Obj
 {
     assert( !Aig_IsComplement(pObj) );
     assert( !Aig_ObjIsCi(pObj) );
+    p->nChanges++;
     // add the first fanin
     pObj->pFanin0 = pFan0;
     pObj->pFanin1 = pFan1;
@@ -171,6 +172,7 @@ void Aig_ObjConnect( Aig_Man_t * p, Aig_Obj_t * pObj, Aig_Obj_t * pFan0, Aig_Obj
 void Aig_ObjDisconnect( Aig_Man_t * p, Aig_Obj_t * pObj )
 {
     assert( !Aig_IsComplement(pObj) );
+    p->nChanges++;
     // remove connections
     if ( pObj->pFanin0 != NULL )
     {
@@ -61,7 +61,7 @@ void Aig_ManIncrementTravId( Aig_Man_t * p )
 ***********************************************************************/
 char * Aig_TimeStamp()
 {
-    static char Buffer[100];
+    static ABC_THREAD_LOCAL char Buffer[100];
 	char * TimeStamp;
 	time_t ltime;
     // get the current time
@@ -724,7 +724,7 @@ void Aig_ManPrintVerbose( Aig_Man_t * p, int fHaig )
 ***********************************************************************/
 void Aig_ManDump( Aig_Man_t * p )
 { 
-    static int Counter = 0;
+    static ABC_THREAD_LOCAL int Counter = 0;
     char FileName[20];
     // dump the logic into a file
     sprintf( FileName, "aigbug\\%03d.blif", ++Counter );
@@ -1006,6 +1006,47 @@ void Aig_ManCleanCioIds( Aig_Man_t * p )
         pObj->pNext = NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes in the compact index-based form.]
+
+  Description [Returns the array with three entries for each internal node,
+  listed in the topological order: the node ID and the fanin literals 
+  (2 * FaninId + fCompl). Traversing this array does not access the nodes 
+  and their fanins, which are scattered in memory. If fUsePhase is set, 
+  the complemented attributes are XORed with the phases of the fanins, 
+  and the node entry is 2 * Id + fPhase, as needed by the simulators 
+  working with the phase-normalized simulation info.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Aig_ManCompactNodes( Aig_Man_t * p, int fUsePhase )
+{
+    Vec_Int_t * vNodes;
+    Aig_Obj_t * pObj;
+    int i;
+    vNodes = Vec_IntAlloc( 3 * Aig_ManNodeNum(p) );
+    Aig_ManForEachNode( p, pObj, i )
+    {
+        if ( fUsePhase )
+        {
+            Vec_IntPush( vNodes, Abc_Var2Lit(pObj->Id, pObj->fPhase) );
+            Vec_IntPush( vNodes, Abc_Var2Lit(Aig_ObjFaninId0(pObj), Aig_ObjPhaseReal(Aig_ObjChild0(pObj))) );
+            Vec_IntPush( vNodes, Abc_Var2Lit(Aig_ObjFaninId1(pObj), Aig_ObjPhaseReal(Aig_ObjChild1(pObj))) );
+        }
+        else
+        {
+            Vec_IntPush( vNodes, pObj->Id );
+            Vec_IntPush( vNodes, Abc_Var2Lit(Aig_ObjFaninId0(pObj), Aig_ObjFaninC0(pObj)) );
+            Vec_IntPush( vNodes, Abc_Var2Lit(Aig_ObjFaninId1(pObj), Aig_ObjFaninC1(pObj)) );
+        }
+    }
+    return vNodes;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Sets the PI/PO numbers.]
@@ -1082,7 +1123,7 @@ void Aig_ManPrintControlFanouts( Aig_Man_t * p )
 ***********************************************************************/
 char * Aig_FileNameGenericAppend( char * pBase, char * pSuffix )
 {
-    static char Buffer[1000];
+    static ABC_THREAD_LOCAL char Buffer[1000];
     char * pDot;
     strcpy( Buffer, pBase );
     if ( (pDot = strrchr( Buffer, '.' )) )
@@ -1169,8 +1210,8 @@ void Aig_ManRandomTest1()
 ***********************************************************************/
 unsigned Aig_ManRandom( int fReset )
 {
-    static unsigned int m_z = NUMBER1;
-    static unsigned int m_w = NUMBER2;
+    static ABC_THREAD_LOCAL unsigned int m_z = NUMBER1;
+    static ABC_THREAD_LOCAL unsigned int m_w = NUMBER2;
     if ( fReset )
     {
         m_z = NUMBER1;
@@ -1445,6 +1486,7 @@ void Aig_ManSetPhase( Aig_Man_t * pAig )
 {
     Aig_Obj_t * pObj;
     int i;
+    pAig->nChanges++;
     // set the PI simulation information
     Aig_ManConst1( pAig )->fPhase = 1;
     Aig_ManForEachCi( pAig, pObj, i )
@@ -34,6 +34,7 @@
 #include "misc/vec/vec.h"
 #include "misc/vec/vecWec.h"
 #include "misc/util/utilCex.h"
+#include "misc/util/utilMmap.h"
 
 ////////////////////////////////////////////////////////////////////////
 ///                         PARAMETERS                               ///
@@ -44,6 +45,9 @@ ABC_NAMESPACE_HEADER_START
 
 #define GIA_NONE 0x1FFFFFFF
 #define GIA_VOID 0x0FFFFFFF
+
+#define GIA_STORE_MIN  (1 << 20)  // the smallest AIG whose objects may be kept in a file
+#define GIA_STORE_PAGE (1 << 20)  // the number of objects added to the file at a time
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -91,6 +95,9 @@ struct Gia_Obj_t_
 // - pointer to the next node in the hash table during structural hashing
 // - pointer to the node copy during duplication 
 
+// shared pool of CI patterns
+typedef struct Gia_Pool_t_ Gia_Pool_t;
+
 // new AIG manager
 typedef struct Gia_Man_t_ Gia_Man_t;
 struct Gia_Man_t_
@@ -102,14 +109,15 @@ struct Gia_Man_t_
     int            nObjs;         // number of objects
     int            nObjsAlloc;    // number of allocated objects
     Gia_Obj_t *    pObjs;         // the array of objects
+    Util_Mmap_t *  pObjStore;     // file-backed storage of the objects (or NULL)
     unsigned *     pMuxes;        // control signals of MUXes
     int            nXors;         // the number of XORs
     int            nMuxes;        // the number of MUXes 
     int            nBufs;         // the number of buffers
     Vec_Int_t *    vCis;          // the vector of CIs (PIs + LOs)
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
-    int *          pHTable;       // hash table
-    int            nHTable;       // hash table size 
+    int *          pHTable;       // hash table (node and fanin literals of each entry)
+    int            nHTable;       // hash table size (the number of entries)
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -147,6 +155,7 @@ struct Gia_Man_t_
     Abc_Cex_t *    pCexComb;      // combinational counter-example
     Abc_Cex_t *    pCexSeq;       // sequential counter-example
     Vec_Ptr_t *    vSeqModelVec;  // sequential counter-examples
+    Gia_Pool_t *   pPool;         // distinguishing CI patterns shared by the engines
     Vec_Int_t      vCopies;       // intermediate copies
     Vec_Int_t *    vTruths;       // used for truth table computation
     Vec_Int_t *    vFlopClasses;  // classes of flops for retiming/merging/etc
@@ -269,6 +278,7 @@ struct Gia_ParSim_t_
     int            nIters;        // the number of timeframes
     int            RandSeed;      // seed to generate random numbers
     int            TimeLimit;     // time limit in seconds
+    int            nMemLimit;     // memory limit for simulation info in MB (0 = no limit)
     int            fCheckMiter;   // check if miter outputs are non-zero
     int            fVerbose;      // enables verbose output
     int            iOutFail;      // index of the failed output
@@ -279,7 +289,7 @@ struct Gia_ManSim_t_
 {
     Gia_Man_t *    pAig;
     Gia_ParSim_t * pPars; 
-    int            nWords;
+    int            nWords;       // the number of words in one batch of patterns
     Vec_Int_t *    vCis2Ids;
     Vec_Int_t *    vConsts;
     // simulation information
@@ -327,7 +337,6 @@ struct Jf_Par_t_
     int            fVeryVerbose;
     int            nLutSizeMax;
     int            nCutNumMax;
-    int            nProcNumMax;
     int            nLutSizeMux;
     word           Delay;
     word           Area;
@@ -612,15 +621,23 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
+        int nObjNew = Abc_MinInt( p->pObjStore ? p->nObjsAlloc + GIA_STORE_PAGE : 2 * p->nObjsAlloc, (1 << 29) );
         if ( p->nObjs == (1 << 29) )
             printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
         assert( p->nObjsAlloc > 0 );
-        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
-        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
+        if ( p->pObjStore ) // the new pages are zero and the objects do not move
+        {
+            if ( !Util_MmapGrow( p->pObjStore, sizeof(Gia_Obj_t) * nObjNew ) )
+                printf( "Cannot extend the file storing the objects. Quitting...\n" ), exit(1);
+        }
+        else
+        {
+            p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
+            memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
+        }
         if ( p->pMuxes )
         {
             p->pMuxes = ABC_REALLOC( unsigned, p->pMuxes, nObjNew );
@@ -1152,7 +1169,7 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
-extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
@@ -1435,6 +1452,19 @@ extern Gia_Man_t *         Gia_ManDupMuxes( Gia_Man_t * p, int Limit );
 extern Gia_Man_t *         Gia_ManDupNoMuxes( Gia_Man_t * p );
 /*=== giaPat.c ===========================================================*/
 extern void                Gia_SatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vCex, Vec_Int_t * vVisit );
+/*=== giaPool.c ===========================================================*/
+extern Gia_Pool_t *        Gia_PoolStart( int nCis );
+extern Gia_Pool_t *        Gia_PoolRef( Gia_Pool_t * p );
+extern void                Gia_PoolStop( Gia_Pool_t * p );
+extern int                 Gia_PoolCiNum( Gia_Pool_t * p );
+extern int                 Gia_PoolPatNum( Gia_Pool_t * p );
+extern word *              Gia_PoolReadPat( Gia_Pool_t * p, int i );
+extern int                 Gia_PoolAddPat( Gia_Pool_t * p, word * pPat );
+extern int                 Gia_PoolAddLits( Gia_Pool_t * p, int * pLits, int nLits );
+extern int                 Gia_PoolAddValues( Gia_Pool_t * p, Vec_Int_t * vValues );
+extern int                 Gia_PoolLoadSimInfo( Gia_Pool_t * p, int iPat, Vec_Ptr_t * vCiInfo, int nWords );
+extern Gia_Pool_t *        Gia_ManPool( Gia_Man_t * p );
+extern void                Gia_ManPoolShare( Gia_Man_t * pNew, Gia_Man_t * p );
 /*=== giaRetime.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManRetimeForward( Gia_Man_t * p, int nMaxIters, int fVerbose );
 /*=== giaSat.c ============================================================*/
@@ -22,6 +22,13 @@
 #include "gia.h"
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -164,73 +171,91 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 /**Function*************************************************************
 
+  Synopsis    [Maps the literal of the AIGER file into the new AIG.]
+
+  Description [When vNodes is NULL, the AIGER literals are used as is.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_AigerReadNode( Vec_Int_t * vNodes, unsigned uLit )
+{
+    return vNodes ? Abc_LitNotCond( Vec_IntEntry(vNodes, uLit >> 1), (uLit & 1) ) : (int)uLit;
+}
+
+/**Function*************************************************************
+
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [The contents are not expected to be zero-terminated. 
+  The parameter line is copied into a terminated buffer before parsing,
+  and the file is checked for truncation before the binary data is read.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
-    Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
+    Vec_Int_t * vNodes = NULL, * vDrivers, * vInits = NULL;
     int iObj, iNode0, iNode1, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
+    int Params[9], nParams;
+    char Header[1000];
+    size_t nHeader;
     unsigned char * pDrivers, * pSymbols, * pCur;
+    unsigned char * pLimit = (unsigned char *)pContents + nFileSize;
     unsigned uLit0, uLit1, uLit;
 
-    // read the parameters (M I L O A + B C J F)
-    pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of objects
-    nTotal = atoi( (const char *)pCur );    while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of inputs
-    nInputs = atoi( (const char *)pCur );   while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of latches
-    nLatches = atoi( (const char *)pCur );  while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of outputs
-    nOutputs = atoi( (const char *)pCur );  while ( *pCur != ' ' ) pCur++; pCur++;
-    // read the number of nodes
-    nAnds = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-    if ( *pCur == ' ' )
-    {
-//        assert( nOutputs == 0 );
-        // read the number of properties
-        pCur++;
-        nBad = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-        nOutputs += nBad;
-    }
-    if ( *pCur == ' ' )
-    {
-        // read the number of properties
-        pCur++;
-        nConstr = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-        nOutputs += nConstr;
-    }
-    if ( *pCur == ' ' )
-    {
-        // read the number of properties
-        pCur++;
-        nJust = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-        nOutputs += nJust;
-    }
-    if ( *pCur == ' ' )
-    {
-        // read the number of properties
-        pCur++;
-        nFair = atoi( (const char *)pCur );     while ( *pCur != ' ' && *pCur != '\n' ) pCur++; 
-        nOutputs += nFair;
-    }
-    if ( *pCur != '\n' )
+    // copy the parameter line into the buffer terminated by the new-line and zero
+    for ( nHeader = 0; nHeader < nFileSize && nHeader < sizeof(Header) - 2; nHeader++ )
+        if ( pContents[nHeader] == '\n' )
+            break;
+    if ( nHeader == nFileSize || pContents[nHeader] != '\n' )
     {
         fprintf( stdout, "The parameter line is in a wrong format.\n" );
         return NULL;
     }
-    pCur++;
+    memcpy( Header, pContents, nHeader );
+    Header[nHeader] = '\n';
+    Header[nHeader+1] = 0;
+
+    // read the parameters (M I L O A + B C J F)
+    pCur = (unsigned char *)Header;  
+    while ( *pCur != ' ' && *pCur != '\n' ) 
+        pCur++;
+    for ( nParams = 0; nParams < 9 && *pCur == ' '; nParams++ )
+    {
+        pCur++;
+        Params[nParams] = atoi( (const char *)pCur );     
+        while ( *pCur != ' ' && *pCur != '\n' ) 
+            pCur++;
+        if ( Params[nParams] < 0 )
+            break;
+    }
+    if ( nParams < 5 || *pCur != '\n' )
+    {
+        fprintf( stdout, "The parameter line is in a wrong format.\n" );
+        return NULL;
+    }
+    nTotal   = Params[0];
+    nInputs  = Params[1];
+    nLatches = Params[2];
+    nOutputs = Params[3];
+    nAnds    = Params[4];
+    // read the number of properties
+    nBad     = nParams > 5 ? Params[5] : 0;
+    nConstr  = nParams > 6 ? Params[6] : 0;
+    nJust    = nParams > 7 ? Params[7] : 0;
+    nFair    = nParams > 8 ? Params[8] : 0;
+    nOutputs += nBad + nConstr + nJust + nFair;
+    pCur = (unsigned char *)pContents + nHeader + 1;
 
     // check the parameters
     if ( nTotal != nInputs + nLatches + nAnds )
@@ -257,15 +282,19 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     pNew->nConstrs = nConstr;
     pNew->fGiaSimple = fGiaSimple;
 
-    // prepare the array of nodes
-    vNodes = Vec_IntAlloc( 1 + nTotal );
-    Vec_IntPush( vNodes, 0 );
+    // prepare the array of nodes (without strashing, the object IDs are the same as in the file)
+    if ( fGiaSimple || !fSkipStrash )
+    {
+        vNodes = Vec_IntAlloc( 1 + nTotal );
+        Vec_IntPush( vNodes, 0 );
+    }
 
     // create the PIs
     for ( i = 0; i < nInputs + nLatches; i++ )
     {
         iObj = Gia_ManAppendCi(pNew);    
-        Vec_IntPush( vNodes, iObj );
+        if ( vNodes )
+            Vec_IntPush( vNodes, iObj );
     }
 
     // remember the beginning of latch/PO literals
@@ -273,7 +302,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     if ( pContents[3] == ' ' ) // standard AIGER
     {
         // scroll to the beginning of the binary data
-        for ( i = 0; i < nLatches + nOutputs; )
+        for ( i = 0; i < nLatches + nOutputs && pCur < pLimit; )
             if ( *pCur++ == '\n' )
                 i++;
     }
@@ -281,28 +310,47 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     {
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
+    if ( pCur > pLimit || (pCur == pLimit && nAnds > 0) || (pContents[3] == ' ' && i < nLatches + nOutputs) )
+    {
+        fprintf( stdout, "The file is truncated.\n" );
+        Vec_IntFreeP( &vNodes );
+        Vec_IntFreeP( &vLits );
+        Gia_ManStop( pNew );
+        return NULL;
+    }
 
     // create the AND gates
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
     for ( i = 0; i < nAnds; i++ )
     {
+        if ( pCur >= pLimit )
+        {
+            fprintf( stdout, "The file is truncated.\n" );
+            Vec_IntFreeP( &vNodes );
+            Vec_IntFreeP( &vLits );
+            Gia_ManStop( pNew );
+            return NULL;
+        }
         uLit = ((i + 1 + nInputs + nLatches) << 1);
         uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
         uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
 //        assert( uLit1 > uLit0 );
-        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
-        assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
+        iNode0 = Gia_AigerReadNode( vNodes, uLit0 );
+        iNode1 = Gia_AigerReadNode( vNodes, uLit1 );
         if ( !fGiaSimple && fSkipStrash )
         {
+            assert( Gia_ManObjNum(pNew) == i + 1 + nInputs + nLatches );
             if ( iNode0 == iNode1 )
-                Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
+                Gia_ManAppendBuf( pNew, iNode0 );
             else
-                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
+                Gia_ManAppendAnd( pNew, iNode0, iNode1 );
         }
         else
+        {
+            assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
             Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+        }
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
@@ -332,14 +380,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 pCur++;
                 Vec_IntPush( vInits, 0 );
             }
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerReadNode( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
             uLit0 = atoi( (char *)pCur );   while ( *pCur++ != '\n' );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerReadNode( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
 
@@ -350,14 +398,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         for ( i = 0; i < nLatches; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerReadNode( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i+nLatches );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerReadNode( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         Vec_IntFree( vLits );
@@ -473,7 +521,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 pName = pCur;          while ( *pCur++ != '\n' );
                 *(pCur-1) = 0;
                 // assign the name
-                Vec_IntWriteEntry( vPoNames, iTerm, pName - (unsigned char *)pContents );
+                Vec_IntWriteEntry( vPoNames, iTerm, pName - pCurOld );
             } 
 
             // check that all names are assigned
@@ -485,12 +533,12 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 {
                     if ( Entry == ~0 )
                         continue;
-                    if ( strncmp( pContents+Entry, "constraint:", 11 ) == 0 )
+                    if ( strncmp( (char *)pCurOld+Entry, "constraint:", 11 ) == 0 )
                     {
                         Vec_IntWriteEntry( vPoTypes, i, 1 );
                         nConstr++;
                     }
-                    if ( strncmp( pContents+Entry, "invariant:", 10 ) == 0 )
+                    if ( strncmp( (char *)pCurOld+Entry, "invariant:", 10 ) == 0 )
                     {
                         Vec_IntWriteEntry( vPoTypes, i, 2 );
                         nInvars++;
@@ -777,7 +825,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
 
     // skipping the comments
-    Vec_IntFree( vNodes );
+    Vec_IntFreeP( &vNodes );
 
     // update polarity of the additional outputs
     if ( nBad || nConstr || nJust || nFair )
@@ -864,6 +912,90 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
 /**Function*************************************************************
 
+  Synopsis    [Makes the contents of the file available in memory.]
+
+  Description [Maps the file into memory when possible, so that the AIG is
+  decoded directly from the page cache without copying the file into a 
+  heap buffer. The mapping is private because the reader terminates the 
+  output names in place; only the pages written into are copied. 
+  Otherwise, reads the file into a buffer. Sets *pfMapped to 1 if the 
+  returned memory is mapped.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_AigerLoadFile( char * pFileName, size_t * pnFileSize, int * pfMapped )
+{
+    FILE * pFile;
+    char * pContents;
+    long nFileSize;
+    int RetValue;
+    *pnFileSize = 0;
+    *pfMapped = 0;
+#ifndef _WIN32
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd == -1 )
+        {
+            printf( "Gia_AigerLoadFile(): The file is unavailable (absent or open).\n" );
+            return NULL;
+        }
+        if ( fstat( fd, &Stat ) == 0 && S_ISREG(Stat.st_mode) && Stat.st_size > 0 && (off_t)(size_t)Stat.st_size == Stat.st_size )
+        {
+            pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+            if ( pContents != (char *)MAP_FAILED )
+            {
+#ifdef MADV_SEQUENTIAL
+                madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+                close( fd );
+                *pnFileSize = (size_t)Stat.st_size;
+                *pfMapped = 1;
+                return pContents;
+            }
+        }
+        close( fd );
+    }
+#endif
+    // read the file into the buffer
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Gia_AigerLoadFile(): The file is unavailable (absent or open).\n" );
+        return NULL;
+    }
+    fseek( pFile, 0, SEEK_END );  
+    nFileSize = ftell( pFile ); 
+    rewind( pFile );
+    if ( nFileSize <= 0 )
+    {
+        printf( "Gia_AigerLoadFile(): The file is empty or cannot be read.\n" );
+        fclose( pFile );
+        return NULL;
+    }
+    *pnFileSize = (size_t)nFileSize;
+    pContents = ABC_ALLOC( char, *pnFileSize );
+    RetValue = fread( pContents, *pnFileSize, 1, pFile );
+    fclose( pFile );
+    return pContents;
+}
+static void Gia_AigerUnloadFile( char * pContents, size_t nFileSize, int fMapped )
+{
+#ifndef _WIN32
+    if ( fMapped )
+    {
+        munmap( pContents, nFileSize );
+        return;
+    }
+#endif
+    ABC_FREE( pContents );
+}
+
+/**Function*************************************************************
+
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
   Description []
@@ -875,22 +1007,18 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 ***********************************************************************/
 Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
 {
-    FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    size_t nFileSize;
+    int fMapped;
 
-    // read the file into the buffer
+    // map the file into memory
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
+    pContents = Gia_AigerLoadFile( pFileName, &nFileSize, &fMapped );
+    if ( pContents == NULL )
+        return NULL;
     pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    Gia_AigerUnloadFile( pContents, nFileSize, fMapped );
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
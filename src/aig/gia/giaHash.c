@@ -27,6 +27,18 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the hash table is an array of p->nHTable entries (the number of entries is
+// a power of 2); each entry is a triple (node literal, fanin0 literal, fanin1 literal);
+// collisions are resolved by linear probing; the entry is empty if its node literal is 0
+#define GIA_HASH_ENTRY     3     // the number of integers in one entry
+#define GIA_HASH_SIZE_MIN  4096  // the smallest number of entries
+
+static inline int * Gia_ManHashEntry( Gia_Man_t * p, int i )    { return p->pHTable + GIA_HASH_ENTRY * i; }
+static inline int   Gia_ManHashSize( int nEntries )              { return 1 << Abc_Base2Log( Abc_MaxInt(4 * nEntries / 3, GIA_HASH_SIZE_MIN) ); }
+// the table is resized when it is more than 3/4 full (the check is performed
+// before each insertion, so probing always reaches an empty entry)
+static inline int   Gia_ManHashIsFull( Gia_Man_t * p )          { return 4 * Gia_ManAndNum(p) > 3 * p->nHTable; }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -35,34 +47,42 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Returns the place where this node is stored (or should be stored).]
 
-  Description []
+  Description [The fanins are stored in the table, so that probing does not
+  access the objects, except for the control input of a MUX. If the node is
+  not found, the fanins are written into the empty entry, which is returned. 
+  This entry remains empty until the node literal is written into it.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize ) 
+static inline unsigned Gia_ManHashOne( int iLit0, int iLit1, int iLitC ) 
 {
-    unsigned Key = iLitC * 2011;
-    Key += Abc_Lit2Var(iLit0) * 7937;
-    Key += Abc_Lit2Var(iLit1) * 2971;
-    Key += Abc_LitIsCompl(iLit0) * 911;
-    Key += Abc_LitIsCompl(iLit1) * 353;
-    return (int)(Key % TableSize);
+    unsigned Key = (unsigned)iLit0 * 0x9E3779B1;
+    Key ^= (unsigned)iLit1 * 0x85EBCA77;
+    Key ^= (unsigned)iLitC * 0xC2B2AE3D;
+    return Key ^ (Key >> 15);
 }
 static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
 {
-    Gia_Obj_t * pThis;
-    int * pPlace = p->pHTable + Gia_ManHashOne( iLit0, iLit1, iLitC, p->nHTable );
+    unsigned Mask = (unsigned)p->nHTable - 1;
+    unsigned i = Gia_ManHashOne( iLit0, iLit1, iLitC ) & Mask;
+    unsigned iStart = i;
+    int * pEntry = Gia_ManHashEntry( p, i );
     assert( p->pMuxes || iLit0 < iLit1 );
     assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
     assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
-    for ( pThis = (*pPlace)? Gia_ManObj(p, Abc_Lit2Var(*pPlace)) : NULL; pThis; 
-          pPlace = (int *)&pThis->Value, pThis = (*pPlace)? Gia_ManObj(p, Abc_Lit2Var(*pPlace)) : NULL )
-              if ( Gia_ObjFaninLit0p(p, pThis) == iLit0 && Gia_ObjFaninLit1p(p, pThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
-                  break;
-    return pPlace;
+    for ( ; pEntry[0]; pEntry = Gia_ManHashEntry(p, i) )
+    {
+        if ( pEntry[1] == iLit0 && pEntry[2] == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2(p, Abc_Lit2Var(pEntry[0])) == iLitC) )
+            return pEntry;
+        i = (i + 1) & Mask;
+        assert( i != iStart ); // the table is never full
+    }
+    pEntry[1] = iLit0;
+    pEntry[2] = iLit1;
+    return pEntry;
 }
 
 /**Function*************************************************************
@@ -103,8 +123,8 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
     assert( p->pHTable == NULL );
-    p->nHTable = Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc );
-    p->pHTable = ABC_CALLOC( int, p->nHTable );
+    p->nHTable = Gia_ManHashSize( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc );
+    p->pHTable = ABC_CALLOC( int, GIA_HASH_ENTRY * p->nHTable );
 }
 
 /**Function*************************************************************
@@ -153,7 +173,8 @@ void Gia_ManHashStop( Gia_Man_t * p )
 
   Synopsis    [Resizes the hash table.]
 
-  Description []
+  Description [The entries are copied from the old table, which is scanned
+  sequentially, without accessing the objects.]
                
   SideEffects []
 
@@ -162,28 +183,24 @@ void Gia_ManHashStop( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashResize( Gia_Man_t * p )
 {
-    Gia_Obj_t * pThis;
-    int * pHTableOld, * pPlace;
-    int nHTableOld, iNext, Counter, Counter2, i;
+    int * pHTableOld, * pEntry, * pPlace;
+    int nHTableOld, iLitC, Counter, Counter2, i;
     assert( p->pHTable != NULL );
     // replace the table
     pHTableOld = p->pHTable;
     nHTableOld = p->nHTable;
-    p->nHTable = Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ); 
-    p->pHTable = ABC_CALLOC( int, p->nHTable );
+    p->nHTable = Gia_ManHashSize( 2 * Gia_ManAndNum(p) ); 
+    p->pHTable = ABC_CALLOC( int, GIA_HASH_ENTRY * p->nHTable );
     // rehash the entries from the old table
     Counter = 0;
-    for ( i = 0; i < nHTableOld; i++ )
-    for ( pThis = (pHTableOld[i]? Gia_ManObj(p, Abc_Lit2Var(pHTableOld[i])) : NULL),
-          iNext = (pThis? pThis->Value : 0);  
-          pThis;  pThis = (iNext? Gia_ManObj(p, Abc_Lit2Var(iNext)) : NULL),   
-          iNext = (pThis? pThis->Value : 0)  )
+    for ( i = 0, pEntry = pHTableOld; i < nHTableOld; i++, pEntry += GIA_HASH_ENTRY )
     {
-        pThis->Value = 0;
-        pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0p(p, pThis), Gia_ObjFaninLit1p(p, pThis), Gia_ObjFaninLit2p(p, pThis) );
+        if ( pEntry[0] == 0 )
+            continue;
+        iLitC = Gia_ObjFaninLit2( p, Abc_Lit2Var(pEntry[0]) );
+        pPlace = Gia_ManHashFind( p, pEntry[1], pEntry[2], iLitC );
         assert( *pPlace == 0 ); // should not be there
-        *pPlace = Abc_Var2Lit( Gia_ObjId(p, pThis), 0 );
-        assert( *pPlace != 0 );
+        *pPlace = pEntry[0];
         Counter++;
     }
     Counter2 = Gia_ManAndNum(p) - Gia_ManBufNum(p);
@@ -206,22 +223,25 @@ void Gia_ManHashResize( Gia_Man_t * p )
 ******************************************************************************/
 void Gia_ManHashProfile( Gia_Man_t * p )
 {
-    Gia_Obj_t * pEntry;
-    int i, Counter, Limit;
+    int * pEntry;
+    unsigned Mask = (unsigned)p->nHTable - 1;
+    int i, iLitC, Dist, DistMax = 0, Counter = 0;
+    word DistSum = 0;
     printf( "Table size = %d. Entries = %d. ", p->nHTable, Gia_ManAndNum(p) );
     printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
-    Limit = Abc_MinInt( 1000, p->nHTable );
-    for ( i = 0; i < Limit; i++ )
+    // compute the distance of each entry from its home position
+    for ( i = 0, pEntry = p->pHTable; i < p->nHTable; i++, pEntry += GIA_HASH_ENTRY )
     {
-        Counter = 0;
-        for ( pEntry = (p->pHTable[i]? Gia_ManObj(p, Abc_Lit2Var(p->pHTable[i])) : NULL); 
-              pEntry; 
-              pEntry = (pEntry->Value? Gia_ManObj(p, Abc_Lit2Var(pEntry->Value)) : NULL) )
-            Counter++;
-        if ( Counter ) 
-            printf( "%d ", Counter );
+        if ( pEntry[0] == 0 )
+            continue;
+        iLitC = Gia_ObjFaninLit2( p, Abc_Lit2Var(pEntry[0]) );
+        Dist = (int)(((unsigned)i - Gia_ManHashOne(pEntry[1], pEntry[2], iLitC)) & Mask);
+        DistMax = Abc_MaxInt( DistMax, Dist );
+        DistSum += Dist;
+        Counter++;
     }
-    printf( "\n" );
+    printf( "Load = %.2f %%. Average probe = %.2f. Max probe = %d.\n", 
+        100.0 * Counter / Abc_MaxInt(p->nHTable, 1), 1.0 + (double)DistSum / Abc_MaxInt(Counter, 1), DistMax + 1 );
 }
 
 /**Function*************************************************************
@@ -478,7 +498,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * p->nHTable < Gia_ManAndNum(p) )
+    if ( Gia_ManHashIsFull(p) )
         Gia_ManHashResize( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
@@ -494,15 +514,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_LitNotCond( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( p->nObjs < p->nObjsAlloc )
-            *pPlace = Gia_ManAppendXorReal( p, iLit0, iLit1 );
-        else
-        {
-            int iNode = Gia_ManAppendXorReal( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = iNode;
-        }
+        *pPlace = Gia_ManAppendXorReal( p, iLit0, iLit1 );
         return Abc_LitNotCond( *pPlace, fCompl );
     }
 }
@@ -537,6 +549,8 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
         return Gia_ManHashOr(p, iLit0, iLit1);
     if ( Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLit1) )
         return Gia_ManHashXorReal( p, iLitC, iLit0 );
+    if ( Gia_ManHashIsFull(p) )
+        Gia_ManHashResize( p );
     if ( iLit0 > iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Abc_LitNot(iLitC);
     if ( Abc_LitIsCompl(iLit1) )
@@ -549,15 +563,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
             return Abc_LitNotCond( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( p->nObjs < p->nObjsAlloc )
-            *pPlace = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
-        else
-        {
-            int iNode = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-            assert( *pPlace == 0 );
-            *pPlace = iNode;
-        }
+        *pPlace = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
         return Abc_LitNotCond( *pPlace, fCompl );
     }
 }
@@ -588,7 +594,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( p->nHTable == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * p->nHTable < Gia_ManAndNum(p) )
+    if ( Gia_ManHashIsFull(p) )
         Gia_ManHashResize( p );
     if ( p->fAddStrash )
     {
@@ -606,15 +612,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
             return *pPlace;
         }
         p->nHashMiss++;
-        if ( p->nObjs < p->nObjsAlloc )
-            return *pPlace = Gia_ManAppendAnd( p, iLit0, iLit1 );
-        else
-        {
-            int iNode = Gia_ManAppendAnd( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            return *pPlace = iNode;
-        }
+        return *pPlace = Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
 }
 int Gia_ManHashOr( Gia_Man_t * p, int iLit0, int iLit1 )  
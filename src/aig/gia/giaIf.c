@@ -67,6 +67,7 @@ void Gia_ManSetIfParsDefault( void * pp )
     p->nCutsMax    =  8;
     p->nFlowIters  =  1;
     p->nAreaIters  =  2;
+    p->nProcs      =  1;
     p->DelayTarget = -1;
     p->Epsilon     =  (float)0.005;
     p->fPreprocess =  1;
@@ -533,7 +534,7 @@ void Gia_ManPrintMappingStats( Gia_Man_t * p, char * pDumpFile )
     if ( pDumpFile )
     {
         static char FileNameOld[1000] = {0};
-        static abctime clk = 0;
+        static ABC_THREAD_LOCAL abctime clk = 0;
         FILE * pTable = fopen( pDumpFile, "a+" );
         if ( strcmp( FileNameOld, p->pName ) )
         {
@@ -20,17 +20,7 @@
 
 #include "gia.h"
 #include "misc/vec/vecSet.h"
-
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
-#endif
-
-#endif
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -47,7 +37,6 @@ Gia_Man_t * Kf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars ) { return
 
 #define KF_LEAF_MAX  16
 #define KF_CUT_MAX   32
-#define KF_PROC_MAX  32
 #define KF_WORD_MAX  ((KF_LEAF_MAX > 6) ? 1 << (KF_LEAF_MAX-6) : 1)
 #define KF_LOG_TABLE  8
 
@@ -101,7 +90,7 @@ struct Kf_Man_t_
     Vec_Flt_t       vRefs;       // node params
     Vec_Int_t *     vTemp;       // temporary
     abctime         clkStart;    // starting time
-    Kf_Set_t        pSett[KF_PROC_MAX];
+    Kf_Set_t *      pSett;       // cut sets (one for each thread)
 };
 
 static inline int   Kf_SetCutId( Kf_Set_t * p, Kf_Cut_t * pCut )           { return pCut - p->pCutsR;               }
@@ -951,41 +940,22 @@ int Kf_ManComputeRefs( Kf_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 100
 typedef struct Kf_ThData_t_
 {
     Kf_Set_t *  pSett;
     int         Id;
-    int         Status;
     abctime     clkUsed;
 } Kf_ThData_t;
-void * Kf_WorkerThread( void * pArg )
+int Kf_WorkerTask( void * pArg )
 {
     Kf_ThData_t * pThData = (Kf_ThData_t *)pArg;
     Kf_Man_t * pMan = pThData->pSett->pMan;
-    int fAreaOnly = pThData->pSett->pMan->pPars->fAreaOnly;
-    int fCutMin = pThData->pSett->pMan->pPars->fCutMin;
-    volatile int * pPlace = &pThData->Status;
-    abctime clk;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->Status == 1 );
-        if ( pThData->Id == -1 )
-        {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        assert( pThData->Id >= 0 );
-        clk = Abc_Clock();
-        Kf_SetMergeOrder( pThData->pSett, Kf_ObjCuts0(pMan, pThData->Id), Kf_ObjCuts1(pMan, pThData->Id), fAreaOnly, fCutMin );
-        pThData->clkUsed += Abc_Clock() - clk;
-        pThData->Status = 0;
-//        printf( "Finished object %d\n", pThData->Id );
-    }
-	assert( 0 );
-	return NULL;
+    abctime clk = Abc_Clock();
+    assert( pThData->Id >= 0 );
+    Kf_SetMergeOrder( pThData->pSett, Kf_ObjCuts0(pMan, pThData->Id), Kf_ObjCuts1(pMan, pThData->Id), pMan->pPars->fAreaOnly, pMan->pPars->fCutMin );
+    pThData->clkUsed += Abc_Clock() - clk;
+//    printf( "Finished object %d\n", pThData->Id );
+    return 1;
 }
 Vec_Int_t * Kf_ManCreateFaninCounts( Gia_Man_t * p )  
 {
@@ -1004,14 +974,14 @@ Vec_Int_t * Kf_ManCreateFaninCounts( Gia_Man_t * p )
 }
 void Kf_ManComputeCuts( Kf_Man_t * p )
 {
-	pthread_t WorkerThread[PAR_THR_MAX];
-    Kf_ThData_t ThData[PAR_THR_MAX];
+    Util_Pool_t * pPool;
+    Util_Task_t ** ppTasks;
+    Kf_ThData_t * ThData;
     Vec_Int_t * vStack, * vFanins;
     Gia_Obj_t * pObj;
     int nProcs = p->pPars->nProcNum;
-    int i, k, iFan, status, nCountFanins, fRunning;
+    int i, k, iObj, iFan, nCountFanins;
     abctime clk, clkUsed = 0;
-    assert( nProcs <= PAR_THR_MAX );
     // start fanins
     vFanins = Kf_ManCreateFaninCounts( p->pGia );
     Gia_ManStaticFanoutStart( p->pGia );
@@ -1020,64 +990,57 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
     Gia_ManForEachObjReverse( p->pGia, pObj, k )
         if ( Gia_ObjIsAnd(pObj) && Vec_IntEntry(vFanins, k) == 0 )
             Vec_IntPush( vStack, k );
-    // start the threads
+    // each of the nProcs tasks running at the same time uses its own cut set
+    pPool   = Util_PoolGlobal( nProcs );
+    ppTasks = ABC_CALLOC( Util_Task_t *, nProcs );
+    ThData  = ABC_CALLOC( Kf_ThData_t, nProcs );
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].pSett = p->pSett + i;
         ThData[i].Id = -1;
-        ThData[i].Status = 0;
-        ThData[i].clkUsed = 0;
-        status = pthread_create( WorkerThread + i, NULL, Kf_WorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
     nCountFanins = Vec_IntSum(vFanins);
-    fRunning = 1;
-    while ( nCountFanins > 0 || Vec_IntSize(vStack) > 0 || fRunning )
+    while ( 1 )
     {
-        for ( i = 0; i < nProcs; i++ )
+        // schedule the nodes whose fanins are ready
+        for ( i = 0; i < nProcs && Vec_IntSize(vStack) > 0; i++ )
         {
-            if ( ThData[i].Status )
+            if ( ppTasks[i] != NULL )
                 continue;
-            assert( ThData[i].Status == 0 );
-            if ( ThData[i].Id >= 0 )
-            {
-                int iObj = ThData[i].Id;
-                Kf_Set_t * pSett = p->pSett + i;
-                //printf( "Closing obj %d with Thread %d:\n", iObj, i );
-                clk = Abc_Clock();
-                // finalize the results
-                Kf_ManSaveResults( pSett->ppCuts, pSett->nCuts, pSett->pCutBest, p->vTemp );
-                Vec_IntWriteEntry( &p->vTime, iObj, pSett->pCutBest->Delay + 1 );
-                Vec_FltWriteEntry( &p->vArea, iObj, (pSett->pCutBest->Area + 1)/Kf_ObjRefs(p, iObj) );
-                if ( pSett->pCutBest->nLeaves > 1 )
-                    Kf_ManStoreAddUnit( p->vTemp, iObj, Kf_ObjTime(p, iObj), Kf_ObjArea(p, iObj) );
-                Kf_ObjSetCuts( p, iObj, p->vTemp );
-                //Gia_CutSetPrint( Kf_ObjCuts(p, iObj) );
-                clkUsed += Abc_Clock() - clk;
-                // schedule other nodes
-                Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFan, k )
-                {
-                    if ( !Gia_ObjIsAnd(Gia_ManObj(p->pGia, iFan)) )
-                        continue;
-                    assert( Vec_IntEntry(vFanins, iFan) > 0 );
-                    if ( Vec_IntAddToEntry(vFanins, iFan, -1) == 0 )
-                        Vec_IntPush( vStack, iFan );
-                    assert( nCountFanins > 0 );
-                    nCountFanins--;
-                }
-                ThData[i].Id = -1;
-            }
-            if ( Vec_IntSize(vStack) > 0 )
-            {
-                ThData[i].Id = Vec_IntPop( vStack );
-                ThData[i].Status = 1;
-                //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
-            }
+            ThData[i].Id = Vec_IntPop( vStack );
+            ppTasks[i] = Util_PoolSubmit( pPool, Kf_WorkerTask, ThData + i );
+            //printf( "Scheduling %d for Thread %d\n", ThData[i].Id, i );
         }
-        fRunning = 0;
-        for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].Status == 1 || (ThData[i].Status == 0 && ThData[i].Id >= 0) )
-                fRunning = 1;
-//        printf( "fRunning %d\n", fRunning );
+        // wait for one of them to finish
+        i = Util_TaskWaitAny( ppTasks, nProcs );
+        if ( i == -1 )
+            break;
+        Util_TaskFree( ppTasks[i] );
+        ppTasks[i] = NULL;
+        iObj = ThData[i].Id;
+        //printf( "Closing obj %d with Thread %d:\n", iObj, i );
+        clk = Abc_Clock();
+        // finalize the results
+        Kf_ManSaveResults( ThData[i].pSett->ppCuts, ThData[i].pSett->nCuts, ThData[i].pSett->pCutBest, p->vTemp );
+        Vec_IntWriteEntry( &p->vTime, iObj, ThData[i].pSett->pCutBest->Delay + 1 );
+        Vec_FltWriteEntry( &p->vArea, iObj, (ThData[i].pSett->pCutBest->Area + 1)/Kf_ObjRefs(p, iObj) );
+        if ( ThData[i].pSett->pCutBest->nLeaves > 1 )
+            Kf_ManStoreAddUnit( p->vTemp, iObj, Kf_ObjTime(p, iObj), Kf_ObjArea(p, iObj) );
+        Kf_ObjSetCuts( p, iObj, p->vTemp );
+        //Gia_CutSetPrint( Kf_ObjCuts(p, iObj) );
+        clkUsed += Abc_Clock() - clk;
+        // schedule other nodes
+        Gia_ObjForEachFanoutStaticId( p->pGia, iObj, iFan, k )
+        {
+            if ( !Gia_ObjIsAnd(Gia_ManObj(p->pGia, iFan)) )
+                continue;
+            assert( Vec_IntEntry(vFanins, iFan) > 0 );
+            if ( Vec_IntAddToEntry(vFanins, iFan, -1) == 0 )
+                Vec_IntPush( vStack, iFan );
+            assert( nCountFanins > 0 );
+            nCountFanins--;
+        }
+        ThData[i].Id = -1;
     }
     Vec_IntForEachEntry( vFanins, iFan, k )
         if ( iFan != 0 )
@@ -1086,27 +1049,22 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
             Gia_ObjPrint( p->pGia, Gia_ManObj(p->pGia, k) );
         }
     assert( Vec_IntSum(vFanins) == 0 );
-    // stop the threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        assert( ThData[i].Status == 0 );
-        ThData[i].Id = -1;
-        ThData[i].Status = 1;
-    }
     Gia_ManStaticFanoutStop( p->pGia );
     Vec_IntFree( vStack );
     Vec_IntFree( vFanins );
-    if ( !p->pPars->fVerbose )
-        return;
     // print runtime statistics
-    printf( "Main     : " );
-    Abc_PrintTime( 1, "Time", clkUsed );
-    for ( i = 0; i < nProcs; i++ )
+    if ( p->pPars->fVerbose )
     {
-        printf( "Thread %d : ", i );
-        Abc_PrintTime( 1, "Time", ThData[i].clkUsed );
+        printf( "Main     : " );
+        Abc_PrintTime( 1, "Time", clkUsed );
+        for ( i = 0; i < nProcs; i++ )
+        {
+            printf( "Thread %d : ", i );
+            Abc_PrintTime( 1, "Time", ThData[i].clkUsed );
+        }
     }
-
+    ABC_FREE( ppTasks );
+    ABC_FREE( ThData );
 }
 
 /**Function*************************************************************
@@ -1226,7 +1184,6 @@ Kf_Man_t * Kf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Kf_Man_t * p; int i;
     assert( pPars->nLutSize <= KF_LEAF_MAX );
     assert( pPars->nCutNum  <= KF_CUT_MAX  );
-    assert( pPars->nProcNum <= KF_PROC_MAX );
     Vec_IntFreeP( &pGia->vMapping );
     p = ABC_CALLOC( Kf_Man_t, 1 );
     p->clkStart  = Abc_Clock();
@@ -1239,6 +1196,7 @@ Kf_Man_t * Kf_ManAlloc( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Kf_ManSetInitRefs( pGia, &p->vRefs );
     p->vTemp     = Vec_IntAlloc( 1000 );
     pGia->pRefs  = ABC_CALLOC( int, Gia_ManObjNum(pGia) );
+    p->pSett     = ABC_CALLOC( Kf_Set_t, Abc_MaxInt(1, pPars->nProcNum) );
     // prepare cut sets
     for ( i = 0; i < Abc_MaxInt(1, pPars->nProcNum); i++ )
     {
@@ -1258,6 +1216,7 @@ void Kf_ManFree( Kf_Man_t * p )
     ABC_FREE( p->vRefs.pArray );
     Vec_IntFreeP( &p->vTemp );
     Vec_SetFree_( &p->pMem );
+    ABC_FREE( p->pSett );
     ABC_FREE( p );
 }
 Gia_Man_t * Kf_ManDerive( Kf_Man_t * p )
@@ -1318,7 +1277,6 @@ void Kf_ManSetDefaultPars( Jf_Par_t * pPars )
     pPars->fVeryVerbose =  0;
     pPars->nLutSizeMax  =  KF_LEAF_MAX;
     pPars->nCutNumMax   =  KF_CUT_MAX;
-    pPars->nProcNumMax  =  KF_PROC_MAX;
 }
 Gia_Man_t * Kf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
 {
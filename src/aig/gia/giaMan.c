@@ -22,6 +22,7 @@
 #include "misc/tim/tim.h"
 #include "proof/abs/abs.h"
 #include "opt/dar/dar.h"
+#include "base/main/main.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -42,6 +43,28 @@ extern void Gia_ManDfsSlacksPrint( Gia_Man_t * p );
 
 /**Function*************************************************************
 
+  Synopsis    [Starts file-backed storage of the objects.]
+
+  Description [Returns NULL unless the AIG is large and the directory for
+  the files is given by "set giastore <dir>". The addresses are reserved 
+  for the largest number of objects, so the objects never move, and the 
+  file grows in pages of GIA_STORE_PAGE objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Mmap_t * Gia_ManStoreStart( int nObjsMax )
+{
+    char * pDir;
+    if ( nObjsMax < GIA_STORE_MIN || (pDir = Abc_FrameReadFlag("giastore")) == NULL )
+        return NULL;
+    return Util_MmapStart( pDir, sizeof(Gia_Obj_t) * (size_t)(1 << 29), sizeof(Gia_Obj_t) * GIA_STORE_PAGE );
+}
+
+/**Function*************************************************************
+
   Synopsis    [Creates AIG.]
 
   Description []
@@ -57,7 +80,15 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
     assert( nObjsMax > 0 );
     p = ABC_CALLOC( Gia_Man_t, 1 );
     p->nObjsAlloc = nObjsMax;
-    p->pObjs = ABC_CALLOC( Gia_Obj_t, nObjsMax );
+    p->pObjStore = Gia_ManStoreStart( nObjsMax );
+    if ( p->pObjStore && Util_MmapGrow( p->pObjStore, sizeof(Gia_Obj_t) * nObjsMax ) )
+        p->pObjs = (Gia_Obj_t *)Util_MmapArray( p->pObjStore );
+    else
+    {
+        if ( p->pObjStore )
+            Util_MmapStop( p->pObjStore ), p->pObjStore = NULL;
+        p->pObjs = ABC_CALLOC( Gia_Obj_t, nObjsMax );
+    }
     p->pObjs->iDiff0 = p->pObjs->iDiff1 = GIA_NONE;
     p->nObjs = 1;
     p->vCis  = Vec_IntAlloc( nObjsMax / 20 );
@@ -80,6 +111,8 @@ void Gia_ManStop( Gia_Man_t * p )
 {
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec );
+    if ( p->pPool )
+        Gia_PoolStop( p->pPool );
     Gia_ManStaticFanoutStop( p );
     Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
     assert( p->pManTime == NULL );
@@ -154,6 +187,8 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pLutRefs );
     ABC_FREE( p->pHTable );
     ABC_FREE( p->pMuxes );
+    if ( p->pObjStore )
+        Util_MmapStop( p->pObjStore ), p->pObjs = NULL;
     ABC_FREE( p->pObjs );
     ABC_FREE( p->pSpec );
     ABC_FREE( p->pName );
@@ -177,7 +212,7 @@ double Gia_ManMemory( Gia_Man_t * p )
     Memory += sizeof(Gia_Obj_t) * Gia_ManObjNum(p);
     Memory += sizeof(int) * Gia_ManCiNum(p);
     Memory += sizeof(int) * Gia_ManCoNum(p);
-    Memory += sizeof(int) * p->nHTable * (p->pHTable != NULL);
+    Memory += sizeof(int) * 3 * p->nHTable * (p->pHTable != NULL);
     Memory += sizeof(int) * Gia_ManObjNum(p) * (p->pRefs != NULL);
     Memory += Vec_IntMemory( p->vLevels );
     Memory += Vec_IntMemory( p->vCellMapping );
@@ -491,8 +526,8 @@ void Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars )
         printf( "\nXOR/MUX " ), Gia_ManPrintMuxStats( p );
     if ( pPars && pPars->fSwitch )
     {
-        static int nPiPo = 0;
-        static float PrevSwiTotal = 0;
+        static ABC_THREAD_LOCAL int nPiPo = 0;
+        static ABC_THREAD_LOCAL float PrevSwiTotal = 0;
         float SwiTotal = Gia_ManComputeSwitching( p, 48, 16, 0 );
         Abc_Print( 1, "  power =%8.1f", SwiTotal );
         if ( PrevSwiTotal > 0 && nPiPo == Gia_ManCiNum(p) + Gia_ManCoNum(p) )
@@ -98,6 +98,13 @@ struct Nf_Man_t_
     Vec_Flt_t       vCutFlows;      // temporary cut area
     Vec_Int_t       vCutDelays;     // temporary cut delay
     Vec_Int_t       vBackup;        // backup literals
+    Vec_Int_t       vChanged;       // nodes whose matches were changed by area recovery
+    Vec_Int_t       vArrLevels;     // levels of the nodes (the buffers are counted)
+    Vec_Wec_t *     vMapFans;       // for each node, the nodes whose matches may use it as a fanin
+    Vec_Wec_t *     vArrQue;        // levelized queue of the nodes whose arrival times may change
+    Vec_Bit_t *     vArrDirty;      // nodes in the arrival time queue
+    Vec_Bit_t *     vReqQue;        // nodes to be visited by the area recovery
+    int             fArrValid;      // arrival times are up to date, except for the changed nodes
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
@@ -390,6 +397,9 @@ Nf_Man_t * Nf_StoCreate( Gia_Man_t * pGia, Jf_Par_t * pPars )
     Vec_FltFill( &p->vCutFlows, Gia_ManObjNum(pGia), 0 );              // cut area
     Vec_IntFill( &p->vCutDelays,Gia_ManObjNum(pGia), 0 );              // cut delay
     Vec_IntGrow( &p->vBackup, 1000 );
+    Vec_IntGrow( &p->vChanged, 1000 );
+    p->vArrDirty = Vec_BitStart( Gia_ManObjNum(pGia) );
+    p->vReqQue   = Vec_BitStart( Gia_ManObjNum(pGia) );
     // references
     vFlowRefs = Vec_IntAlloc(0);
     Mf_ManSetFlowRefs( pGia, vFlowRefs );
@@ -420,6 +430,12 @@ void Nf_StoDelete( Nf_Man_t * p )
     ABC_FREE( p->vCutFlows.pArray );
     ABC_FREE( p->vCutDelays.pArray );
     ABC_FREE( p->vBackup.pArray );
+    ABC_FREE( p->vChanged.pArray );
+    ABC_FREE( p->vArrLevels.pArray );
+    Vec_WecFreeP( &p->vMapFans );
+    Vec_WecFreeP( &p->vArrQue );
+    Vec_BitFreeP( &p->vArrDirty );
+    Vec_BitFreeP( &p->vReqQue );
     ABC_FREE( p->pNfObjs );
     ABC_FREE( p );
 }
@@ -1851,94 +1867,320 @@ int Nf_ManComputeArrival( Nf_Man_t * p, Nf_Mat_t * pM, int * pCutSet )
     //if ( pM->fCompl ) Delay += p->InvDelayI;
     return Delay;
 }
-void Nf_ManResetMatches( Nf_Man_t * p, int Round )
+static inline int Nf_ManMatchIsSame( Nf_Mat_t * pM0, Nf_Mat_t * pM1 )
+{
+    return pM0->Gate == pM1->Gate && pM0->CutH == pM1->CutH && pM0->fCompl == pM1->fCompl && Nf_Cfg2Int(pM0->Cfg) == Nf_Cfg2Int(pM1->Cfg) && pM0->D == pM1->D;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the node as a fanout of the fanins of the match.]
+
+  Description [The fanout lists are a superset of the fanouts in the 
+  current mapping: they contain the fanins of all matches stored at the 
+  node, which are swapped when the best matches are selected, and the 
+  fanins of the matches found by area recovery.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Nf_ManMapFanAdd( Nf_Man_t * p, int iObj, Nf_Mat_t * pM )
+{
+    Vec_Int_t * vFans;
+    int iVar, fCompl, k, * pCut;
+    if ( pM->fCompl || pM->CutH == 0 )
+        return;
+    pCut = Nf_CutFromHandle( Nf_ObjCutSet(p, iObj), pM->CutH );
+    Nf_CutForEachVarCompl( pCut, pM->Cfg, iVar, fCompl, k )
+    {
+        vFans = Vec_WecEntry( p->vMapFans, iVar );
+        if ( Vec_IntSize(vFans) == 0 || Vec_IntEntryLast(vFans) != iObj )
+            Vec_IntPush( vFans, iObj );
+    }
+}
+static inline void Nf_ManArrEnqueue( Nf_Man_t * p, int iObj )
+{
+    if ( Vec_BitEntry(p->vArrDirty, iObj) )
+        return;
+    Vec_BitWriteEntry( p->vArrDirty, iObj, 1 );
+    Vec_WecPush( p->vArrQue, Vec_IntEntry(&p->vArrLevels, iObj), iObj );
+}
+static inline void Nf_ManArrEnqueueFanouts( Nf_Man_t * p, int iObj )
+{
+    int k, iFanout;
+    Vec_IntForEachEntry( Vec_WecEntry(p->vMapFans, iObj), iFanout, k )
+        Nf_ManArrEnqueue( p, iFanout );
+}
+void Nf_ManArrStart( Nf_Man_t * p )
 {
     Gia_Obj_t * pObj;
-    Nf_Mat_t * pDc, * pAc, * pMfan, * pM[2]; 
-    int i, c, Arrival;
-    // go through matches in the topo order
+    int i, c, Level, iFanin;
+    Vec_IntFill( &p->vArrLevels, Gia_ManObjNum(p->pGia), 0 );
+    p->vMapFans = Vec_WecStart( Gia_ManObjNum(p->pGia) );
     Gia_ManForEachAnd( p->pGia, pObj, i )
     {
         if ( Gia_ObjIsBuf(pObj) )
         {
-            pMfan = Nf_ObjMatchBest( p, Gia_ObjFaninId0(pObj, i), Gia_ObjFaninC0(pObj) );
-            for ( c = 0; c < 2; c++ )
-            {
-                pDc = Nf_ObjMatchD( p, i, c );
-                pAc = Nf_ObjMatchA( p, i, c );
-                pDc->F = pAc->F = 0;
-                pDc->D = pMfan->D + (c ? p->InvDelayI : 0); 
-                assert( pDc->fBest );
-                assert( !pAc->fBest );
-                assert( c==0 || pDc->fCompl );
-            }
+            iFanin = Gia_ObjFaninId0(pObj, i);
+            Vec_IntWriteEntry( &p->vArrLevels, i, 1 + Vec_IntEntry(&p->vArrLevels, iFanin) );
+            Vec_WecPush( p->vMapFans, iFanin, i );
             continue;
         }
-        // select the best match for each phase
+        Level = Abc_MaxInt( Vec_IntEntry(&p->vArrLevels, Gia_ObjFaninId0(pObj, i)), Vec_IntEntry(&p->vArrLevels, Gia_ObjFaninId1(pObj, i)) );
+        Vec_IntWriteEntry( &p->vArrLevels, i, 1 + Level );
         for ( c = 0; c < 2; c++ )
         {
-            pDc = Nf_ObjMatchD( p, i, c );
-            pAc = Nf_ObjMatchA( p, i, c );
-            pDc->F = pAc->F = 0;
-            if ( Nf_ObjMapRefNum(p, i, c) )
-            {
-                assert( pDc->fBest != pAc->fBest );
-                if ( pAc->fBest )
-                    ABC_SWAP( Nf_Mat_t, *pDc, *pAc );
-                assert( pDc->fBest );
-                assert( !pAc->fBest );
-            }
-            else
-            {
-                assert( Round > 0 || (!pDc->fBest && !pAc->fBest) );
-//                if ( (p->pPars->fAreaOnly || (Round & 1)) && !pAc->fCompl )
-                if ( (Round & 1) && !pAc->fCompl )
-                    ABC_SWAP( Nf_Mat_t, *pDc, *pAc );
-                pDc->fBest = 1;
-                pAc->fBest = 0;
-            }
+            Nf_ManMapFanAdd( p, i, Nf_ObjMatchD(p, i, c) );
+            Nf_ManMapFanAdd( p, i, Nf_ObjMatchA(p, i, c) );
         }
-        // consider best matches of both phases
-        pM[0] = Nf_ObjMatchD( p, i, 0 );
-        pM[1] = Nf_ObjMatchD( p, i, 1 );
-        assert( pM[0]->fBest && pM[1]->fBest );
-        // swap complemented matches
-        if ( pM[0]->fCompl && pM[1]->fCompl )
+    }
+    p->vArrQue = Vec_WecStart( Vec_IntFindMax(&p->vArrLevels) + 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the best matches of the node.]
+
+  Description [Returns 1 if the best match of one of the phases was 
+  replaced.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Nf_ManResetSelect( Nf_Man_t * p, int i, int Round )
+{
+    Nf_Mat_t * pDc, * pAc;
+    int c, fChange = 0;
+    for ( c = 0; c < 2; c++ )
+    {
+        pDc = Nf_ObjMatchD( p, i, c );
+        pAc = Nf_ObjMatchA( p, i, c );
+        pDc->F = pAc->F = 0;
+        if ( Gia_ObjIsBuf(Gia_ManObj(p->pGia, i)) )
         {
-//            pM[0]->fCompl = pM[1]->fCompl = 0;
-//            ABC_SWAP( Nf_Mat_t *, pM[0], pM[1] );
-            assert( 0 );
+            assert( pDc->fBest );
+            assert( !pAc->fBest );
+            assert( c==0 || pDc->fCompl );
+            continue;
         }
-        if ( !pM[0]->fCompl && !pM[1]->fCompl )
+        if ( Nf_ObjMapRefNum(p, i, c) )
         {
-            for ( c = 0; c < 2; c++ )
+            assert( pDc->fBest != pAc->fBest );
+            if ( pAc->fBest )
             {
-                Arrival = Nf_ManComputeArrival( p, pM[c], Nf_ObjCutSet(p, i) );
-                //if ( Nf_ObjMapRefNum(p, i, c) )
-                //    assert( Round || Arrival <= pM[c]->D );
-                pM[c]->D = Arrival;
+                ABC_SWAP( Nf_Mat_t, *pDc, *pAc );
+                fChange = 1;
             }
+            assert( pDc->fBest );
+            assert( !pAc->fBest );
         }
-        else 
+        else
+        {
+            assert( Round > 0 || (!pDc->fBest && !pAc->fBest) );
+//            if ( (p->pPars->fAreaOnly || (Round & 1)) && !pAc->fCompl )
+            if ( (Round & 1) && !pAc->fCompl )
+            {
+                ABC_SWAP( Nf_Mat_t, *pDc, *pAc );
+                fChange = 1;
+            }
+            pDc->fBest = 1;
+            pAc->fBest = 0;
+        }
+    }
+    return fChange;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the arrival times of the node.]
+
+  Description [Returns 1 if the arrival time of one of the phases has
+  changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Nf_ManResetArrival( Nf_Man_t * p, int i )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, i );
+    Nf_Mat_t * pDc, * pMfan, * pM[2]; 
+    int c, Arrival, fChange = 0;
+    if ( Gia_ObjIsBuf(pObj) )
+    {
+        pMfan = Nf_ObjMatchBest( p, Gia_ObjFaninId0(pObj, i), Gia_ObjFaninC0(pObj) );
+        for ( c = 0; c < 2; c++ )
+        {
+            pDc = Nf_ObjMatchD( p, i, c );
+            Arrival = pMfan->D + (c ? p->InvDelayI : 0);
+            fChange |= (pDc->D != Arrival);
+            pDc->D = Arrival; 
+        }
+        return fChange;
+    }
+    // consider best matches of both phases
+    pM[0] = Nf_ObjMatchD( p, i, 0 );
+    pM[1] = Nf_ObjMatchD( p, i, 1 );
+    assert( pM[0]->fBest && pM[1]->fBest );
+    // swap complemented matches
+    if ( pM[0]->fCompl && pM[1]->fCompl )
+    {
+//        pM[0]->fCompl = pM[1]->fCompl = 0;
+//        ABC_SWAP( Nf_Mat_t *, pM[0], pM[1] );
+        assert( 0 );
+    }
+    if ( !pM[0]->fCompl && !pM[1]->fCompl )
+    {
+        for ( c = 0; c < 2; c++ )
         {
-            // consider non-complemented match
-            c = !pM[1]->fCompl;
-            assert( !pM[c]->fCompl );
-            assert( pM[!c]->fCompl );
             Arrival = Nf_ManComputeArrival( p, pM[c], Nf_ObjCutSet(p, i) );
             //if ( Nf_ObjMapRefNum(p, i, c) )
             //    assert( Round || Arrival <= pM[c]->D );
+            fChange |= (pM[c]->D != Arrival);
             pM[c]->D = Arrival;
-            // consider complemented match
-            Arrival = pM[!c]->D;
-            *pM[!c] = *pM[c];
-            pM[!c]->D += p->InvDelayI;
-            pM[!c]->fCompl = 1;
-            //if ( Nf_ObjMapRefNum(p, i, !c) )
-            //    assert( Round || pM[!c]->D <= Arrival );
         }
     }
+    else 
+    {
+        // consider non-complemented match
+        c = !pM[1]->fCompl;
+        assert( !pM[c]->fCompl );
+        assert( pM[!c]->fCompl );
+        Arrival = Nf_ManComputeArrival( p, pM[c], Nf_ObjCutSet(p, i) );
+        //if ( Nf_ObjMapRefNum(p, i, c) )
+        //    assert( Round || Arrival <= pM[c]->D );
+        fChange |= (pM[c]->D != Arrival || pM[!c]->D != Arrival + p->InvDelayI);
+        pM[c]->D = Arrival;
+        // consider complemented match
+        *pM[!c] = *pM[c];
+        pM[!c]->D += p->InvDelayI;
+        pM[!c]->fCompl = 1;
+        //if ( Nf_ObjMapRefNum(p, i, !c) )
+        //    assert( Round || pM[!c]->D <= Arrival );
+    }
+    return fChange;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the best matches and updates the arrival times.]
+
+  Description [The first call updates the arrival times of all nodes. 
+  After that, the arrival times are updated incrementally, similar to 
+  Abc_SclTimeIncUpdate(). The levelized queue is seeded with the nodes 
+  whose best matches were changed by area recovery (these nodes are 
+  collected in p->vChanged) or by the selection below. The nodes are 
+  re-timed in the order of their levels, and when the arrival time of 
+  a node changes, its fanouts in the mapping are added to the queue. 
+  The result is the same as in the full update. The selection itself 
+  visits all nodes, because it depends on the round number and the 
+  reference counters, but it does not look at the cuts.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nf_ManResetMatches( Nf_Man_t * p, int Round )
+{
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vLevel;
+    int i, k, iObj;
+    if ( !p->fArrValid )
+    {
+        // go through matches in the topo order
+        Gia_ManForEachAnd( p->pGia, pObj, i )
+        {
+            Nf_ManResetSelect( p, i, Round );
+            Nf_ManResetArrival( p, i );
+        }
+        Nf_ManArrStart( p );
+        Vec_IntClear( &p->vChanged );
+        p->fArrValid = 1;
+        return;
+    }
+    // seed the queue with the nodes whose matches were changed
+    // (their arrival times were changed with the matches, so their fanouts are added too)
+    Vec_IntForEachEntry( &p->vChanged, iObj, i )
+    {
+        Nf_ManArrEnqueue( p, iObj );
+        Nf_ManArrEnqueueFanouts( p, iObj );
+    }
+    Vec_IntClear( &p->vChanged );
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+        if ( Nf_ManResetSelect( p, i, Round ) )
+        {
+            Nf_ManArrEnqueue( p, i );
+            Nf_ManArrEnqueueFanouts( p, i );
+        }
+    // propagate the changes in the topo order
+    Vec_WecForEachLevel( p->vArrQue, vLevel, i )
+    {
+        Vec_IntForEachEntry( vLevel, iObj, k )
+        {
+            Vec_BitWriteEntry( p->vArrDirty, iObj, 0 );
+            if ( Nf_ManResetArrival( p, iObj ) )
+                Nf_ManArrEnqueueFanouts( p, iObj );
+        }
+        Vec_IntClear( vLevel );
+    }
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the largest node in the queue not exceeding iStart.]
+
+  Description [The node is removed from the queue. Returns -1 if there
+  is no such node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Nf_ManReqQuePop( Nf_Man_t * p, int iStart )
+{
+    int * pArray = Vec_BitArray( p->vReqQue );
+    int w = iStart >> 5, b;
+    unsigned uWord;
+    if ( iStart < 0 )
+        return -1;
+    uWord = (unsigned)pArray[w] & (0xFFFFFFFF >> (31 - (iStart & 31)));
+    while ( uWord == 0 )
+    {
+        if ( --w < 0 )
+            return -1;
+        uWord = (unsigned)pArray[w];
+    }
+    for ( b = 31; !((uWord >> b) & 1); b-- );
+    pArray[w] &= ~(1u << b);
+    return 32 * w + b;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs exact area recovery.]
+
+  Description [The required times are propagated from the outputs in the
+  reverse topological order, and area recovery is performed for the nodes
+  used in the mapping. Instead of visiting all nodes, the pass visits the 
+  nodes in the queue, which is seeded with the output drivers and extended 
+  by the fanins of the selected matches. The nodes are taken from the queue 
+  in the decreasing order of their IDs, which is the order of the full 
+  reverse pass, because the area recovery of a node depends on the reference 
+  counters updated by the nodes visited before. So the result is the same 
+  as in the full pass, which visits the unused nodes without changing them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Nf_ManComputeMappingEla( Nf_Man_t * p )
 {
     int fVerbose = 0;
@@ -1950,13 +2192,20 @@ void Nf_ManComputeMappingEla( Nf_Man_t * p )
     int Required;
     Nf_ManSetOutputRequireds( p, 1 );
     Nf_ManResetMatches( p, p->Iter - p->pPars->nRounds );
-    Gia_ManForEachAndReverse( p->pGia, pObj, i )
+    // seed the queue with the output drivers
+    Gia_ManForEachCo( p->pGia, pObj, i )
+        Vec_BitWriteEntry( p->vReqQue, Gia_ObjFaninId0p(p->pGia, pObj), 1 );
+    for ( i = Nf_ManReqQuePop(p, Gia_ManObjNum(p->pGia)-1); i > 0; i = Nf_ManReqQuePop(p, i-1) )
     {
+        pObj = Gia_ManObj( p->pGia, i );
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
         if ( Gia_ObjIsBuf(pObj) )
         {
             if ( Nf_ObjMapRefNum(p, i, 1) )
                 Nf_ObjUpdateRequired( p, i, 0, Nf_ObjRequired(p, i, 1) - p->InvDelayI );
             Nf_ObjUpdateRequired( p, Gia_ObjFaninId0(pObj, i), Gia_ObjFaninC0(pObj), Nf_ObjRequired(p, i, 0) );
+            Vec_BitWriteEntry( p->vReqQue, Gia_ObjFaninId0(pObj, i), 1 );
             continue;
         }
         for ( c = 0; c < 2; c++ )
@@ -1991,6 +2240,11 @@ void Nf_ManComputeMappingEla( Nf_Man_t * p )
             assert( pMb->D <= Required );
             //assert( Scl_Flt2Int(pMb->F) == (int)AreaAft );
             //assert( AreaBef >= AreaAft );
+            if ( !Nf_ManMatchIsSame(pM, pMb) )
+            {
+                Vec_IntPush( &p->vChanged, i );
+                Nf_ManMapFanAdd( p, i, pMb );
+            }
             *pM = *pMb;
             // update timing
             pCell = Nf_ManCell( p, pMb->Gate );
@@ -2000,6 +2254,7 @@ void Nf_ManComputeMappingEla( Nf_Man_t * p )
                 pM = Nf_ObjMatchBest( p, iVar, fCompl );
                 assert( pM->D <= Required - pCell->iDelays[k] );
                 Nf_ObjUpdateRequired( p, iVar, fCompl, Required - pCell->iDelays[k] );
+                Vec_BitWriteEntry( p->vReqQue, iVar, 1 );
                 if ( pM->fCompl )
                 {
                     pM = Nf_ObjMatchBest( p, iVar, !fCompl );
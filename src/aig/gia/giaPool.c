@@ -0,0 +1,334 @@
+/**CFile****************************************************************
+
+  FileName    [giaPool.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Pool of distinguishing CI patterns shared by the engines.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: giaPool.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_POOL_PAGE  (1 << 10)  // the number of patterns in one page
+#define GIA_POOL_PAGES (1 << 12)  // the largest number of pages
+
+// The pool is append-only and the pages never move, so the patterns
+// below the published count can be read without locking, while the
+// additions (and reference counting) are serialized by the mutex.
+#if defined(__GNUC__)
+#define GIA_POOL_LOAD(p)        __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define GIA_POOL_STORE(p, v)    __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#define GIA_POOL_CAS(p, o, n)   __sync_bool_compare_and_swap(p, o, n)
+#else
+#define GIA_POOL_LOAD(p)        (*(p))
+#define GIA_POOL_STORE(p, v)    (*(p) = (v))
+#define GIA_POOL_CAS(p, o, n)   (*(p) == (o) ? (*(p) = (n), 1) : 0)
+#endif
+
+struct Gia_Pool_t_
+{
+    int              nCis;        // the number of CIs
+    int              nWords;      // the number of words in one pattern
+    int              nRefs;       // the number of managers sharing the pool
+    volatile int     nPats;       // the number of published patterns
+    word *           pPages[GIA_POOL_PAGES]; // pages with the patterns
+    Vec_Int_t *      vTable;      // hash table (pattern number + 1)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;       // serializes the updates
+#endif
+};
+
+static inline word * Gia_PoolPat( Gia_Pool_t * p, int i ) { return p->pPages[i / GIA_POOL_PAGE] + (i % GIA_POOL_PAGE) * p->nWords; }
+
+static inline void   Gia_PoolLock( Gia_Pool_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+#endif
+}
+static inline void   Gia_PoolUnlock( Gia_Pool_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts, references, and dereferences the pool.]
+
+  Description [The pool is deleted when the last reference is removed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Pool_t * Gia_PoolStart( int nCis )
+{
+    Gia_Pool_t * p = ABC_CALLOC( Gia_Pool_t, 1 );
+    p->nCis   = nCis;
+    p->nWords = Abc_MaxInt( 1, Abc_Bit6WordNum(nCis) );
+    p->nRefs  = 1;
+    p->vTable = Vec_IntStart( 1 << 10 );
+#ifdef ABC_USE_PTHREADS
+    {
+        int status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    }
+#endif
+    return p;
+}
+Gia_Pool_t * Gia_PoolRef( Gia_Pool_t * p )
+{
+    Gia_PoolLock( p );
+    p->nRefs++;
+    Gia_PoolUnlock( p );
+    return p;
+}
+void Gia_PoolStop( Gia_Pool_t * p )
+{
+    int i, nRefs;
+    Gia_PoolLock( p );
+    nRefs = --p->nRefs;
+    Gia_PoolUnlock( p );
+    if ( nRefs > 0 )
+        return;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    for ( i = 0; i < GIA_POOL_PAGES && p->pPages[i]; i++ )
+        ABC_FREE( p->pPages[i] );
+    Vec_IntFree( p->vTable );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the parameters and the published patterns.]
+
+  Description [The pattern stores the value of the i-th CI in the i-th bit.
+  The patterns below the returned count never change.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_PoolCiNum( Gia_Pool_t * p )
+{
+    return p->nCis;
+}
+int Gia_PoolPatNum( Gia_Pool_t * p )
+{
+    return GIA_POOL_LOAD( &p->nPats );
+}
+word * Gia_PoolReadPat( Gia_Pool_t * p, int i )
+{
+    assert( i >= 0 && i < GIA_POOL_LOAD(&p->nPats) );
+    return Gia_PoolPat( p, i );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the pattern to the pool.]
+
+  Description [Returns 1 if the pattern is new; 0 if it is already in the
+  pool or the pool is full.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_PoolHash( word * pPat, int nWords )
+{
+    word Key = 0;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        Key = (Key ^ pPat[w]) * ABC_CONST(0x9E3779B97F4A7C15);
+    return (int)(Key >> 32);
+}
+static inline int * Gia_PoolLookup( Gia_Pool_t * p, word * pPat )
+{
+    int Mask = Vec_IntSize(p->vTable) - 1;
+    int i = Gia_PoolHash( pPat, p->nWords ) & Mask;
+    for ( ; Vec_IntEntry(p->vTable, i); i = (i + 1) & Mask )
+        if ( !memcmp( Gia_PoolPat(p, Vec_IntEntry(p->vTable, i) - 1), pPat, sizeof(word) * p->nWords ) )
+            break;
+    return Vec_IntEntryP( p->vTable, i );
+}
+static inline void Gia_PoolResize( Gia_Pool_t * p )
+{
+    int i;
+    Vec_IntFill( p->vTable, 2 * Vec_IntSize(p->vTable), 0 );
+    for ( i = 0; i < p->nPats; i++ )
+        *Gia_PoolLookup( p, Gia_PoolPat(p, i) ) = i + 1;
+}
+int Gia_PoolAddPat( Gia_Pool_t * p, word * pPat )
+{
+    int * pPlace, RetValue = 0;
+    // clean the bits after the last CI
+    if ( p->nCis % 64 )
+        pPat[p->nWords-1] &= Abc_Tt6Mask( p->nCis % 64 );
+    Gia_PoolLock( p );
+    if ( p->nPats == GIA_POOL_PAGE * GIA_POOL_PAGES )
+        goto finish;
+    pPlace = Gia_PoolLookup( p, pPat );
+    if ( *pPlace )
+        goto finish;
+    if ( p->nPats % GIA_POOL_PAGE == 0 )
+        p->pPages[p->nPats / GIA_POOL_PAGE] = ABC_ALLOC( word, GIA_POOL_PAGE * p->nWords );
+    memcpy( Gia_PoolPat(p, p->nPats), pPat, sizeof(word) * p->nWords );
+    *pPlace = p->nPats + 1;
+    // publish the pattern after it is written
+    GIA_POOL_STORE( &p->nPats, p->nPats + 1 );
+    if ( 2 * p->nPats > Vec_IntSize(p->vTable) )
+        Gia_PoolResize( p );
+    RetValue = 1;
+finish:
+    Gia_PoolUnlock( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the pattern given as CI literals or CI values.]
+
+  Description [The CIs not assigned by the literals are set to 0. The CI
+  values are 0 or 1, while any other value is treated as 0.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_PoolAddLits( Gia_Pool_t * p, int * pLits, int nLits )
+{
+    word * pPat = ABC_CALLOC( word, p->nWords );
+    int i, RetValue;
+    for ( i = 0; i < nLits; i++ )
+    {
+        assert( Abc_Lit2Var(pLits[i]) < p->nCis );
+        if ( !Abc_LitIsCompl(pLits[i]) )
+            Abc_TtSetBit( pPat, Abc_Lit2Var(pLits[i]) );
+    }
+    RetValue = Gia_PoolAddPat( p, pPat );
+    ABC_FREE( pPat );
+    return RetValue;
+}
+int Gia_PoolAddValues( Gia_Pool_t * p, Vec_Int_t * vValues )
+{
+    word * pPat = ABC_CALLOC( word, p->nWords );
+    int i, Value, RetValue;
+    assert( Vec_IntSize(vValues) == p->nCis );
+    Vec_IntForEachEntry( vValues, Value, i )
+        if ( Value == 1 )
+            Abc_TtSetBit( pPat, i );
+    RetValue = Gia_PoolAddPat( p, pPat );
+    ABC_FREE( pPat );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the patterns into the simulation info of the CIs.]
+
+  Description [The simulation info contains nWords 32-bit words for each
+  CI. The patterns starting from iPat are written into the consecutive
+  bits. Returns the number of patterns written; the remaining bits are
+  not changed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_PoolLoadSimInfo( Gia_Pool_t * p, int iPat, Vec_Ptr_t * vCiInfo, int nWords )
+{
+    unsigned * pInfo;
+    word * pPat;
+    int i, k, nPats = Abc_MinInt( 32 * nWords, Gia_PoolPatNum(p) - iPat );
+    assert( Vec_PtrSize(vCiInfo) == p->nCis );
+    for ( k = 0; k < nPats; k++ )
+    {
+        pPat = Gia_PoolPat( p, iPat + k );
+        Vec_PtrForEachEntry( unsigned *, vCiInfo, pInfo, i )
+            if ( Abc_TtGetBit(pPat, i) != Abc_InfoHasBit(pInfo, k) )
+                Abc_InfoXorBit( pInfo, k );
+    }
+    return Abc_MaxInt( nPats, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the pool of the manager, creating it if needed.]
+
+  Description [The pool may be requested by several threads at once, so 
+  it is installed by compare-and-swap and the losing copy is deleted.
+  The second procedure makes the new manager share the pool of the old 
+  one, if the new manager has the same CIs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Pool_t * Gia_ManPool( Gia_Man_t * p )
+{
+    Gia_Pool_t * pPool = GIA_POOL_LOAD( &p->pPool );
+    if ( pPool == NULL )
+    {
+        pPool = Gia_PoolStart( Gia_ManCiNum(p) );
+        if ( !GIA_POOL_CAS( &p->pPool, (Gia_Pool_t *)NULL, pPool ) )
+        {
+            Gia_PoolStop( pPool );
+            pPool = GIA_POOL_LOAD( &p->pPool );
+        }
+    }
+    assert( Gia_PoolCiNum(pPool) == Gia_ManCiNum(p) );
+    return pPool;
+}
+void Gia_ManPoolShare( Gia_Man_t * pNew, Gia_Man_t * p )
+{
+    if ( pNew == p || pNew->pPool != NULL || Gia_ManCiNum(pNew) != Gia_ManCiNum(p) )
+        return;
+    pNew->pPool = Gia_PoolRef( Gia_ManPool(p) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
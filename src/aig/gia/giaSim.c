@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -35,6 +36,9 @@ unsigned * Gia_SimDataExt( Gia_ManSim_t * p, int i )    { return Gia_SimData(p,
 unsigned * Gia_SimDataCiExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCi(p, i);  }
 unsigned * Gia_SimDataCoExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCo(p, i);  }
 
+// the dispatched vector kernels work on 64-bit words (the info of each object is 8-byte aligned when nWords is even)
+static inline int Gia_SimUseSimd( Gia_ManSim_t * p ) { return (p->nWords & 1) == 0 && p->nWords >= 2 * ABC_SIMD_WORDS_MIN; }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -169,6 +173,7 @@ void Gia_ManSimSetDefaultParams( Gia_ParSim_t * p )
     p->nIters       =  32;    // the number of timeframes
     p->RandSeed     =   0;    // the seed to generate random numbers
     p->TimeLimit    =  60;    // time limit in seconds
+    p->nMemLimit    =   0;    // memory limit for simulation info in MB
     p->fCheckMiter  =   0;    // check if miter outputs are non-zero 
     p->fVerbose     =   0;    // enables verbose output
     p->iOutFail     =  -1;    // index of the failed output
@@ -220,6 +225,21 @@ Gia_ManSim_t * Gia_ManSimCreate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     p->pAig   = Gia_ManFront( pAig );
     p->pPars  = pPars;
     p->nWords = pPars->nWords;
+    // if the simulation info does not fit, the patterns are streamed in batches
+    if ( pPars->nMemLimit )
+    {
+        int nUnits = p->pAig->nFront + Gia_ManCiNum(p->pAig) + Gia_ManCoNum(p->pAig);
+        word nWordsMax = ((word)pPars->nMemLimit << 20) / (4 * nUnits);
+        if ( nWordsMax == 0 )
+        {
+            Abc_Print( 1, "Memory limit %d MB is below %.2f MB needed to simulate one word of patterns.\n", 
+                pPars->nMemLimit, 4.0 * nUnits / (1<<20) );
+            Gia_ManSimDelete( p );
+            return NULL;
+        }
+        if ( nWordsMax < (word)p->nWords )
+            p->nWords = nWordsMax > 1 ? (int)nWordsMax & ~1 : 1;
+    }
     p->pDataSim = ABC_ALLOC( unsigned, p->nWords * p->pAig->nFront );
     p->pDataSimCis = ABC_ALLOC( unsigned, p->nWords * Gia_ManCiNum(p->pAig) );
     p->pDataSimCos = ABC_ALLOC( unsigned, p->nWords * Gia_ManCoNum(p->pAig) );
@@ -238,6 +258,8 @@ Gia_ManSim_t * Gia_ManSimCreate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
         12.0*Gia_ManObjNum(p->pAig)/(1<<20), 
         4.0*p->nWords*p->pAig->nFront/(1<<20), 
         4.0*p->nWords*(Gia_ManCiNum(p->pAig) + Gia_ManCoNum(p->pAig))/(1<<20) );
+    if ( pPars->fVerbose && p->nWords < pPars->nWords )
+    Abc_Print( 1, "Streaming %d words of patterns in batches of %d words.\n", pPars->nWords, p->nWords );
 
     return p;
 }
@@ -350,8 +372,11 @@ static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iC
     unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
     unsigned * pInfo0 = Gia_SimDataCi( p, iCi );
     int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = pInfo0[w];
+    if ( Gia_SimUseSimd(p) )
+        Abc_SimdDup( (word *)pInfo, (word *)pInfo0, p->nWords / 2, 0 );
+    else
+        for ( w = p->nWords-1; w >= 0; w-- )
+            pInfo[w] = pInfo0[w];
 }
 
 /**Function*************************************************************
@@ -370,7 +395,9 @@ static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pOb
     unsigned * pInfo  = Gia_SimDataCo( p, iCo );
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
     int w;
-    if ( Gia_ObjFaninC0(pObj) )
+    if ( Gia_SimUseSimd(p) )
+        Abc_SimdDup( (word *)pInfo, (word *)pInfo0, p->nWords / 2, Gia_ObjFaninC0(pObj) );
+    else if ( Gia_ObjFaninC0(pObj) )
         for ( w = p->nWords-1; w >= 0; w-- )
             pInfo[w] = ~pInfo0[w];
     else 
@@ -395,7 +422,9 @@ static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
     unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
     unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
     int w;
-    if ( Gia_ObjFaninC0(pObj) )
+    if ( Gia_SimUseSimd(p) )
+        Abc_SimdAnd( (word *)pInfo, (word *)pInfo0, (word *)pInfo1, p->nWords / 2, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj) );
+    else if ( Gia_ObjFaninC0(pObj) )
     {
         if (  Gia_ObjFaninC1(pObj) )
             for ( w = p->nWords-1; w >= 0; w-- )
@@ -584,6 +613,25 @@ void Gia_ManResetRandom( Gia_ParSim_t * pPars )
         Gia_ManRandom( 0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Skips random numbers used by the given number of batches.]
+
+  Description [Each completed batch draws nWords words for every
+  primary input in every timeframe.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManSimSkipBatches( Gia_ManSim_t * p, int nBatches, int nWords )
+{
+    word i, nSkip = (word)nBatches * p->pPars->nIters * Gia_ManPiNum(p->pAig) * nWords;
+    for ( i = 0; i < nSkip; i++ )
+        Gia_ManRandom( 0 );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -600,55 +648,75 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     extern int Gia_ManSimSimulateEquiv( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
     Gia_ManSim_t * p;
     abctime clkTotal = Abc_Clock();
-    int i, iOut, iPat, RetValue = 0;
+    int b, i = 0, iOut, iPat, nBatches, nWordsBatch, nWordsDone = 0, fTimeout = 0, RetValue = 0;
     abctime nTimeToStop = pPars->TimeLimit ? pPars->TimeLimit * CLOCKS_PER_SEC + Abc_Clock(): 0;
     if ( pAig->pReprs && pAig->pNexts )
         return Gia_ManSimSimulateEquiv( pAig, pPars );
     ABC_FREE( pAig->pCexSeq );
     p = Gia_ManSimCreate( pAig, pPars );
+    if ( p == NULL )
+        return 0;
+    nWordsBatch = p->nWords;
+    nBatches = (pPars->nWords + nWordsBatch - 1) / nWordsBatch;
     Gia_ManResetRandom( pPars );
-    Gia_ManSimInfoInit( p );
-    for ( i = 0; i < pPars->nIters; i++ )
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Simulating with %s kernels.\n", Gia_SimUseSimd(p) ? Abc_SimdLevelName(Abc_SimdLevel()) : "scalar" );
+    for ( b = 0; b < nBatches && !RetValue && !fTimeout; b++ )
     {
-        Gia_ManSimulateRound( p );
-        if ( pPars->fVerbose )
+        // the last batch simulates only the remaining words
+        p->nWords = Abc_MinInt( nWordsBatch, pPars->nWords - b * nWordsBatch );
+        Gia_ManSimInfoInit( p );
+        for ( i = 0; i < pPars->nIters; i++ )
         {
-            Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", i+1, pPars->nIters, pPars->TimeLimit );
-            Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_Clock()-clkTotal)/CLOCKS_PER_SEC );
-        }
-        if ( pPars->fCheckMiter && Gia_ManCheckPos( p, &iOut, &iPat ) )
-        {
-            Gia_ManResetRandom( pPars );
-            pPars->iOutFail = iOut;
-            pAig->pCexSeq = Gia_ManGenerateCounter( pAig, i, iOut, p->nWords, iPat, p->vCis2Ids );
-            Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", iOut, pAig->pName, i );
-            if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
+            Gia_ManSimulateRound( p );
+            if ( pPars->fVerbose )
             {
-//                Abc_Print( 1, "\n" );
-                Abc_Print( 1, "\nGenerated counter-example is INVALID.                    " );
-//                Abc_Print( 1, "\n" );
+                if ( nBatches > 1 )
+                Abc_Print( 1, "Batch %4d out of %4d. ", b+1, nBatches );
+                Abc_Print( 1, "Frame %4d out of %4d and timeout %3d sec. ", i+1, pPars->nIters, pPars->TimeLimit );
+                Abc_Print( 1, "Time = %7.2f sec\r", (1.0*Abc_Clock()-clkTotal)/CLOCKS_PER_SEC );
             }
-            else
+            if ( pPars->fCheckMiter && Gia_ManCheckPos( p, &iOut, &iPat ) )
             {
-//                Abc_Print( 1, "\n" );
-//                if ( pPars->fVerbose )
-//                Abc_Print( 1, "\nGenerated counter-example is verified correctly.         " );
-//                Abc_Print( 1, "\n" );
+                Gia_ManResetRandom( pPars );
+                Gia_ManSimSkipBatches( p, b, nWordsBatch );
+                pPars->iOutFail = iOut;
+                pAig->pCexSeq = Gia_ManGenerateCounter( pAig, i, iOut, p->nWords, iPat, p->vCis2Ids );
+                Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", iOut, pAig->pName, i );
+                if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
+                {
+//                    Abc_Print( 1, "\n" );
+                    Abc_Print( 1, "\nGenerated counter-example is INVALID.                    " );
+//                    Abc_Print( 1, "\n" );
+                }
+                else
+                {
+//                    Abc_Print( 1, "\n" );
+//                    if ( pPars->fVerbose )
+//                    Abc_Print( 1, "\nGenerated counter-example is verified correctly.         " );
+//                    Abc_Print( 1, "\n" );
+                }
+                RetValue = 1;
+                break;
             }
-            RetValue = 1;
-            break;
-        }
-        if ( Abc_Clock() > nTimeToStop )
-        {
-            i++;
-            break;
+            if ( Abc_Clock() > nTimeToStop )
+            {
+                fTimeout = 1;
+                i++;
+                break;
+            }
+            if ( i < pPars->nIters - 1 )
+                Gia_ManSimInfoTransfer( p );
         }
-        if ( i < pPars->nIters - 1 )
-            Gia_ManSimInfoTransfer( p );
+        if ( !fTimeout )
+            nWordsDone += p->nWords;
     }
-    Gia_ManSimDelete( p );
-    if ( pAig->pCexSeq == NULL )
+    if ( pAig->pCexSeq == NULL && nBatches == 1 )
         Abc_Print( 1, "No bug detected after simulating %d frames with %d words.  ", i, pPars->nWords );
+    else if ( pAig->pCexSeq == NULL )
+        Abc_Print( 1, "No bug detected after simulating %d frames with %d words in %d batches.  ", 
+            pPars->nIters, nWordsDone, b - fTimeout );
+    Gia_ManSimDelete( p );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
     return RetValue;
 }
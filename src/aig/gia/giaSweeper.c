@@ -855,6 +855,8 @@ p->timeSatUnsat += Abc_Clock() - clk;
     else if ( RetValue1 == l_True )
     {
         p->vCexUser = Gia_ManGetCex( p->pGia, p->vId2Lit, p->pSat, p->vCexSwp );
+        if ( Gia_ManRegNum(pGia) == 0 )
+            Gia_PoolAddValues( Gia_ManPool(pGia), p->vCexUser );
 p->timeSatSat += Abc_Clock() - clk;
         p->nSatCallsSat++;
         return 0;
@@ -895,6 +897,8 @@ p->timeSatUnsat += Abc_Clock() - clk;
     else if ( RetValue1 == l_True )
     {
         p->vCexUser = Gia_ManGetCex( p->pGia, p->vId2Lit, p->pSat, p->vCexSwp );
+        if ( Gia_ManRegNum(pGia) == 0 )
+            Gia_PoolAddValues( Gia_ManPool(pGia), p->vCexUser );
 p->timeSatSat += Abc_Clock() - clk;
         p->nSatCallsSat++;
         return 0;
@@ -1031,6 +1035,7 @@ Gia_Man_t * Gia_SweeperSweep( Gia_Man_t * p, Vec_Int_t * vProbeOuts, int nWords,
     pGiaCond = Gia_SweeperExtractUserLogic( p, vProbeConds, NULL, NULL );
     pGiaOuts = Gia_SweeperExtractUserLogic( p, vProbeOuts, NULL, NULL );
     Gia_ManSetPhase( pGiaOuts );
+    Gia_ManPoolShare( pGiaOuts, p );
     // if there is no conditions, define constant true constraint (constant 0 output)
     if ( Gia_ManPoNum(pGiaCond) == 0 )
         Gia_ManAppendCo( pGiaCond, Gia_ManConst0Lit() );
@@ -369,10 +369,10 @@ static inline int Vec_IntRemoveDup( int * pArray, int nSize )
 ***********************************************************************/
 void Ivy_FastMapNodeArea2( Ivy_Man_t * pAig, Ivy_Obj_t * pObj, int nLimit )
 {
-    static int Store[32], StoreSize;
-    static char Supp0[16], Supp1[16];
-    static Ivy_Supp_t * pTemp0 = (Ivy_Supp_t *)Supp0;
-    static Ivy_Supp_t * pTemp1 = (Ivy_Supp_t *)Supp1;
+    static ABC_THREAD_LOCAL int Store[32], StoreSize;
+    static ABC_THREAD_LOCAL char Supp0[16], Supp1[16];
+    Ivy_Supp_t * pTemp0 = (Ivy_Supp_t *)Supp0;
+    Ivy_Supp_t * pTemp1 = (Ivy_Supp_t *)Supp1;
     Ivy_Obj_t * pFanin0, * pFanin1;
     Ivy_Supp_t * pSupp0, * pSupp1, * pSupp;
     int RetValue, DelayOld;
@@ -440,10 +440,10 @@ void Ivy_FastMapNodeArea2( Ivy_Man_t * pAig, Ivy_Obj_t * pObj, int nLimit )
 ***********************************************************************/
 void Ivy_FastMapNodeArea( Ivy_Man_t * pAig, Ivy_Obj_t * pObj, int nLimit )
 {
-    static int Store[32], StoreSize;
-    static char Supp0[16], Supp1[16];
-    static Ivy_Supp_t * pTemp0 = (Ivy_Supp_t *)Supp0;
-    static Ivy_Supp_t * pTemp1 = (Ivy_Supp_t *)Supp1;
+    static ABC_THREAD_LOCAL int Store[32], StoreSize;
+    static ABC_THREAD_LOCAL char Supp0[16], Supp1[16];
+    Ivy_Supp_t * pTemp0 = (Ivy_Supp_t *)Supp0;
+    Ivy_Supp_t * pTemp1 = (Ivy_Supp_t *)Supp1;
     Ivy_Obj_t * pFanin0, * pFanin1;
     Ivy_Supp_t * pSupp0, * pSupp1, * pSupp;
     int RetValue, DelayOld, RefsOld;
@@ -204,8 +204,8 @@ static int *         Ivy_FraigCreateModel( Ivy_FraigMan_t * p );
 static int Ivy_FraigNodesAreEquivBdd( Ivy_Obj_t * pObj1, Ivy_Obj_t * pObj2 );
 static int Ivy_FraigCheckCone( Ivy_FraigMan_t * pGlo, Ivy_Man_t * p, Ivy_Obj_t * pObj1, Ivy_Obj_t * pObj2, int nConfLimit );
 
-static ABC_INT64_T s_nBTLimitGlobal = 0;
-static ABC_INT64_T s_nInsLimitGlobal = 0;
+static ABC_THREAD_LOCAL ABC_INT64_T s_nBTLimitGlobal = 0;
+static ABC_THREAD_LOCAL ABC_INT64_T s_nInsLimitGlobal = 0;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -2771,7 +2771,7 @@ DdNode * Ivy_FraigNodesAreEquivBdd_int( DdManager * dd, DdNode * bFunc, Vec_Ptr_
 ***********************************************************************/
 int Ivy_FraigNodesAreEquivBdd( Ivy_Obj_t * pObj1, Ivy_Obj_t * pObj2 )
 {
-    static DdManager * dd = NULL;
+    static ABC_THREAD_LOCAL DdManager * dd = NULL;
     DdNode * bFunc, * bTemp;
     Vec_Ptr_t * vFront;
     Ivy_Obj_t * pObj;
@@ -2089,7 +2089,7 @@ void Abc_NtkPrint256()
 }
 
 
-static     int * pSupps;
+static ABC_THREAD_LOCAL    int * pSupps;
 
 /**Function*************************************************************
 
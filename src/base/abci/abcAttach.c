@@ -39,8 +39,8 @@ static int Abc_AttachCompare( unsigned ** puTruthGates, int nGates, unsigned * u
 static int Abc_NodeAttach( Abc_Obj_t * pNode, Mio_Gate_t ** ppGates, unsigned ** puTruthGates, int nGates, unsigned uTruths[][2] );
 static void Abc_TruthPermute( char * pPerm, int nVars, unsigned * uTruthNode, unsigned * uTruthPerm );
 
-static char ** s_pPerms = NULL;
-static int s_nPerms;
+static ABC_THREAD_LOCAL char ** s_pPerms = NULL;
+static ABC_THREAD_LOCAL int s_nPerms;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
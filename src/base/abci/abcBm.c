@@ -870,7 +870,7 @@ void Abc_NtkVerifyReportError( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int * pMode
 
 int Abc_NtkMiterSatBm( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int fVerbose, ABC_INT64_T * pNumConfs, ABC_INT64_T * pNumInspects)
 {
-    static sat_solver * pSat = NULL;
+    static ABC_THREAD_LOCAL sat_solver * pSat = NULL;
     lbool   status;
     int RetValue = 0;
     abctime clk;	
@@ -1188,12 +1188,12 @@ int matchNonSingletonOutputs(Abc_Ntk_t * pNtk1, Vec_Ptr_t ** nodesInLevel1, Vec_
 							  Abc_Ntk_t * subNtk1, Abc_Ntk_t * subNtk2, Vec_Ptr_t * oMatchPairs,
 							  Vec_Int_t * oNonSingleton, int oI, int idx, int ii, int iidx)
 {		
-	static int MATCH_FOUND;
+	static ABC_THREAD_LOCAL int MATCH_FOUND;
 	int i;
 	int j, temp;
 	Vec_Int_t * mismatch;		
 	int * skipList;	
-	static int counter = 0;
+	static ABC_THREAD_LOCAL int counter = 0;
 
 	MATCH_FOUND = FALSE;
 	
@@ -1332,14 +1332,14 @@ int match1by1(Abc_Ntk_t * pNtk1, Vec_Ptr_t ** nodesInLevel1, Vec_Int_t ** iMatch
 			   Abc_Ntk_t * pNtk2, Vec_Ptr_t ** nodesInLevel2, Vec_Int_t ** iMatch2, Vec_Int_t ** iDep2, Vec_Int_t * matchedInputs2, int * iGroup2, Vec_Int_t ** oMatch2, int * oGroup2,
 			   Vec_Int_t * matchedOutputs1, Vec_Int_t * matchedOutputs2, Vec_Int_t * oMatchedGroups, Vec_Int_t * iNonSingleton, int ii, int idx)
 {
-	static int MATCH_FOUND = FALSE;
+	static ABC_THREAD_LOCAL int MATCH_FOUND = FALSE;
 	Abc_Ntk_t * subNtk1, * subNtk2;
 	Vec_Int_t * oNonSingleton;	
 	Vec_Ptr_t * oMatchPairs;
 	int * skipList;
 	int j, m;	
 	int i;		
-	static int counter = 0;
+	static ABC_THREAD_LOCAL int counter = 0;
 
 	MATCH_FOUND = FALSE;
 
@@ -352,7 +352,7 @@ struct Ses_Store_t_
     abctime            timeTotal;                      /* all runtime */
 };
 
-static Ses_Store_t * s_pSesStore = NULL;
+static ABC_THREAD_LOCAL Ses_Store_t * s_pSesStore = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -53,7 +53,7 @@ struct Abc_ManScl_t_
     unsigned **        uCofs;       // truth tables of the cofactors
 };
 
-static Vec_Ptr_t * s_pLeaves = NULL;
+static ABC_THREAD_LOCAL Vec_Ptr_t * s_pLeaves = NULL;
 
 static Cut_Man_t * Abc_NtkStartCutManForScl( Abc_Ntk_t * pNtk, int nLutSize );
 static Abc_ManScl_t * Abc_ManSclStart( int nLutSize, int nCutSizeMax, int nNodesMax );
@@ -248,7 +248,7 @@ void Abc_NodeLutMap( Cut_Man_t * pManCuts, Abc_Obj_t * pObj )
 ***********************************************************************/
 Cut_Man_t * Abc_NtkStartCutManForScl( Abc_Ntk_t * pNtk, int nLutSize )
 {
-    static Cut_Params_t Params, * pParams = &Params;
+    static ABC_THREAD_LOCAL Cut_Params_t Params; Cut_Params_t * pParams = &Params;
     Cut_Man_t * pManCut;
     Abc_Obj_t * pObj;
     int i;
@@ -664,8 +664,8 @@ void Abc_NodeDecomposeSort( Abc_Obj_t ** pLeaves, int nVars, int * pBSet, int nL
 ***********************************************************************/
 int Abc_NodeDecomposeStep( Abc_ManScl_t * p )
 {
-    static char pCofClasses[1<<SCL_LUT_MAX][1<<SCL_LUT_MAX];
-    static char nCofClasses[1<<SCL_LUT_MAX];
+    static ABC_THREAD_LOCAL char pCofClasses[1<<SCL_LUT_MAX][1<<SCL_LUT_MAX];
+    static ABC_THREAD_LOCAL char nCofClasses[1<<SCL_LUT_MAX];
     Abc_Ntk_t * pNtk;
     Abc_Obj_t * pObjNew, * pFanin, * pNodesNew[SCL_LUT_MAX];
     unsigned * pTruthCof, * pTruthClass, * pTruth, uPhase;
@@ -124,7 +124,7 @@ int Abc_TruthNpnCountUnique( Abc_TtStore_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-int nWords = 0; // unfortunate global variable
+ABC_THREAD_LOCAL int nWords = 0; // unfortunate global variable
 int Abc_TruthCompare( word ** p1, word ** p2 ) { return memcmp(*p1, *p2, sizeof(word) * nWords); }
 int Abc_TruthNpnCountUniqueSort( Abc_TtStore_t * p )
 {
@@ -60,7 +60,7 @@ static word Truth[8] = {
     ABC_CONST(0xFFFFFFFFFFFFFFFF)
 };
 
-static Npn_Man_t * pNpnMan = NULL;
+static ABC_THREAD_LOCAL Npn_Man_t * pNpnMan = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -79,7 +79,7 @@ static Npn_Man_t * pNpnMan = NULL;
 ***********************************************************************/
 void Npn_TruthPermute_rec( char * pStr, int mid, int end )
 {
-    static int count = 0;
+    static ABC_THREAD_LOCAL int count = 0;
     char * pTemp = Abc_UtilStrsav(pStr);
     char e;
     int i;
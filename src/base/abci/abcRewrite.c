@@ -202,7 +202,7 @@ Rwr_ManAddTimeTotal( pManRwr, Abc_Clock() - clkStart );
 ***********************************************************************/
 Cut_Man_t * Abc_NtkStartCutManForRewrite( Abc_Ntk_t * pNtk )
 {
-    static Cut_Params_t Params, * pParams = &Params;
+    static ABC_THREAD_LOCAL Cut_Params_t Params; Cut_Params_t * pParams = &Params;
     Cut_Man_t * pManCut;
     Abc_Obj_t * pObj;
     int i;
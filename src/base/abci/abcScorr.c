@@ -193,7 +193,7 @@ int Abc_NtkTestScorrWriteEquivConst( Abc_Ntk_t * pNetlist, Vec_Int_t * vId2Name,
 ***********************************************************************/
 char * Abc_NtkBmcFileName( char * pName )
 {
-    static char Buffer[1000];
+    static ABC_THREAD_LOCAL char Buffer[1000];
     char * pNameGeneric = Extra_FileNameGeneric( pName );
     sprintf( Buffer, "%s_bmc%s", pNameGeneric, pName + strlen(pNameGeneric) );
     ABC_FREE( pNameGeneric );
@@ -930,7 +930,7 @@ int Acb_NtkFindSupp1( Acb_Ntk_t * p, int Pivot, sat_solver * pSat, int nVars, in
     return Vec_IntSize(vSupp) < Acb_ObjFaninNum(p, Pivot);
 }
 
-static int StrCount = 0;
+static ABC_THREAD_LOCAL int StrCount = 0;
 
 int Acb_NtkFindSupp2( Acb_Ntk_t * p, int Pivot, sat_solver * pSat, int nVars, int nDivs, Vec_Int_t * vWin, Vec_Int_t * vSupp, int nLutSize, int fDelay )
 {
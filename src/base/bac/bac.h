@@ -479,8 +479,8 @@ static inline void Bac_BoxReplace( Bac_Ntk_t * p, int iBox, int * pArray, int nS
 
 static inline Vec_Int_t * Bac_BoxCollectRanges( Bac_Ntk_t * p, int iBox )
 {
-    static Vec_Int_t Bits, * vBits = &Bits;
-    static int pArray[10]; int i, iTerm;
+    static ABC_THREAD_LOCAL Vec_Int_t Bits; Vec_Int_t * vBits = &Bits;
+    static ABC_THREAD_LOCAL int pArray[10]; int i, iTerm;
     assert( !Bac_ObjIsBoxUser(p, iBox) );
     // initialize array
     vBits->pArray = pArray;
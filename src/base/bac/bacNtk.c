@@ -141,7 +141,7 @@ void Bac_ManSetupTypes( char ** pNames, char ** pSymbs )
 
 char * Bac_NtkGenerateName( Bac_Ntk_t * p, Bac_ObjType_t Type, Vec_Int_t * vBits )
 {
-    static char Buffer[100]; 
+    static ABC_THREAD_LOCAL char Buffer[100]; 
     char * pTemp; int i, Bits;
     char * pName = Bac_ManPrimName( p->pDesign, Type );
     char * pSymb = Bac_ManPrimSymb( p->pDesign, Type );
@@ -171,8 +171,8 @@ Bac_ObjType_t Bac_NameToType( char * pName )
 }
 Vec_Int_t * Bac_NameToRanges( char * pName )
 {
-    static Vec_Int_t Bits, * vBits = &Bits;
-    static int pArray[10];
+    static ABC_THREAD_LOCAL Vec_Int_t Bits; Vec_Int_t * vBits = &Bits;
+    static ABC_THREAD_LOCAL int pArray[10];
     char * pTemp; 
     int Num = 0, Count = 0;
     // initialize array
@@ -46,7 +46,7 @@ ABC_NAMESPACE_IMPL_START
 ***********************************************************************/
 char * Ptr_HopToType( Abc_Obj_t * pObj )
 {
-    static word uTruth, uTruths6[3] = {
+    static ABC_THREAD_LOCAL word uTruth; static word uTruths6[3] = {
         ABC_CONST(0xAAAAAAAAAAAAAAAA),
         ABC_CONST(0xCCCCCCCCCCCCCCCC),
         ABC_CONST(0xF0F0F0F0F0F0F0F0),
@@ -28,6 +28,7 @@
 #include "base/main/mainInt.h"
 #include "cmdInt.h"
 #include "misc/util/utilSignal.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -822,6 +823,14 @@ int CmdCommandSetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
             setvbuf( pAbc->Err, ( char * ) NULL, _IOLBF, 0 );
 #endif
         }
+        if ( strcmp( argv[1], "simd" ) == 0 )
+        {
+            // the level of the simulation kernels (0 = scalar, 1 = SSE2, 2 = AVX2, 3 = AVX-512)
+            int Level = strcmp( flag_value, "" ) ? atoi( flag_value ) : -1;
+            Abc_SimdSetLevel( Level );
+            if ( Level > Abc_SimdLevel() )
+                fprintf( pAbc->Err, "The CPU does not support SIMD level %d. Using %s kernels.\n", Level, Abc_SimdLevelName(Abc_SimdLevel()) );
+        }
         if ( strcmp( argv[1], "history" ) == 0 )
         {
             if ( pAbc->Hst != NULL )
@@ -890,6 +899,8 @@ int CmdCommandUnsetVariable( Abc_Frame_t * pAbc, int argc, char **argv )
             ABC_FREE( key );
             ABC_FREE( value );
         }
+        if ( strcmp( argv[i], "simd" ) == 0 )
+            Abc_SimdSetLevel( -1 );
     }
     return 0;
 
@@ -26,17 +26,7 @@
 #include "misc/extra/extra.h"
 #include "aig/gia/gia.h"
 #include "sat/satoko/satoko.h"
-
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
-#endif
-
-#endif
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -117,96 +107,56 @@ int Cmd_RunAutoTunerEval( Vec_Ptr_t * vAigs, satoko_opts_t * pOpts, int nCores )
 #else // pthreads are used
 
 
-#define CMD_THR_MAX 100
 typedef struct Cmd_AutoData_t_
 {
     Gia_Man_t *     pGia;
     satoko_opts_t * pOpts;
-    int             iThread;
-    int             nTimeOut;
-    int             fWorking;
-    int             Result;
 } Cmd_AutoData_t;
 
-void * Cmd_RunAutoTunerEvalWorkerThread( void * pArg )
+int Cmd_RunAutoTunerEvalTask( void * pArg )
 {
-    Cmd_AutoData_t * pThData = (Cmd_AutoData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->pGia == NULL ) // kills itself when there is nothing to do
-        {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        pThData->Result = Gia_ManSatokoCallOne( pThData->pGia, pThData->pOpts, -1 );
-        pThData->fWorking = 0;
-    }
-	assert( 0 );
-	return NULL;
+    Cmd_AutoData_t * pData = (Cmd_AutoData_t *)pArg;
+    return Gia_ManSatokoCallOne( pData->pGia, pData->pOpts, -1 );
 }
 int Cmd_RunAutoTunerEval( Vec_Ptr_t * vAigs, satoko_opts_t * pOpts, int nProcs )
 {
-    Cmd_AutoData_t ThData[CMD_THR_MAX];
-	pthread_t WorkerThread[CMD_THR_MAX];
-    int i, status, fWorkToDo = 1, TotalCost = 0;
+    Util_Pool_t * pPool;
+    Util_Task_t ** ppTasks;
+    Cmd_AutoData_t * pData;
     Vec_Ptr_t * vStack;
+    int i, Result, TotalCost = 0;
     if ( nProcs == 1 )
         return Cmd_RunAutoTunerEvalSimple( vAigs, pOpts );
     // subtract manager thread
     nProcs--;
-    assert( nProcs >= 1 && nProcs <= CMD_THR_MAX );
-    // start threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].pGia     = NULL;
-        ThData[i].pOpts    = pOpts;
-        ThData[i].iThread  = i;
-        ThData[i].nTimeOut = -1;
-        ThData[i].fWorking = 0;
-        ThData[i].Result   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cmd_RunAutoTunerEvalWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
-    }
-    // look at the threads
+    assert( nProcs >= 1 );
+    pPool   = Util_PoolGlobal( nProcs );
+    ppTasks = ABC_CALLOC( Util_Task_t *, nProcs );
+    pData   = ABC_CALLOC( Cmd_AutoData_t, nProcs );
+    // keep at most nProcs AIGs in the pool
     vStack = Vec_PtrDup(vAigs);
-    while ( fWorkToDo )
+    while ( 1 )
     {
-        fWorkToDo = (int)(Vec_PtrSize(vStack) > 0);
-        for ( i = 0; i < nProcs; i++ )
+        for ( i = 0; i < nProcs && Vec_PtrSize(vStack) > 0; i++ )
         {
-            // check if this thread is working
-            if ( ThData[i].fWorking )
-            {
-                fWorkToDo = 1;
+            if ( ppTasks[i] != NULL )
                 continue;
-            }
-            // check if this thread has recently finished
-            if ( ThData[i].pGia != NULL )
-            {
-                assert( ThData[i].Result >= 0 );
-                TotalCost += ThData[i].Result;
-                ThData[i].pGia = NULL;
-            }
-            if ( Vec_PtrSize(vStack) == 0 )
-                continue;
-            // give this thread a new job
-            assert( ThData[i].pGia == NULL );
-            ThData[i].pGia = (Gia_Man_t *)Vec_PtrPop( vStack );
-            ThData[i].fWorking = 1;
+            pData[i].pGia  = (Gia_Man_t *)Vec_PtrPop( vStack );
+            pData[i].pOpts = pOpts;
+            ppTasks[i] = Util_PoolSubmit( pPool, Cmd_RunAutoTunerEvalTask, pData + i );
         }
+        i = Util_TaskWaitAny( ppTasks, nProcs );
+        if ( i == -1 )
+            break;
+        Result = Util_TaskWait( ppTasks[i] );
+        assert( Result >= 0 );
+        TotalCost += Result;
+        Util_TaskFree( ppTasks[i] );
+        ppTasks[i] = NULL;
     }
     Vec_PtrFree( vStack );
-    // stop threads
-    for ( i = 0; i < nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        // stop
-        ThData[i].pGia = NULL;
-        ThData[i].fWorking = 1;
-    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( pData );
     return TotalCost;
 }
 
@@ -141,7 +141,7 @@ static unsigned char GroupLiterals[163][4] = {
 #define FULL16BITS  0x10000
 #define MARKNUMBER  200
 
-static unsigned char BitGroupNumbers[FULL16BITS];
+static ABC_THREAD_LOCAL unsigned char BitGroupNumbers[FULL16BITS];
 unsigned char BitCount[FULL16BITS];
 
 ////////////////////////////////////////////////////////////////////////
@@ -213,10 +213,10 @@ void ExorVar( Cube * pC, int Var, varvalue Val )
 ///                      FUNCTION DEFINITIONS                        ///
 ////////////////////////////////////////////////////////////////////////
 
-static int DiffVarCounter, cVars;
-static drow Temp1, Temp2, Temp;
-static drow LastNonZeroWord;
-static int LastNonZeroWordNum;
+static ABC_THREAD_LOCAL int DiffVarCounter, cVars;
+static ABC_THREAD_LOCAL drow Temp1, Temp2, Temp;
+static ABC_THREAD_LOCAL drow LastNonZeroWord;
+static ABC_THREAD_LOCAL int LastNonZeroWordNum;
 
 int GetDistance( Cube * pC1, Cube * pC2 )
 // finds and returns the distance between two cubes pC1 and pC2
@@ -310,56 +310,56 @@ static drow s_BitMasks[32] =
 ////////////////////////////////////////////////////////////////////////
 
 // this flag is TRUE as long as the storage is allocated
-static int fWorking;
+static ABC_THREAD_LOCAL int fWorking;
 
 // set these flags to have minimum literal groups generated first
 static int fMinLitGroupsFirst[4] = { 0 /*dist2*/, 0 /*dist3*/, 0 /*dist4*/};
 
-static int nDist;
-static int nCubes;
-static int nCubesInGroup;
-static int nGroups;
-static Cube *pCA, *pCB;
+static ABC_THREAD_LOCAL int nDist;
+static ABC_THREAD_LOCAL int nCubes;
+static ABC_THREAD_LOCAL int nCubesInGroup;
+static ABC_THREAD_LOCAL int nGroups;
+static ABC_THREAD_LOCAL Cube *pCA, *pCB;
 
 // storage for variable numbers that are different in the cubes
-static int DiffVars[5];
-static int* pDiffVars;
-static int nDifferentVars;
+static ABC_THREAD_LOCAL int DiffVars[5];
+static ABC_THREAD_LOCAL int* pDiffVars;
+static ABC_THREAD_LOCAL int nDifferentVars;
 
 // storage for the bits and words of different input variables
-static int nDiffVarsIn;
-static int DiffVarWords[5];
-static int DiffVarBits[5];
+static ABC_THREAD_LOCAL int nDiffVarsIn;
+static ABC_THREAD_LOCAL int DiffVarWords[5];
+static ABC_THREAD_LOCAL int DiffVarBits[5];
 
 // literal mask used to count the number of literals in the cubes
-static drow MaskLiterals;
+static ABC_THREAD_LOCAL drow MaskLiterals;
 // the base for counting literals
-static int StartingLiterals;
+static ABC_THREAD_LOCAL int StartingLiterals;
 // the number of literals in each cube
-static int CubeLiterals[32];
-static int BitShift;
-static int DiffVarValues[4][3];
-static int Value;
+static ABC_THREAD_LOCAL int CubeLiterals[32];
+static ABC_THREAD_LOCAL int BitShift;
+static ABC_THREAD_LOCAL int DiffVarValues[4][3];
+static ABC_THREAD_LOCAL int Value;
 
 // the sorted array of groups in the increasing order of costs
-static int GroupCosts[32];
-static int GroupCostBest;
-static int GroupCostBestNum;
+static ABC_THREAD_LOCAL int GroupCosts[32];
+static ABC_THREAD_LOCAL int GroupCostBest;
+static ABC_THREAD_LOCAL int GroupCostBestNum;
 
-static int CubeNum;
-static int NewZ;
-static drow Temp;
+static ABC_THREAD_LOCAL int CubeNum;
+static ABC_THREAD_LOCAL int NewZ;
+static ABC_THREAD_LOCAL drow Temp;
 
 // the cubes currently created
-static Cube* ELCubes[32];
+static ABC_THREAD_LOCAL Cube* ELCubes[32];
 
 // the bit string with 1's corresponding to cubes in ELCubes[] 
 // that constitute the last group
-static drow LastGroup;
+static ABC_THREAD_LOCAL drow LastGroup;
 
-static int  GroupOrder[24];
-static drow VisitedGroups;
-static int  nVisitedGroups;
+static ABC_THREAD_LOCAL int  GroupOrder[24];
+static ABC_THREAD_LOCAL drow VisitedGroups;
+static ABC_THREAD_LOCAL int  nVisitedGroups;
 
 //int RemainderBits = (nVars*2)%(sizeof(drow)*8);
 //int TotalWords    = (nVars*2)/(sizeof(drow)*8) + (RemainderBits > 0);
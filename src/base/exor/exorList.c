@@ -211,7 +211,7 @@ int s_nPosMax[3];
 ////////////////////////////////////////////////////////////////////////
 
 // Cube set is a list of cubes
-static Cube* s_List;
+static ABC_THREAD_LOCAL Cube* s_List;
 
 ///////////////////////////////////////////////////////////////////////////
 // undo information
@@ -234,34 +234,34 @@ static struct
 // enable pair accumulation
 // from the begginning (while the starting cover is generated)
 // only the distance 2 accumulation is enabled
-static int s_fDistEnable2 = 1;
-static int s_fDistEnable3;
-static int s_fDistEnable4;
+static ABC_THREAD_LOCAL int s_fDistEnable2 = 1;
+static ABC_THREAD_LOCAL int s_fDistEnable3;
+static ABC_THREAD_LOCAL int s_fDistEnable4;
 
 // temporary storage for cubes generated by the ExorLink iterator
-static Cube* s_CubeGroup[5];
+static ABC_THREAD_LOCAL Cube* s_CubeGroup[5];
 // the marks telling whether the given cube is inserted
-static int s_fInserted[5];
+static ABC_THREAD_LOCAL int s_fInserted[5];
 
 // enable selection only those Dist2 and Dist3 that do not increase literals
 int s_fDecreaseLiterals = 0;
 
 // the counters for display
-static int s_cEnquequed;
-static int s_cAttempts;
-static int s_cReshapes;
+static ABC_THREAD_LOCAL int s_cEnquequed;
+static ABC_THREAD_LOCAL int s_cAttempts;
+static ABC_THREAD_LOCAL int s_cReshapes;
 
 // the number of cubes before ExorLink starts
-static int s_nCubesBefore;
+static ABC_THREAD_LOCAL int s_nCubesBefore;
 // the distance code specific for each ExorLink
-static cubedist s_Dist;
+static ABC_THREAD_LOCAL cubedist s_Dist;
 
 // other variables
-static int s_Gain;
-static int s_GainTotal;
-static int s_GroupCounter;
-static int s_GroupBest;
-static Cube *s_pC1, *s_pC2;
+static ABC_THREAD_LOCAL int s_Gain;
+static ABC_THREAD_LOCAL int s_GainTotal;
+static ABC_THREAD_LOCAL int s_GroupCounter;
+static ABC_THREAD_LOCAL int s_GroupBest;
+static ABC_THREAD_LOCAL Cube *s_pC1, *s_pC2;
 
 ////////////////////////////////////////////////////////////////////////
 ///                  Iterative ExorLink Operation                    ///
@@ -914,7 +914,7 @@ typedef struct
     int  fEmpty;     // this flag is 1 if there is nothing in the queque
 } que;
 
-static que s_Que[3];  // Dist-2, Dist-3, Dist-4 queques
+static ABC_THREAD_LOCAL que s_Que[3];  // Dist-2, Dist-3, Dist-4 queques
 
 // the number of allocated places
 //int s_nPosAlloc;
@@ -1017,8 +1017,8 @@ static struct
     int CutValue;    // the number of literals below which the cubes are not used
 } s_Iter;
 
-static que* pQ;
-static Cube *p1, *p2;
+static ABC_THREAD_LOCAL que* pQ;
+static ABC_THREAD_LOCAL Cube *p1, *p2;
 
 int IteratorCubePairStart( cubedist CubeDist, Cube** ppC1, Cube** ppC2 )
 // start an iterator through cubes of dist CubeDist,
@@ -37,7 +37,7 @@ typedef struct Io_MvVar_t_ Io_MvVar_t; // parsing var
 typedef struct Io_MvMod_t_ Io_MvMod_t; // parsing model
 typedef struct Io_MvMan_t_ Io_MvMan_t; // parsing manager
 
-Vec_Ptr_t *vGlobalLtlArray;
+ABC_THREAD_LOCAL Vec_Ptr_t *vGlobalLtlArray;
 
 struct Io_MvVar_t_
 {
@@ -575,7 +575,7 @@ void Io_NtkWriteSubcktFanins( FILE * pFile, Abc_Obj_t * pNode )
 ***********************************************************************/
 int Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode, int Length )
 {
-    static int fReport = 0;
+    static ABC_THREAD_LOCAL int fReport = 0;
     Mio_Gate_t * pGate = (Mio_Gate_t *)pNode->pData;
     Mio_Pin_t * pGatePin;
     Abc_Obj_t * pNode2;
@@ -802,7 +802,7 @@ void Io_WriteDotSeq( Abc_Ntk_t * pNtk, Vec_Ptr_t * vNodes, Vec_Ptr_t * vNodesSho
 ***********************************************************************/
 char * Abc_NtkPrintSop( char * pSop ) 
 {
-    static char Buffer[1000];
+    static ABC_THREAD_LOCAL char Buffer[1000];
     char * pGet, * pSet;
     pSet = Buffer;
     for ( pGet = pSop; *pGet; pGet++ )
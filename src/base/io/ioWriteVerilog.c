@@ -630,7 +630,7 @@ int Io_WriteVerilogWiresCount( Abc_Ntk_t * pNtk )
 ***********************************************************************/
 char * Io_WriteVerilogGetName( char * pName )
 {
-    static char Buffer[500];
+    static ABC_THREAD_LOCAL char Buffer[500];
     int Length, i;
     Length = strlen(pName);
     // consider the case of a signal having name "0" or "1"
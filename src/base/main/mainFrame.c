@@ -22,6 +22,7 @@
 #include "mainInt.h"
 #include "bool/dec/dec.h"
 #include "map/if/if.h"
+#include "misc/util/utilPool.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -34,7 +35,32 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Abc_Frame_t * s_GlobalFrame = NULL;
+// each thread works with its own frame; the frame is started by calling 
+// Abc_FrameStartGlobalFrame() in this thread or bound to the thread 
+// explicitly by calling Abc_FrameSetGlobalFrame()
+static ABC_THREAD_LOCAL Abc_Frame_t * s_GlobalFrame = NULL;
+
+// the first frame started in the process; Abc_FrameGetGlobalFrame() binds 
+// it to the threads that do not have a frame instead of starting a new one
+static Abc_Frame_t * volatile s_MainFrame = NULL;
+#if defined(__GNUC__)
+#define ABC_FRAME_MAIN_READ()       __atomic_load_n( &s_MainFrame, __ATOMIC_ACQUIRE )
+#define ABC_FRAME_MAIN_CAS(pOld, p) __sync_bool_compare_and_swap( &s_MainFrame, pOld, p )
+#else
+#define ABC_FRAME_MAIN_READ()       (s_MainFrame)
+#define ABC_FRAME_MAIN_CAS(pOld, p) (s_MainFrame == (pOld) ? (s_MainFrame = (p), 1) : 0)
+#endif
+
+// the number of frames currently allocated; the shared thread pool 
+// is stopped when the last frame is deallocated
+static volatile int s_nFrames = 0;
+#if defined(__GNUC__)
+#define ABC_FRAME_COUNT_INC() __sync_add_and_fetch( &s_nFrames, 1 )
+#define ABC_FRAME_COUNT_DEC() __sync_sub_and_fetch( &s_nFrames, 1 )
+#else
+#define ABC_FRAME_COUNT_INC() (++s_nFrames)
+#define ABC_FRAME_COUNT_DEC() (--s_nFrames)
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -65,38 +91,38 @@ void *      Abc_FrameReadManDd()                             { if ( s_GlobalFram
 void *      Abc_FrameReadManDec()                            { if ( s_GlobalFrame->pManDec == NULL ) s_GlobalFrame->pManDec = Dec_ManStart();                                        return s_GlobalFrame->pManDec; } 
 void *      Abc_FrameReadManDsd()                            { return s_GlobalFrame->pManDsd;      } 
 void *      Abc_FrameReadManDsd2()                           { return s_GlobalFrame->pManDsd2;     }
-char *      Abc_FrameReadFlag( char * pFlag )                { return Cmd_FlagReadByName( s_GlobalFrame, pFlag );   }
-
-int         Abc_FrameReadBmcFrames( Abc_Frame_t * p )        { return s_GlobalFrame->nFrames;      }               
-int         Abc_FrameReadProbStatus( Abc_Frame_t * p )       { return s_GlobalFrame->Status;       }               
-void *      Abc_FrameReadCex( Abc_Frame_t * p )              { return s_GlobalFrame->pCex;         }        
-Vec_Ptr_t * Abc_FrameReadCexVec( Abc_Frame_t * p )           { return s_GlobalFrame->vCexVec;      }        
-Vec_Int_t * Abc_FrameReadStatusVec( Abc_Frame_t * p )        { return s_GlobalFrame->vStatuses;    }        
-Vec_Ptr_t * Abc_FrameReadPoEquivs( Abc_Frame_t * p )         { return s_GlobalFrame->vPoEquivs;    }        
-Vec_Int_t * Abc_FrameReadPoStatuses( Abc_Frame_t * p )       { return s_GlobalFrame->vStatuses;    }        
-Vec_Int_t * Abc_FrameReadObjIds( Abc_Frame_t * p )           { return s_GlobalFrame->vAbcObjIds;   }        
-Abc_Nam_t * Abc_FrameReadJsonStrs( Abc_Frame_t * p )         { return s_GlobalFrame->pJsonStrs;    }     
-Vec_Wec_t * Abc_FrameReadJsonObjs( Abc_Frame_t * p )         { return s_GlobalFrame->vJsonObjs;    }   
+char *      Abc_FrameReadFlag( char * pFlag )                { return s_GlobalFrame ? Cmd_FlagReadByName( s_GlobalFrame, pFlag ) : NULL; }
+
+int         Abc_FrameReadBmcFrames( Abc_Frame_t * p )        { return p->nFrames;      }               
+int         Abc_FrameReadProbStatus( Abc_Frame_t * p )       { return p->Status;       }               
+void *      Abc_FrameReadCex( Abc_Frame_t * p )              { return p->pCex;         }        
+Vec_Ptr_t * Abc_FrameReadCexVec( Abc_Frame_t * p )           { return p->vCexVec;      }        
+Vec_Int_t * Abc_FrameReadStatusVec( Abc_Frame_t * p )        { return p->vStatuses;    }        
+Vec_Ptr_t * Abc_FrameReadPoEquivs( Abc_Frame_t * p )         { return p->vPoEquivs;    }        
+Vec_Int_t * Abc_FrameReadPoStatuses( Abc_Frame_t * p )       { return p->vStatuses;    }        
+Vec_Int_t * Abc_FrameReadObjIds( Abc_Frame_t * p )           { return p->vAbcObjIds;   }        
+Abc_Nam_t * Abc_FrameReadJsonStrs( Abc_Frame_t * p )         { return p->pJsonStrs;    }     
+Vec_Wec_t * Abc_FrameReadJsonObjs( Abc_Frame_t * p )         { return p->vJsonObjs;    }   
        
-int         Abc_FrameReadCexPiNum( Abc_Frame_t * p )         { return s_GlobalFrame->pCex->nPis;   }               
-int         Abc_FrameReadCexRegNum( Abc_Frame_t * p )        { return s_GlobalFrame->pCex->nRegs;  }               
-int         Abc_FrameReadCexPo( Abc_Frame_t * p )            { return s_GlobalFrame->pCex->iPo;    }               
-int         Abc_FrameReadCexFrame( Abc_Frame_t * p )         { return s_GlobalFrame->pCex->iFrame; }               
-
-void        Abc_FrameSetLibLut( void * pLib )                { s_GlobalFrame->pLibLut   = pLib;    } 
-void        Abc_FrameSetLibBox( void * pLib )                { s_GlobalFrame->pLibBox   = pLib;    } 
-void        Abc_FrameSetLibGen( void * pLib )                { s_GlobalFrame->pLibGen   = pLib;    } 
-void        Abc_FrameSetLibGen2( void * pLib )               { s_GlobalFrame->pLibGen2  = pLib;    } 
-void        Abc_FrameSetLibSuper( void * pLib )              { s_GlobalFrame->pLibSuper = pLib;    } 
-void        Abc_FrameSetFlag( char * pFlag, char * pValue )  { Cmd_FlagUpdateValue( s_GlobalFrame, pFlag, pValue );               } 
-void        Abc_FrameSetCex( Abc_Cex_t * pCex )              { ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->pCex = pCex;       }
-void        Abc_FrameSetNFrames( int nFrames )               { ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->nFrames = nFrames; }
-void        Abc_FrameSetStatus( int Status )                 { ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->Status = Status;   }
-void        Abc_FrameSetManDsd( void * pMan )                { if (s_GlobalFrame->pManDsd  && s_GlobalFrame->pManDsd  != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd,  0); s_GlobalFrame->pManDsd = pMan;  }
-void        Abc_FrameSetManDsd2( void * pMan )               { if (s_GlobalFrame->pManDsd2 && s_GlobalFrame->pManDsd2 != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd2, 0); s_GlobalFrame->pManDsd2 = pMan; }
-void        Abc_FrameSetInv( Vec_Int_t * vInv )              { Vec_IntFreeP(&s_GlobalFrame->pAbcWlcInv); s_GlobalFrame->pAbcWlcInv = vInv; }
-void        Abc_FrameSetJsonStrs( Abc_Nam_t * pStrs )        { Abc_NamDeref( s_GlobalFrame->pJsonStrs ); s_GlobalFrame->pJsonStrs = pStrs; }
-void        Abc_FrameSetJsonObjs( Vec_Wec_t * vObjs )        { Vec_WecFreeP(&s_GlobalFrame->vJsonObjs ); s_GlobalFrame->vJsonObjs = vObjs; }
+int         Abc_FrameReadCexPiNum( Abc_Frame_t * p )         { return p->pCex->nPis;   }               
+int         Abc_FrameReadCexRegNum( Abc_Frame_t * p )        { return p->pCex->nRegs;  }               
+int         Abc_FrameReadCexPo( Abc_Frame_t * p )            { return p->pCex->iPo;    }               
+int         Abc_FrameReadCexFrame( Abc_Frame_t * p )         { return p->pCex->iFrame; }               
+
+void        Abc_FrameSetLibLut( void * pLib )                { if ( s_GlobalFrame ) s_GlobalFrame->pLibLut   = pLib;    } 
+void        Abc_FrameSetLibBox( void * pLib )                { if ( s_GlobalFrame ) s_GlobalFrame->pLibBox   = pLib;    } 
+void        Abc_FrameSetLibGen( void * pLib )                { if ( s_GlobalFrame ) s_GlobalFrame->pLibGen   = pLib;    } 
+void        Abc_FrameSetLibGen2( void * pLib )               { if ( s_GlobalFrame ) s_GlobalFrame->pLibGen2  = pLib;    } 
+void        Abc_FrameSetLibSuper( void * pLib )              { if ( s_GlobalFrame ) s_GlobalFrame->pLibSuper = pLib;    } 
+void        Abc_FrameSetFlag( char * pFlag, char * pValue )  { if ( s_GlobalFrame ) Cmd_FlagUpdateValue( s_GlobalFrame, pFlag, pValue ); } 
+void        Abc_FrameSetCex( Abc_Cex_t * pCex )              { if ( s_GlobalFrame == NULL ) { ABC_FREE( pCex ); return; } ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->pCex = pCex; }
+void        Abc_FrameSetNFrames( int nFrames )               { if ( s_GlobalFrame == NULL ) return; ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->nFrames = nFrames; }
+void        Abc_FrameSetStatus( int Status )                 { if ( s_GlobalFrame == NULL ) return; ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->Status = Status;   }
+void        Abc_FrameSetManDsd( void * pMan )                { if (s_GlobalFrame == NULL) return; if (s_GlobalFrame->pManDsd  && s_GlobalFrame->pManDsd  != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd,  0); s_GlobalFrame->pManDsd = pMan;  }
+void        Abc_FrameSetManDsd2( void * pMan )               { if (s_GlobalFrame == NULL) return; if (s_GlobalFrame->pManDsd2 && s_GlobalFrame->pManDsd2 != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd2, 0); s_GlobalFrame->pManDsd2 = pMan; }
+void        Abc_FrameSetInv( Vec_Int_t * vInv )              { if ( s_GlobalFrame == NULL ) { Vec_IntFreeP(&vInv); return; } Vec_IntFreeP(&s_GlobalFrame->pAbcWlcInv); s_GlobalFrame->pAbcWlcInv = vInv; }
+void        Abc_FrameSetJsonStrs( Abc_Nam_t * pStrs )        { if ( s_GlobalFrame == NULL ) { Abc_NamDeref( pStrs ); return; } Abc_NamDeref( s_GlobalFrame->pJsonStrs ); s_GlobalFrame->pJsonStrs = pStrs; }
+void        Abc_FrameSetJsonObjs( Vec_Wec_t * vObjs )        { if ( s_GlobalFrame == NULL ) { Vec_WecFreeP(&vObjs); return; } Vec_WecFreeP(&s_GlobalFrame->vJsonObjs ); s_GlobalFrame->vJsonObjs = vObjs; }
 
 int         Abc_FrameIsBatchMode()                           { return s_GlobalFrame ? s_GlobalFrame->fBatchMode : 0;              } 
 
@@ -105,8 +131,8 @@ void        Abc_FrameSetBridgeMode()                         { if ( s_GlobalFram
 
 char *      Abc_FrameReadDrivingCell()                       { return s_GlobalFrame->pDrivingCell;    }              
 float       Abc_FrameReadMaxLoad()                           { return s_GlobalFrame->MaxLoad;         }      
-void        Abc_FrameSetDrivingCell( char * pName )          { ABC_FREE(s_GlobalFrame->pDrivingCell); s_GlobalFrame->pDrivingCell   = pName; }      
-void        Abc_FrameSetMaxLoad( float Load )                { s_GlobalFrame->MaxLoad        = Load;  }      
+void        Abc_FrameSetDrivingCell( char * pName )          { if ( s_GlobalFrame == NULL ) { ABC_FREE(pName); return; } ABC_FREE(s_GlobalFrame->pDrivingCell); s_GlobalFrame->pDrivingCell   = pName; }      
+void        Abc_FrameSetMaxLoad( float Load )                { if ( s_GlobalFrame ) s_GlobalFrame->MaxLoad        = Load;  }      
 
 /**Function*************************************************************
 
@@ -132,6 +158,28 @@ int Abc_FrameIsFlagEnabled( char * pFlag )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Passes the frame of the submitting thread to the pool tasks.]
+
+  Description [The tasks of the thread pool are executed with the frame
+  of the thread that submitted them, so that the engines running in the
+  workers can use the frame accessors.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Abc_FrameReadContext()
+{
+    return (void *)s_GlobalFrame;
+}
+static void Abc_FrameSetContext( void * pCtx )
+{
+    s_GlobalFrame = (Abc_Frame_t *)pCtx;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -170,6 +218,8 @@ Abc_Frame_t * Abc_FrameAllocate()
     // initialize the trace manager
 //    Abc_HManStart();
     p->vPlugInComBinPairs = Vec_PtrAlloc( 100 );
+    if ( ABC_FRAME_COUNT_INC() == 1 )
+        Util_PoolSetContextHooks( Abc_FrameReadContext, Abc_FrameSetContext );
     return p;
 }
 
@@ -225,16 +275,20 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     ABC_FREE( p->pCex2 );
     ABC_FREE( p->pCex );
     Vec_IntFreeP( &p->pAbcWlcInv );
-    Abc_NamDeref( s_GlobalFrame->pJsonStrs );
-    Vec_WecFreeP(&s_GlobalFrame->vJsonObjs );    
+    Abc_NamDeref( p->pJsonStrs );
+    Vec_WecFreeP(&p->vJsonObjs );    
 
     Gia_ManStopP( &p->pGiaMiniAig );
     Gia_ManStopP( &p->pGiaMiniLut );
     Vec_IntFreeP( &p->vCopyMiniAig );
     Vec_IntFreeP( &p->vCopyMiniLut );
 
+    ABC_FRAME_MAIN_CAS( p, NULL );
     ABC_FREE( p );
-    s_GlobalFrame = NULL;
+    if ( ABC_FRAME_COUNT_DEC() == 0 )
+        Util_PoolGlobalStop();
+    if ( s_GlobalFrame == p )
+        s_GlobalFrame = NULL;
 }
 
 
@@ -590,9 +644,10 @@ void Abc_FrameDeleteAllNetworks( Abc_Frame_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Makes the frame current in the calling thread.]
 
-  Description []
+  Description [The frame should be used by one thread at a time. Passing
+  NULL detaches the current frame from the thread without deleting it.]
                
   SideEffects []
 
@@ -606,9 +661,34 @@ void Abc_FrameSetGlobalFrame( Abc_Frame_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Starts a new frame and makes it current in the calling thread.]
 
-  Description []
+  Description [The first frame started in the process becomes the main 
+  frame, which is shared with the threads that do not have their own.
+  The frame is deleted by Abc_FrameEnd() and Abc_FrameDeallocate().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Frame_t * Abc_FrameStartGlobalFrame()
+{
+    // start the framework
+    s_GlobalFrame = Abc_FrameAllocate();
+    // perform initializations
+    Abc_FrameInit( s_GlobalFrame );
+    ABC_FRAME_MAIN_CAS( NULL, s_GlobalFrame );
+    return s_GlobalFrame;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the frame of the calling thread.]
+
+  Description [If the thread does not have a frame, binds the main frame 
+  to it. A new frame is started only if there is no main frame, so that 
+  the threads created outside of ABC do not leave frames behind.]
                
   SideEffects []
 
@@ -619,10 +699,9 @@ Abc_Frame_t * Abc_FrameGetGlobalFrame()
 {
 	if ( s_GlobalFrame == 0 )
 	{
-		// start the framework
-		s_GlobalFrame = Abc_FrameAllocate();
-		// perform initializations
-		Abc_FrameInit( s_GlobalFrame );
+		s_GlobalFrame = ABC_FRAME_MAIN_READ();
+		if ( s_GlobalFrame == 0 )
+			Abc_FrameStartGlobalFrame();
 	}
 	return s_GlobalFrame;
 }
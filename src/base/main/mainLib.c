@@ -42,7 +42,10 @@ ABC_NAMESPACE_IMPL_START
   For example, some error messages while parsing files will not be 
   produced, and intermediate networks will not be checked for consistancy. 
   One possibility is to load the resource file after Abc_Start() as follows:
-  Abc_UtilsSource(  Abc_FrameGetGlobalFrame() );]
+  Abc_UtilsSource(  Abc_FrameGetGlobalFrame() );
+  The frame is specific to the calling thread. Several threads can call 
+  Abc_Start(), run their own scripts using Cmd_CommandExecute(), and call 
+  Abc_Stop(), without interfering with each other.]
                
   SideEffects []
 
@@ -56,8 +59,10 @@ void Abc_Start()
 #if defined(_DEBUG) && defined(_MSC_VER) 
     _CrtSetDbgFlag( _CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF );
 #endif
-    // start the glocal frame
-    pAbc = Abc_FrameGetGlobalFrame();
+    // start the frame of this thread
+    pAbc = Abc_FrameReadGlobalFrame();
+    if ( pAbc == NULL )
+        pAbc = Abc_FrameStartGlobalFrame();
     // source the resource file
 //    Abc_UtilsSource( pAbc );
 }
@@ -66,7 +71,7 @@ void Abc_Start()
 
   Synopsis    [Deallocation procedure for the library project.]
 
-  Description []
+  Description [Deletes the frame of the calling thread.]
                
   SideEffects []
 
@@ -76,7 +81,9 @@ void Abc_Start()
 void Abc_Stop()
 {
     Abc_Frame_t * pAbc;
-    pAbc = Abc_FrameGetGlobalFrame();
+    pAbc = Abc_FrameReadGlobalFrame();
+    if ( pAbc == NULL )
+        return;
     // perform uninitializations
     Abc_FrameEnd( pAbc );
     // stop the framework
@@ -69,11 +69,11 @@ char * Abc_UtilsGetVersion( Abc_Frame_t * pAbc )
 ***********************************************************************/
 char * Abc_UtilsGetUsersInput( Abc_Frame_t * pAbc )
 {
-    static char Prompt[5000];
+    static ABC_THREAD_LOCAL char Prompt[5000];
     sprintf( Prompt, "abc %02d> ", pAbc->nSteps );
 #ifdef ABC_USE_READLINE
     {
-    static char * line = NULL;
+    static ABC_THREAD_LOCAL char * line = NULL;
     if (line != NULL) ABC_FREE(line);
     line = readline(Prompt);  
     if (line == NULL){ printf("***EOF***\n"); exit(0); }
@@ -254,7 +254,7 @@ void Abc_UtilsSource( Abc_Frame_t * pAbc )
 ******************************************************************************/
 char * DateReadFromDateString( char * datestr )
 {
-  static char result[25];
+  static ABC_THREAD_LOCAL char result[25];
   char        day[10];
   char        month[10];
   char        zone[10];
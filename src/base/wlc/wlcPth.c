@@ -20,6 +20,7 @@
 
 #include "wlc.h"
 #include "sat/bmc/bmc.h"
+#include "base/main/main.h"
 
 #ifdef ABC_USE_PTHREADS
 
@@ -59,6 +60,7 @@ typedef struct Bmc3_ThData_t_
     Wla_Man_t *  pWla;
     Aig_Man_t *  pAig;
     Abc_Cex_t ** ppCex;
+    Abc_Frame_t * pFrame;   // the frame of the thread starting BMC
     int          RunId;
     int          fVerbose;
 } Bmc3_ThData_t;
@@ -88,8 +90,10 @@ void * Wla_Bmc3Thread ( void * pArg )
     int RetValue = -1;
     int nFramesNoChangeLim = 10;
     Bmc3_ThData_t * pData = (Bmc3_ThData_t *)pArg;
-    Abc_Ntk_t * pAbcNtk = Abc_NtkFromAigPhase( pData->pAig );
+    Abc_Ntk_t * pAbcNtk;
     Saig_ParBmc_t BmcPars, *pBmcPars = &BmcPars;
+    Abc_FrameSetGlobalFrame( pData->pFrame ); // the frame is per-thread
+    pAbcNtk = Abc_NtkFromAigPhase( pData->pAig );
     Saig_ParBmcSetDefaultParams( pBmcPars );
     pBmcPars->pFuncStop = Wla_CallBackToStop;
     pBmcPars->RunId = pData->RunId;
@@ -155,6 +159,7 @@ void Wla_ManConcurrentBmc3( Wla_Man_t * pWla, Aig_Man_t * pAig, Abc_Cex_t ** ppC
     pData->pWla = pWla;
     pData->pAig = pAig;
     pData->ppCex = ppCex;
+    pData->pFrame = Abc_FrameReadGlobalFrame();
     pData->RunId = g_nRunIds;
     pData->fVerbose = pWla->pPars->fVerbose;
 
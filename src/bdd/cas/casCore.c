@@ -473,7 +473,7 @@ void Experiment2( BFunc * pFunc )
 //};
 
 /////////////////////////////////////////////////////////////
-static int s_SuppSize[MAXOUTPUTS];
+static ABC_THREAD_LOCAL int s_SuppSize[MAXOUTPUTS];
 int CompareSupports( int *ptrX, int *ptrY )
 {
     return ( s_SuppSize[*ptrY] - s_SuppSize[*ptrX] );
@@ -482,7 +482,7 @@ int CompareSupports( int *ptrX, int *ptrY )
 
  
 /////////////////////////////////////////////////////////////
-static int s_MintOnes[MAXOUTPUTS];
+static ABC_THREAD_LOCAL int s_MintOnes[MAXOUTPUTS];
 int CompareMinterms( int *ptrX, int *ptrY )
 {
     return ( s_MintOnes[*ptrY] - s_MintOnes[*ptrX] );
@@ -602,8 +602,8 @@ DdNode * GetSingleOutputFunction( DdManager * dd, DdNode ** pbOuts, int nOuts, D
 DdNode * GetSingleOutputFunctionRemapped( DdManager * dd, DdNode ** pOutputs, int nOuts, DdNode ** pbVarsEnc, int nVarsEnc )
 // returns the ADD of the remapped function
 {
-    static int Permute[MAXINPUTS];
-    static DdNode * pRemapped[MAXOUTPUTS];
+    static ABC_THREAD_LOCAL int Permute[MAXINPUTS];
+    static ABC_THREAD_LOCAL DdNode * pRemapped[MAXOUTPUTS];
 
     DdNode * bSupp, * bTemp;
     int i, Counter;
@@ -660,10 +660,10 @@ DdNode * GetSingleOutputFunctionRemapped( DdManager * dd, DdNode ** pOutputs, in
 DdNode * GetSingleOutputFunctionRemappedNewDD( DdManager * dd, DdNode ** pOutputs, int nOuts, DdManager ** DdNew )
 // returns the ADD of the remapped function
 {
-    static int Permute[MAXINPUTS];
-    static DdNode * pRemapped[MAXOUTPUTS];
+    static ABC_THREAD_LOCAL int Permute[MAXINPUTS];
+    static ABC_THREAD_LOCAL DdNode * pRemapped[MAXOUTPUTS];
 
-    static DdNode * pbVarsEnc[MAXINPUTS];
+    static ABC_THREAD_LOCAL DdNode * pbVarsEnc[MAXINPUTS];
     int nVarsEnc;
 
     DdManager * ddnew;
@@ -924,7 +924,7 @@ void WriteDDintoBLIFfile( FILE * pFile, DdNode * Func, char * OutputName, char *
 
 
 
-static DdManager * s_ddmin;
+static ABC_THREAD_LOCAL DdManager * s_ddmin;
 
 /**Function*************************************************************
 
@@ -78,7 +78,7 @@ extern void WriteDDintoBLIFfileReorder( DdManager * dd, FILE * pFile, DdNode * F
 ////////////////////////////////////////////////////////////////////////
 
 static int s_LutSize = 15;
-static int s_nFuncVars; 
+static ABC_THREAD_LOCAL int s_nFuncVars; 
 
 long s_EncodingTime;
 
@@ -111,9 +111,9 @@ int CreateDecomposedNetwork( DdManager * dd, DdNode * aFunc, char ** pNames, int
 // FileName is the name of the output file for the LUT network
 // dynamic variable reordering should be disabled when this function is running
 {
-    static LUT * pLuts[MAXINPUTS];   // the LUT cascade
-    static int Profile[MAXINPUTS];   // the profile filled in with the info about the BDD width
-    static int Permute[MAXINPUTS];   // the array to store a temporary permutation of variables
+    static ABC_THREAD_LOCAL LUT * pLuts[MAXINPUTS];   // the LUT cascade
+    static ABC_THREAD_LOCAL int Profile[MAXINPUTS];   // the profile filled in with the info about the BDD width
+    static ABC_THREAD_LOCAL int Permute[MAXINPUTS];   // the array to store a temporary permutation of variables
 
     LUT * p;               // the current LUT
     int i, v;
@@ -416,9 +416,9 @@ printf( "Stage %3d: In = %3d  InP = %3d  Cols = %5d  Multi = %2d  Simple = %2d
 void WriteLUTSintoBLIFfile( FILE * pFile, DdManager * dd, LUT ** pLuts, int nLuts, DdNode ** bCVars, char ** pNames, int nNames, char * FileName )
 {
     int i, v, o;
-    static char * pNamesLocalIn[MAXINPUTS];
-    static char * pNamesLocalOut[MAXINPUTS];
-    static char Buffer[100];
+    static ABC_THREAD_LOCAL char * pNamesLocalIn[MAXINPUTS];
+    static ABC_THREAD_LOCAL char * pNamesLocalOut[MAXINPUTS];
+    static ABC_THREAD_LOCAL char Buffer[100];
     DdNode * bCube, * bCof, * bFunc;
     LUT * p;
 
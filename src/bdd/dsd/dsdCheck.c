@@ -41,7 +41,7 @@ struct Dsd_Entry_t_
     DdNode * bX[5];
 };
 
-static Dds_Cache_t * pCache;
+static ABC_THREAD_LOCAL Dds_Cache_t * pCache;
 
 static int Dsd_CheckRootFunctionIdentity_rec( DdManager * dd, DdNode * bF1, DdNode * bF2, DdNode * bC1, DdNode * bC2 );
 
@@ -40,8 +40,8 @@ static void Dsd_NodePrint_rec( FILE * pFile, Dsd_Node_t * pNode, int fComp, char
 ///                      STATIC VARIABLES                            ///
 ////////////////////////////////////////////////////////////////////////
 
-static int s_DepthMax;
-static int s_GateSizeMax;
+static ABC_THREAD_LOCAL int s_DepthMax;
+static ABC_THREAD_LOCAL int s_GateSizeMax;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -1121,7 +1121,7 @@ DdNode * Dsd_TreeGetPrimeFunctionOld( DdManager * dd, Dsd_Node_t * pNode, int fR
 {
     DdNode * bCof0,  * bCof1, * bCube0, * bCube1, * bNewFunc, * bTemp;
     int i;
-    static int Permute[MAXINPUTS];
+    static ABC_THREAD_LOCAL int Permute[MAXINPUTS];
 
     assert( pNode );
     assert( !Dsd_IsComplement( pNode ) );
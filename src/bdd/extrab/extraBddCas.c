@@ -59,9 +59,9 @@ typedef struct
 } traventry;
 
 // the signature used for hashing
-static unsigned s_Signature = 1;
+static ABC_THREAD_LOCAL unsigned s_Signature = 1;
 
-static int s_CutLevel = 0;
+static ABC_THREAD_LOCAL int s_CutLevel = 0;
 
 /*---------------------------------------------------------------------------*/
 /* Variable declarations                                                     */
@@ -71,26 +71,26 @@ static int s_CutLevel = 0;
 // we limit the depth of the branch and bound procedure to 5 levels
 static int s_MaxDepth = 5;      
 
-static int s_nVarsBest;          // the number of vars in the best ordering
-static int s_VarOrderBest[32];   // storing the best ordering of vars in the "simple encoding"
-static int s_VarOrderCur[32];    // storing the current ordering of vars
+static ABC_THREAD_LOCAL int s_nVarsBest;          // the number of vars in the best ordering
+static ABC_THREAD_LOCAL int s_VarOrderBest[32];   // storing the best ordering of vars in the "simple encoding"
+static ABC_THREAD_LOCAL int s_VarOrderCur[32];    // storing the current ordering of vars
  
 // the place to store the supports of the encoded function
-static DdNode * s_Field[8][256]; // the size should be K, 2^K, where K is no less than MaxDepth
-static DdNode * s_Encoded;       // this is the original function
-static DdNode * s_VarAll;        // the set of all column variables
-static int s_MultiStart;         // the total number of encoding variables used
+static ABC_THREAD_LOCAL DdNode * s_Field[8][256]; // the size should be K, 2^K, where K is no less than MaxDepth
+static ABC_THREAD_LOCAL DdNode * s_Encoded;       // this is the original function
+static ABC_THREAD_LOCAL DdNode * s_VarAll;        // the set of all column variables
+static ABC_THREAD_LOCAL int s_MultiStart;         // the total number of encoding variables used
 // the array field now stores the supports
 
-static DdNode ** s_pbTemp;       // the temporary storage for the columns
+static ABC_THREAD_LOCAL DdNode ** s_pbTemp;       // the temporary storage for the columns
 
-static int s_BackTracks;
+static ABC_THREAD_LOCAL int s_BackTracks;
 static int s_BackTrackLimit = 100;
 
-static DdNode * s_Terminal;      // the terminal value for counting minterms
+static ABC_THREAD_LOCAL DdNode * s_Terminal;      // the terminal value for counting minterms
 
 
-static int s_EncodingVarsLevel;
+static ABC_THREAD_LOCAL int s_EncodingVarsLevel;
 
 
 /*---------------------------------------------------------------------------*/
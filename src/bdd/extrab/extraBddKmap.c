@@ -154,10 +154,10 @@ ABC_NAMESPACE_IMPL_START
 /*---------------------------------------------------------------------------*/
 
 // the array of BDD variables used internally
-static DdNode * s_XVars[MAXVARS];
+static ABC_THREAD_LOCAL DdNode * s_XVars[MAXVARS];
 
 // flag which determines where the horizontal variable names are printed
-static int fHorizontalVarNamesPrintedAbove = 1;
+static ABC_THREAD_LOCAL int fHorizontalVarNamesPrintedAbove = 1;
 
 /*---------------------------------------------------------------------------*/
 /* Macro declarations                                                        */
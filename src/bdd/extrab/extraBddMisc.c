@@ -2143,7 +2143,7 @@ DdNode * extraBddChangePolarity(
 
 
 
-static int Counter = 0;
+static ABC_THREAD_LOCAL int Counter = 0;
 
 /**Function*************************************************************
 
@@ -947,7 +947,7 @@ DdNode * Llb_NonlinImage( Aig_Man_t * pAig, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vRo
 
 
 
-static Llb_Mgr_t * p = NULL;
+static ABC_THREAD_LOCAL Llb_Mgr_t * p = NULL;
 
 /**Function*************************************************************
 
@@ -0,0 +1,590 @@
+/**CFile****************************************************************
+
+  FileName    [bench.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Benchmark runner.]
+
+  Synopsis    [Benchmark runner timing the core engines on a corpus of AIGs.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: bench.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "aig/gia/gia.h"
+#include "misc/extra/extra.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// in the commands below, "$D" stands for the design file name without
+// extension and "$L" stands for the cell library file name
+
+// generated designs
+typedef struct Bnc_Design_t_ Bnc_Design_t;
+struct Bnc_Design_t_
+{
+    char *       pName;       // the design name
+    char *       pCommand;    // the command writing the design into "$D.aig"
+};
+
+// timed engines
+typedef struct Bnc_Engine_t_ Bnc_Engine_t;
+struct Bnc_Engine_t_
+{
+    char *       pName;       // the engine name
+    char *       pSetup;      // the command preparing the engine (not timed)
+    char *       pCommand;    // the command running the engine (timed)
+    int          fSeq;        // the engine requires a sequential design
+};
+
+// the result of one run
+typedef struct Bnc_Res_t_ Bnc_Res_t;
+struct Bnc_Res_t_
+{
+    int          Status;      // 0 = ok; 1 = setup failed; 2 = command failed
+    int          nAndsBeg;    // AND nodes before the command
+    int          nAndsEnd;    // AND nodes after the command
+    int          ProbStatus;  // the problem status after the command
+    double       Wall;        // wall-clock time in seconds
+    double       Cpu;         // user + system time in seconds
+};
+
+static Bnc_Design_t s_Designs[] = {
+    { "add64",       "gen -a -N 64 $D.blif; read $D.blif; strash; write $D.aig" },
+    { "mult16",      "gen -m -N 16 $D.blif; read $D.blif; strash; write $D.aig" },
+    { "sorter32",    "gen -s -N 32 $D.blif; read $D.blif; strash; write $D.aig" },
+    { "lut6x20",     "gen -f -K 6 -L 20 -N 30 $D.blif; read $D.blif; strash; write $D.aig" },
+    { "fsm200",      "genfsm -I 10 -O 4 -S 200 -L 2000 -P 100 $D.kiss; &read_stg $D.kiss; &w $D.aig" },
+    { "fsm32_miter", "genfsm -I 6 -O 4 -S 32 -L 256 -P 100 $D.kiss; &read_stg $D.kiss; &w $D_spec.aig; "
+                     "read $D_spec.aig; strash; dc2; write $D_impl.aig; miter $D_spec.aig $D_impl.aig; write $D.aig" },
+    { NULL,          NULL }
+};
+
+static Bnc_Engine_t s_Engines[] = {
+    { "strash",      "read $D.aig",                  "strash",         0 },
+    { "&b",          "&r $D.aig",                    "&b",             0 },
+    { "&dc2",        "&r $D.aig",                    "&dc2",           0 },
+    { "&if",         "&r $D.aig",                    "&if -K 6",       0 },
+    { "&nf",         "read_genlib $L; &r $D.aig",    "&nf",            0 },
+    { "&cec",        "&r $D.aig; &dc2",              "&cec $D.aig",    0 },
+    { "&scorr",      "&r $D.aig",                    "&scorr",         1 },
+    { "pdr",         "read $D.aig",                  "pdr",            1 },
+    { "bmc3",        "read $D.aig",                  "bmc3 -F 5",      1 },
+    { NULL,          NULL,                           NULL,             0 }
+};
+
+// the cell library used by the standard-cell mapper
+static char * s_pGenlib =
+    "GATE zero    0.00  O=CONST0;\n"
+    "GATE one     0.00  O=CONST1;\n"
+    "GATE buf     1.00  O=a;              PIN * NONINV 1 999 1.0 0.0 1.0 0.0\n"
+    "GATE inv     1.00  O=!a;             PIN * INV    1 999 0.9 0.0 0.9 0.0\n"
+    "GATE nand2   2.00  O=!(a*b);         PIN * INV    1 999 1.0 0.0 1.0 0.0\n"
+    "GATE nor2    2.00  O=!(a+b);         PIN * INV    1 999 1.4 0.0 1.4 0.0\n"
+    "GATE and2    3.00  O=a*b;            PIN * NONINV 1 999 1.6 0.0 1.6 0.0\n"
+    "GATE or2     3.00  O=a+b;            PIN * NONINV 1 999 1.8 0.0 1.8 0.0\n"
+    "GATE xor2    5.00  O=a*!b+!a*b;      PIN * UNKNOWN 2 999 2.0 0.0 2.0 0.0\n"
+    "GATE xnor2   5.00  O=a*b+!a*!b;      PIN * UNKNOWN 2 999 2.0 0.0 2.0 0.0\n"
+    "GATE aoi21   3.00  O=!(a*b+c);       PIN * INV    1 999 1.6 0.0 1.6 0.0\n"
+    "GATE oai21   3.00  O=!((a+b)*c);     PIN * INV    1 999 1.6 0.0 1.6 0.0\n"
+    "GATE mux21   6.00  O=a*c+b*!c;       PIN * UNKNOWN 1 999 2.0 0.0 2.0 0.0\n";
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef _WIN32
+
+/**Function*************************************************************
+
+  Synopsis    [Substitutes the design and library names into the command.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Bnc_CommandDerive( char * pTemplate, char * pDesign, char * pLib )
+{
+    Vec_Str_t * vStr = Vec_StrAlloc( 1000 );
+    char * pCur;
+    for ( pCur = pTemplate; *pCur; pCur++ )
+    {
+        if ( pCur[0] == '$' && pCur[1] == 'D' )
+            Vec_StrPrintStr( vStr, pDesign ), pCur++;
+        else if ( pCur[0] == '$' && pCur[1] == 'L' )
+            Vec_StrPrintStr( vStr, pLib ), pCur++;
+        else
+            Vec_StrPush( vStr, *pCur );
+    }
+    Vec_StrPush( vStr, '\0' );
+    return Vec_StrReleaseArray( vStr );
+}
+static char * Bnc_StrCat( char * pStr1, char * pStr2 )
+{
+    char * pRes = ABC_ALLOC( char, strlen(pStr1) + strlen(pStr2) + 1 );
+    sprintf( pRes, "%s%s", pStr1, pStr2 );
+    return pRes;
+}
+static int Bnc_EngineIsSelected( char * pList, char * pName )
+{
+    int nLength = strlen( pName );
+    char * pCur;
+    for ( pCur = strstr(pList, pName); pCur; pCur = strstr(pCur + 1, pName) )
+        if ( (pCur == pList || pCur[-1] == ',') && (pCur[nLength] == 0 || pCur[nLength] == ',') )
+            return 1;
+    return 0;
+}
+static double Bnc_TimeWall()
+{
+    struct timeval tv;
+    gettimeofday( &tv, NULL );
+    return tv.tv_sec + 1.0e-6 * tv.tv_usec;
+}
+static double Bnc_TimeCpu()
+{
+    struct rusage Usage;
+    getrusage( RUSAGE_SELF, &Usage );
+    return Usage.ru_utime.tv_sec + Usage.ru_stime.tv_sec + 1.0e-6 * (Usage.ru_utime.tv_usec + Usage.ru_stime.tv_usec);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of AND nodes in the current AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bnc_ReadAndNum( Abc_Frame_t * pAbc, int fGia )
+{
+    if ( fGia )
+        return Abc_FrameReadGia(pAbc) ? Gia_ManAndNum(Abc_FrameReadGia(pAbc)) : -1;
+    return Abc_FrameReadNtk(pAbc) ? Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc)) : -1;
+}
+static int Bnc_ReadIsSeq( Abc_Frame_t * pAbc )
+{
+    if ( Abc_FrameReadGia(pAbc) )
+        return Gia_ManRegNum(Abc_FrameReadGia(pAbc)) > 0;
+    return Abc_FrameReadNtk(pAbc) && Abc_NtkLatchNum(Abc_FrameReadNtk(pAbc)) > 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the commands in a child process.]
+
+  Description [The child process starts a fresh ABC frame, runs the setup
+  command, and then the timed command. The results are returned through
+  the pipe. The child is killed by SIGALRM when the time limit is reached.
+  The peak resident set size of the child is returned by the kernel.
+  Returns 0 if the child finished; 1 if the child was killed by the time
+  limit; 2 if the child crashed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bnc_RunChild( char * pSetup, char * pCommand, int nTimeLimit, int fVerbose, Bnc_Res_t * pRes, long * pPeakRss )
+{
+    struct rusage Usage;
+    int pPipe[2], status;
+    pid_t pid;
+    memset( pRes, 0, sizeof(Bnc_Res_t) );
+    *pPeakRss = 0;
+    fflush( stdout );
+    fflush( stderr );
+    if ( pipe(pPipe) != 0 )
+        return 2;
+    pid = fork();
+    if ( pid < 0 )
+        return 2;
+    if ( pid == 0 )
+    {
+        Abc_Frame_t * pAbc;
+        double clkWall, clkCpu;
+        close( pPipe[0] );
+        if ( !fVerbose && freopen( "/dev/null", "w", stdout ) == NULL )
+            _exit( 1 );
+        if ( nTimeLimit )
+            alarm( nTimeLimit );
+        Abc_Start();
+        pAbc = Abc_FrameGetGlobalFrame();
+        if ( pSetup && Cmd_CommandExecute(pAbc, pSetup) )
+            pRes->Status = 1;
+        else
+        {
+            int fGia = pCommand && pCommand[0] == '&';
+            pRes->nAndsBeg = Bnc_ReadAndNum( pAbc, fGia );
+            if ( pCommand )
+            {
+                clkWall = Bnc_TimeWall();
+                clkCpu  = Bnc_TimeCpu();
+                if ( Cmd_CommandExecute(pAbc, pCommand) )
+                    pRes->Status = 2;
+                pRes->Cpu  = Bnc_TimeCpu() - clkCpu;
+                pRes->Wall = Bnc_TimeWall() - clkWall;
+                pRes->nAndsEnd = Bnc_ReadAndNum( pAbc, fGia );
+            }
+            else // report whether the design is sequential
+                pRes->nAndsEnd = Bnc_ReadIsSeq( pAbc );
+            pRes->ProbStatus = Abc_FrameReadProbStatus( pAbc );
+        }
+        fflush( stdout );
+        if ( write( pPipe[1], pRes, sizeof(Bnc_Res_t) ) != sizeof(Bnc_Res_t) )
+            _exit( 1 );
+        // skip Abc_Stop() to save time; the memory is released on exit
+        _exit( 0 );
+    }
+    close( pPipe[1] );
+    status = (int)read( pPipe[0], pRes, sizeof(Bnc_Res_t) );
+    close( pPipe[0] );
+    if ( wait4( pid, &status, 0, &Usage ) < 0 )
+        return 2;
+#ifdef __APPLE__
+    *pPeakRss = Usage.ru_maxrss / 1024;
+#else
+    *pPeakRss = Usage.ru_maxrss;
+#endif
+    if ( WIFSIGNALED(status) )
+        return WTERMSIG(status) == SIGALRM ? 1 : 2;
+    return WEXITSTATUS(status) != 0 ? 2 : 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the JSON record of one run.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bnc_PrintJsonStr( FILE * pFile, char * pStr )
+{
+    fputc( '\"', pFile );
+    for ( ; *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            fputc( '\\', pFile );
+        fputc( *pStr, pFile );
+    }
+    fputc( '\"', pFile );
+}
+static void Bnc_PrintJsonRes( FILE * pFile, int fFirst, char * pDesign, Bnc_Engine_t * pEngine, char * pStatus, Bnc_Res_t * pRes, long PeakRss, int nRuns )
+{
+    fprintf( pFile, "%s    { \"design\": ", fFirst ? "" : ",\n" );
+    Bnc_PrintJsonStr( pFile, pDesign );
+    fprintf( pFile, ", \"engine\": " );
+    Bnc_PrintJsonStr( pFile, pEngine->pName );
+    fprintf( pFile, ", \"command\": " );
+    Bnc_PrintJsonStr( pFile, pEngine->pCommand );
+    fprintf( pFile, ", \"status\": \"%s\", \"runs\": %d", pStatus, nRuns );
+    fprintf( pFile, ", \"wall_sec\": %.4f, \"cpu_sec\": %.4f, \"peak_rss_kb\": %ld", pRes->Wall, pRes->Cpu, PeakRss );
+    fprintf( pFile, ", \"ands_before\": %d, \"ands_after\": %d, \"prob_status\": %d }", pRes->nAndsBeg, pRes->nAndsEnd, pRes->ProbStatus );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine on one design.]
+
+  Description [The run is repeated nRepeats times or until it fails. 
+  The results of the fastest successful run and the largest peak memory 
+  of the successful runs are reported. If the first run fails, its 
+  results are reported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Bnc_RunEngine( char * pDesign, char * pLib, Bnc_Engine_t * pEngine, int nRepeats, int nTimeLimit, int fVerbose, Bnc_Res_t * pRes, long * pPeakRss )
+{
+    static char * pStatuses[5] = { "ok", "setup_failed", "failed", "timeout", "crashed" };
+    char * pSetup   = Bnc_CommandDerive( pEngine->pSetup, pDesign, pLib );
+    char * pCommand = Bnc_CommandDerive( pEngine->pCommand, pDesign, pLib );
+    Bnc_Res_t Res;
+    long PeakRss;
+    int r, Status = 0;
+    for ( r = 0; r < nRepeats && Status == 0; r++ )
+    {
+        int RetValue = Bnc_RunChild( pSetup, pCommand, nTimeLimit, fVerbose, &Res, &PeakRss );
+        if ( RetValue == 1 )
+            Status = 3;
+        else if ( RetValue == 2 )
+            Status = 4;
+        else
+            Status = Res.Status;
+        // a failed repeat is reported only if there is no successful one
+        if ( Status != 0 && r > 0 )
+            break;
+        if ( r == 0 || Res.Wall < pRes->Wall )
+            *pRes = Res;
+        if ( r == 0 || *pPeakRss < PeakRss )
+            *pPeakRss = PeakRss;
+    }
+    ABC_FREE( pSetup );
+    ABC_FREE( pCommand );
+    return pStatuses[Status];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Generates the designs and the cell library.]
+
+  Description [Returns the array of design names without extension.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t * Bnc_GenerateDesigns( char * pDir, char * pLib, int fVerbose )
+{
+    Vec_Ptr_t * vDesigns = Vec_PtrAlloc( 10 );
+    Bnc_Design_t * pDesign;
+    Bnc_Res_t Res;
+    long PeakRss;
+    FILE * pFile;
+    pFile = fopen( pLib, "wb" );
+    if ( pFile == NULL )
+    {
+        fprintf( stderr, "Cannot write the cell library into file \"%s\".\n", pLib );
+        return vDesigns;
+    }
+    fputs( s_pGenlib, pFile );
+    fclose( pFile );
+    for ( pDesign = s_Designs; pDesign->pName; pDesign++ )
+    {
+        char * pPath = Bnc_StrCat( pDir, pDesign->pName );
+        char * pCommand = Bnc_CommandDerive( pDesign->pCommand, pPath, pLib );
+        if ( Bnc_RunChild( pCommand, NULL, 0, fVerbose, &Res, &PeakRss ) || Res.Status )
+        {
+            fprintf( stderr, "Cannot generate design \"%s\" using command \"%s\".\n", pDesign->pName, pCommand );
+            ABC_FREE( pPath );
+        }
+        else
+            Vec_PtrPush( vDesigns, pPath );
+        ABC_FREE( pCommand );
+    }
+    return vDesigns;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The benchmark runner.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bnc_RealMain( int argc, char * argv[] )
+{
+    Vec_Ptr_t * vDesigns;
+    Bnc_Engine_t * pEngine;
+    Bnc_Res_t Res;
+    FILE * pFile = stdout;
+    char * pDir = (char *)"bench_work", * pFileOut = NULL, * pEngines = NULL;
+    char * pDesign, * pPath, * pLib;
+    int nTimeLimit = 300, nRepeats = 1, fGenerate = 1, fVerbose = 0;
+    int c, i, fFirst = 1, fSeq;
+    long PeakRss;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "TRDOEgvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( stderr, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nTimeLimit = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nTimeLimit < 0 )
+                goto usage;
+            break;
+        case 'R':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( stderr, "Command line switch \"-R\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nRepeats = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nRepeats < 1 )
+                goto usage;
+            break;
+        case 'D':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( stderr, "Command line switch \"-D\" should be followed by a directory name.\n" );
+                goto usage;
+            }
+            pDir = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'O':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( stderr, "Command line switch \"-O\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileOut = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'E':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( stderr, "Command line switch \"-E\" should be followed by a list of engines.\n" );
+                goto usage;
+            }
+            pEngines = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'g':
+            fGenerate ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+        default:
+            goto usage;
+        }
+    }
+    // prepare the working directory
+    mkdir( pDir, 0755 );
+    pDir = Bnc_StrCat( pDir, (char *)"/" );
+    pLib = Bnc_StrCat( pDir, (char *)"bench.genlib" );
+    // collect the designs
+    vDesigns = fGenerate ? Bnc_GenerateDesigns( pDir, pLib, fVerbose ) : Vec_PtrAlloc( 10 );
+    for ( i = globalUtilOptind; i < argc; i++ )
+    {
+        char * pDot = strrchr( argv[i], '.' );
+        if ( pDot == NULL || strcmp(pDot, ".aig") )
+        {
+            fprintf( stderr, "Skipping file \"%s\", which is not an AIGER file with extension \".aig\".\n", argv[i] );
+            continue;
+        }
+        Vec_PtrPush( vDesigns, Abc_UtilStrsav(argv[i]) );
+        *((char *)Vec_PtrEntryLast(vDesigns) + (pDot - argv[i])) = 0;
+    }
+    if ( Vec_PtrSize(vDesigns) == 0 )
+    {
+        fprintf( stderr, "There are no designs to run.\n" );
+        goto usage;
+    }
+    if ( pFileOut && (pFile = fopen( pFileOut, "wb" )) == NULL )
+    {
+        fprintf( stderr, "Cannot open output file \"%s\".\n", pFileOut );
+        return 1;
+    }
+    fprintf( pFile, "{\n  \"generator\": \"abc_bench\",\n  \"date\": " );
+    Bnc_PrintJsonStr( pFile, Extra_TimeStamp() );
+    fprintf( pFile, ",\n  \"time_limit_sec\": %d,\n  \"repeats\": %d,\n  \"results\": [\n", nTimeLimit, nRepeats );
+    Vec_PtrForEachEntry( char *, vDesigns, pPath, i )
+    {
+        // check if the design is sequential
+        char * pSetup = Bnc_CommandDerive( (char *)"&r $D.aig", pPath, pLib );
+        int RetValue = Bnc_RunChild( pSetup, NULL, nTimeLimit, fVerbose, &Res, &PeakRss );
+        ABC_FREE( pSetup );
+        if ( RetValue || Res.Status )
+        {
+            fprintf( stderr, "Cannot read design \"%s.aig\".\n", pPath );
+            continue;
+        }
+        fSeq = Res.nAndsEnd;
+        pDesign = Extra_FileNameWithoutPath( pPath );
+        for ( pEngine = s_Engines; pEngine->pName; pEngine++ )
+        {
+            char * pStatus;
+            if ( pEngine->fSeq && !fSeq )
+                continue;
+            if ( pEngines && !Bnc_EngineIsSelected(pEngines, pEngine->pName) )
+                continue;
+            pStatus = Bnc_RunEngine( pPath, pLib, pEngine, nRepeats, nTimeLimit, fVerbose, &Res, &PeakRss );
+            fprintf( stderr, "%-16s %-8s %-12s  Wall = %9.3f sec  Cpu = %9.3f sec  Peak RSS = %9.2f MB\n",
+                pDesign, pEngine->pName, pStatus, Res.Wall, Res.Cpu, PeakRss / 1024.0 );
+            Bnc_PrintJsonRes( pFile, fFirst, pDesign, pEngine, pStatus, &Res, PeakRss, nRepeats );
+            fFirst = 0;
+        }
+    }
+    fprintf( pFile, "\n  ]\n}\n" );
+    if ( pFile != stdout )
+        fclose( pFile );
+    Vec_PtrFreeFree( vDesigns );
+    ABC_FREE( pDir );
+    ABC_FREE( pLib );
+    return 0;
+
+usage:
+    fprintf( stderr, "usage: abc_bench [-TR num] [-DOE str] [-gvh] <file1.aig> <file2.aig> ...\n" );
+    fprintf( stderr, "\t         times the core engines on the generated designs and the given AIGs\n" );
+    fprintf( stderr, "\t-T num : the time limit for one run in seconds (0 = no limit) [default = %d]\n", nTimeLimit );
+    fprintf( stderr, "\t-R num : the number of times each run is repeated [default = %d]\n", nRepeats );
+    fprintf( stderr, "\t-D str : the directory for the generated designs [default = %s]\n", pDir );
+    fprintf( stderr, "\t-O str : the output JSON file [default = stdout]\n" );
+    fprintf( stderr, "\t-E str : the comma-separated list of engines to run [default = all]\n" );
+    fprintf( stderr, "\t-g     : toggle running the generated designs [default = %s]\n", fGenerate? "yes": "no" );
+    fprintf( stderr, "\t-v     : toggle printing the output of ABC [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( stderr, "\t-h     : print the command usage\n");
+    fprintf( stderr, "\tengines:" );
+    for ( pEngine = s_Engines; pEngine->pName; pEngine++ )
+        fprintf( stderr, " %s", pEngine->pName );
+    fprintf( stderr, "\n" );
+    return 1;
+}
+
+#else
+
+int Bnc_RealMain( int argc, char * argv[] )
+{
+    fprintf( stderr, "The benchmark runner is not available on Windows.\n" );
+    return 1;
+}
+
+#endif
+
+ABC_NAMESPACE_IMPL_END
+
+int main( int argc, char * argv[] )
+{
+    return ABC_NAMESPACE_PREFIX Bnc_RealMain( argc, argv );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
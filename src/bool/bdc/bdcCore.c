@@ -342,8 +342,8 @@ int Bdc_ManDecompose( Bdc_Man_t * p, unsigned * puFunc, unsigned * puCare, int n
 ***********************************************************************/
 void Bdc_ManDecomposeTest( unsigned uTruth, int nVars )
 {
-    static int Counter = 0;
-    static int Total = 0;
+    static ABC_THREAD_LOCAL int Counter = 0;
+    static ABC_THREAD_LOCAL int Total = 0;
     Bdc_Par_t Pars = {0}, * pPars = &Pars;
     Bdc_Man_t * p;
     int RetValue;
@@ -89,7 +89,7 @@ typedef struct
 
 static inline void TimePrint( char* Message )
 {
-    static int timeBegin;
+    static ABC_THREAD_LOCAL int timeBegin;
     double time = 1.0*(Abc_Clock() - timeBegin)/CLOCKS_PER_SEC ;
     if ( Message != NULL)
         printf("%s = %f sec.\n", Message, time);
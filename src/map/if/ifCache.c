@@ -21,12 +21,45 @@
 #include "if.h"
 #include "misc/vec/vecHsh.h"
 
+#ifdef _MSC_VER
+#include <io.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define IF_CHECK_VERSION "ifc1"
+
+// persistent cache of the cut function checks (If_CutPerformCheck*)
+// 
+// the entries are keyed by the truth table of the cut function and the
+// number of cut leaves; the file contains the header (version, signature 
+// of the check, key size) followed by the keys and the results
+typedef struct If_ChkMan_t_ If_ChkMan_t;
+struct If_ChkMan_t_
+{
+    char *             pFileName;     // the cache file
+    char *             pSign;         // signature of the check
+    int                nKeyWords;     // the key size in words (truth table and the number of leaves)
+    int                fEnabled;      // the check can be cached
+    int                fWrite;        // enables writing the cache file
+    Vec_Mem_t *        vKeys;         // truth tables and the numbers of leaves
+    Vec_Str_t *        vRes;          // results of the checks
+    Vec_Str_t *        vTtRes[IF_MAX_FUNC_LUTSIZE+1]; // results for the truth table literals (-1 = unknown)
+    word *             pKey;          // temporary key
+    // statistics
+    int                nLoaded;       // entries loaded from file
+    int                nLookups;      // lookups in the persistent cache
+    int                nComputed;     // checks performed
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -91,6 +124,361 @@ void If_ManCacheAnalize( If_Man_t * p )
     Vec_IntFree( vRes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the cut function check.]
+
+  Description [Returns NULL if the check is not known to depend only 
+  on the cut function and the mapper parameters used in the signature.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * If_ManCacheCheckName( If_Man_t * p )
+{
+    if ( p->pPars->pFuncCell == If_CutPerformCheck07 ) return "07";
+    if ( p->pPars->pFuncCell == If_CutPerformCheck08 ) return "08";
+    if ( p->pPars->pFuncCell == If_CutPerformCheck10 ) return "10";
+    if ( p->pPars->pFuncCell == If_CutPerformCheck16 ) return "16";
+    if ( p->pPars->pFuncCell == If_CutPerformCheck45 ) return "45";
+    if ( p->pPars->pFuncCell == If_CutPerformCheck54 ) return "54";
+    if ( p->pPars->pFuncCell == If_CutPerformCheck75 ) return "75";
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the cache file and adds its entries to the cache.]
+
+  Description [Returns the number of entries read, or -1 if the file
+  exists but cannot be used with the current check.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ChkManRead( If_ChkMan_t * p, char * pFileName )
+{
+    char pBuffer[4];
+    char * pSign = NULL, * pRes = NULL;
+    word * pKeys = NULL;
+    int i, Num, nKeyWords, nEntries, nSize = (int)strlen(p->pSign), RetValue = -1;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    if ( fread( pBuffer, 4, 1, pFile ) != 1 || strncmp(pBuffer, IF_CHECK_VERSION, 4) )
+        goto finish;
+    if ( fread( &Num, 4, 1, pFile ) != 1 || Num != nSize )
+        goto finish;
+    pSign = ABC_ALLOC( char, nSize );
+    if ( fread( pSign, 1, nSize, pFile ) != (size_t)nSize || strncmp(pSign, p->pSign, nSize) )
+        goto finish;
+    if ( fread( &nKeyWords, 4, 1, pFile ) != 1 || nKeyWords != p->nKeyWords )
+        goto finish;
+    if ( fread( &nEntries, 4, 1, pFile ) != 1 || nEntries < 0 )
+        goto finish;
+    pKeys = ABC_ALLOC( word, (size_t)nKeyWords * nEntries + 1 );
+    pRes  = ABC_ALLOC( char, nEntries + 1 );
+    if ( fread( pKeys, sizeof(word) * nKeyWords, nEntries, pFile ) != (size_t)nEntries )
+        goto finish;
+    if ( fread( pRes, 1, nEntries, pFile ) != (size_t)nEntries )
+        goto finish;
+    for ( i = 0; i < nEntries; i++ )
+        if ( Vec_MemHashInsert( p->vKeys, pKeys + (size_t)nKeyWords * i ) == Vec_StrSize(p->vRes) )
+            Vec_StrPush( p->vRes, pRes[i] );
+    RetValue = nEntries;
+finish:
+    ABC_FREE( pSign );
+    ABC_FREE( pKeys );
+    ABC_FREE( pRes );
+    fclose( pFile );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Locks and unlocks the cache file.]
+
+  Description [The lock is an exclusive record lock on the file with the
+  extension ".lock" next to the cache file. It serializes the updates of
+  the cache file by several processes. The lock file is not removed, so 
+  that all processes lock the same file. Returns the descriptor of the 
+  lock file, or -1 if the lock cannot be taken.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ChkManLock( If_ChkMan_t * p )
+{
+#ifdef _WIN32
+    return 0;
+#else
+    struct flock Lock;
+    char * pLockName = ABC_ALLOC( char, strlen(p->pFileName) + 10 );
+    int fd;
+    sprintf( pLockName, "%s.lock", p->pFileName );
+    fd = open( pLockName, O_RDWR | O_CREAT, 0666 );
+    ABC_FREE( pLockName );
+    if ( fd == -1 )
+        return -1;
+    memset( &Lock, 0, sizeof(struct flock) );
+    Lock.l_type   = F_WRLCK;
+    Lock.l_whence = SEEK_SET;
+    while ( fcntl( fd, F_SETLKW, &Lock ) == -1 )
+        if ( errno != EINTR )
+        {
+            close( fd );
+            return -1;
+        }
+    return fd;
+#endif
+}
+static void If_ChkManUnlock( int fd )
+{
+#ifndef _WIN32
+    close( fd ); // releases the lock
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the contents of the cache into the file.]
+
+  Description [Returns 1 if all the data was written.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ChkManWriteFile( If_ChkMan_t * p, FILE * pFile )
+{
+    word * pKey;
+    int i, Num;
+    if ( fwrite( IF_CHECK_VERSION, 4, 1, pFile ) != 1 )
+        return 0;
+    Num = (int)strlen(p->pSign);
+    if ( fwrite( &Num, 4, 1, pFile ) != 1 || fwrite( p->pSign, 1, Num, pFile ) != (size_t)Num )
+        return 0;
+    Num = p->nKeyWords;
+    if ( fwrite( &Num, 4, 1, pFile ) != 1 )
+        return 0;
+    Num = Vec_MemEntryNum(p->vKeys);
+    if ( fwrite( &Num, 4, 1, pFile ) != 1 )
+        return 0;
+    Vec_MemForEachEntry( p->vKeys, pKey, i )
+        if ( fwrite( pKey, sizeof(word) * p->nKeyWords, 1, pFile ) != 1 )
+            return 0;
+    if ( fwrite( Vec_StrArray(p->vRes), 1, Vec_StrSize(p->vRes), pFile ) != (size_t)Vec_StrSize(p->vRes) )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the cache file.]
+
+  Description [The update is performed under the lock of the cache file.
+  The entries added by other processes since the file was loaded are 
+  merged first. The file is written under a temporary name and renamed,
+  so that the concurrent readers never see a partial file. If writing
+  fails, the temporary file is removed and the cache file is unchanged.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ChkManWrite( If_ChkMan_t * p )
+{
+    extern int tmpFile( const char * prefix, const char * suffix, char ** out_name );
+    char * pTempName = NULL;
+    FILE * pFile;
+    int fd, fdLock, fWritten;
+    fdLock = If_ChkManLock( p );
+    if ( fdLock == -1 )
+    {
+        printf( "Cannot lock the cache file \"%s\".\n", p->pFileName );
+        return;
+    }
+    if ( If_ChkManRead( p, p->pFileName ) == -1 )
+    {
+        printf( "The cache file \"%s\" was changed by another process and cannot be merged.\n", p->pFileName );
+        If_ChkManUnlock( fdLock );
+        return;
+    }
+    fd = tmpFile( p->pFileName, ".tmp", &pTempName );
+    if ( fd == -1 )
+    {
+        printf( "Cannot create a temporary file for writing the cache file \"%s\".\n", p->pFileName );
+        If_ChkManUnlock( fdLock );
+        return;
+    }
+    close( fd );
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pTempName );
+        remove( pTempName );
+        free( pTempName );
+        If_ChkManUnlock( fdLock );
+        return;
+    }
+    fWritten = If_ChkManWriteFile( p, pFile );
+    if ( fclose( pFile ) != 0 )
+        fWritten = 0;
+    if ( !fWritten )
+    {
+        printf( "Cannot write file \"%s\".\n", pTempName );
+        remove( pTempName );
+        free( pTempName );
+        If_ChkManUnlock( fdLock );
+        return;
+    }
+#ifdef _WIN32
+    remove( p->pFileName );
+#endif
+    if ( rename( pTempName, p->pFileName ) )
+    {
+        printf( "Cannot rename file \"%s\" into \"%s\".\n", pTempName, p->pFileName );
+        remove( pTempName );
+    }
+    free( pTempName );
+    If_ChkManUnlock( fdLock );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the cache of the cut function checks.]
+
+  Description [The cache file is loaded when the first cut is checked.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static If_ChkMan_t * If_ChkManStart( If_Man_t * pIfMan )
+{
+    If_ChkMan_t * p;
+    char * pName = If_ManCacheCheckName( pIfMan );
+    char Buffer[1000];
+    int v;
+    p = ABC_CALLOC( If_ChkMan_t, 1 );
+    p->pFileName = Abc_UtilStrsav( pIfMan->pPars->pCacheFile );
+    sprintf( Buffer, "check=%s struct=%s lut=%d cutmin=%d derive=%d c75=%d c75u=%d", pName ? pName : "none", 
+        pIfMan->pPars->pLutStruct ? pIfMan->pPars->pLutStruct : "none", pIfMan->pPars->nLutSize, pIfMan->pPars->fCutMin, 
+        pIfMan->pPars->fDeriveLuts, pIfMan->pPars->fEnableCheck75, pIfMan->pPars->fEnableCheck75u );
+    p->pSign     = Abc_UtilStrsav( Buffer );
+    p->nKeyWords = Abc_Truth6WordNum(pIfMan->pPars->nLutSize) + 1;
+    p->vKeys     = Vec_MemAlloc( p->nKeyWords, 12 );
+    Vec_MemHashAlloc( p->vKeys, 10000 );
+    p->vRes      = Vec_StrAlloc( 10000 );
+    p->pKey      = ABC_CALLOC( word, p->nKeyWords );
+    for ( v = 0; v <= pIfMan->pPars->nLutSize; v++ )
+        p->vTtRes[v] = Vec_StrAlloc( 1000 );
+    if ( pName == NULL )
+    {
+        printf( "The cut function check cannot be cached.\n" );
+        return p;
+    }
+    p->fEnabled = 1;
+    p->nLoaded = If_ChkManRead( p, p->pFileName );
+    if ( p->nLoaded == -1 )
+        printf( "The cache file \"%s\" is incompatible with the current check (%s) and will not be updated.\n", p->pFileName, p->pSign );
+    p->fWrite = (p->nLoaded >= 0);
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the cut function using the cache.]
+
+  Description [The results are first looked up by the truth table literal,
+  which is unique in the current run, then by the truth table itself.
+  The truth table is not canonicized because the checks are heuristic 
+  and their results may differ for the NPN-equivalent functions; using 
+  such results would change the mapping and could make the subsequent 
+  derivation of LUT structures fail.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCacheCheckCut( If_Man_t * pIfMan, If_Cut_t * pCut )
+{
+    If_ChkMan_t * p = (If_ChkMan_t *)pIfMan->pCheckCache;
+    int nLeaves = pCut->nLeaves, iTruthLit = pCut->iCutFunc;
+    int iEntry, RetValue, nWords = pIfMan->nTruth6Words[nLeaves];
+    assert( pIfMan->pPars->fTruth );
+    if ( p == NULL )
+        p = (If_ChkMan_t *)(pIfMan->pCheckCache = If_ChkManStart( pIfMan ));
+    if ( !p->fEnabled )
+        return pIfMan->pPars->pFuncCell( pIfMan, If_CutTruth(pIfMan, pCut), Abc_MaxInt(6, nLeaves), nLeaves, pIfMan->pPars->pLutStruct );
+    // lookup by the truth table literal
+    while ( iTruthLit >= Vec_StrSize(p->vTtRes[nLeaves]) )
+        Vec_StrPush( p->vTtRes[nLeaves], -1 );
+    RetValue = Vec_StrEntry( p->vTtRes[nLeaves], iTruthLit );
+    if ( RetValue >= 0 )
+        return RetValue;
+    // lookup by the truth table
+    p->nLookups++;
+    memset( p->pKey, 0, sizeof(word) * p->nKeyWords );
+    memcpy( p->pKey, If_CutTruthW(pIfMan, pCut), sizeof(word) * nWords );
+    p->pKey[p->nKeyWords-1] = nLeaves;
+    iEntry = Vec_MemHashInsert( p->vKeys, p->pKey );
+    if ( iEntry == Vec_StrSize(p->vRes) )
+    {
+        RetValue = pIfMan->pPars->pFuncCell( pIfMan, If_CutTruth(pIfMan, pCut), Abc_MaxInt(6, nLeaves), nLeaves, pIfMan->pPars->pLutStruct );
+        Vec_StrPush( p->vRes, (char)RetValue );
+        p->nComputed++;
+    }
+    else
+        RetValue = Vec_StrEntry( p->vRes, iEntry );
+    Vec_StrWriteEntry( p->vTtRes[nLeaves], iTruthLit, (char)RetValue );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves and frees the cache of the cut function checks.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManCacheCheckStop( If_Man_t * pIfMan )
+{
+    If_ChkMan_t * p = (If_ChkMan_t *)pIfMan->pCheckCache;
+    int v;
+    if ( p == NULL )
+        return;
+    if ( pIfMan->pPars->fVerbose )
+        printf( "Check cache: Loaded = %d. Lookups = %d. Computed = %d (%.2f %%). Entries = %d.\n", 
+            Abc_MaxInt(p->nLoaded, 0), p->nLookups, p->nComputed, 100.0 * p->nComputed / Abc_MaxInt(1, p->nLookups), Vec_StrSize(p->vRes) );
+    if ( p->fWrite && p->nComputed > 0 )
+        If_ChkManWrite( p );
+    for ( v = 0; v <= pIfMan->pPars->nLutSize; v++ )
+        Vec_StrFree( p->vTtRes[v] );
+    Vec_MemHashFree( p->vKeys );
+    Vec_MemFree( p->vKeys );
+    Vec_StrFree( p->vRes );
+    ABC_FREE( p->pKey );
+    ABC_FREE( p->pSign );
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+    pIfMan->pCheckCache = NULL;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
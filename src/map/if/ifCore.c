@@ -51,6 +51,7 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
     pPars->nCutsMax    =  8;
     pPars->nFlowIters  =  1;
     pPars->nAreaIters  =  2;
+    pPars->nProcs      =  1;
     pPars->DelayTarget = -1;
     pPars->Epsilon     =  (float)0.005;
     pPars->fPreprocess =  1;
@@ -83,7 +84,14 @@ int If_ManPerformMapping( If_Man_t * p )
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
     // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    if ( If_ManMappingUsesThreads(p) )
+    {
+        // area recovery is sequential, so both traversal orders should fit
+        p->vLevels = If_ManCollectLevels( p );
+        If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManCrossCutLevels(p, p->vLevels)) );
+    }
+    else
+        If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
@@ -166,7 +174,7 @@ int If_ManPerformMappingComb( If_Man_t * p )
 
 /*
     {
-        static char * pLastName = NULL;
+        static ABC_THREAD_LOCAL char * pLastName = NULL;
         FILE * pTable = fopen( "fpga/ucsb/stats.txt", "a+" );
         if ( pLastName == NULL || strcmp(pLastName, p->pName) )
         {
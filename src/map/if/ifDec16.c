@@ -1910,7 +1910,7 @@ If_Grp_t If_CluCheck3( If_Man_t * p, word * pTruth0, int nVars, int nLutLeaf, in
                       If_Grp_t * pR, If_Grp_t * pG2, word * pFunc0, word * pFunc1, word * pFunc2 )
 {
     int fEnableHashing = 0;
-    static int Counter = 0;
+    static ABC_THREAD_LOCAL int Counter = 0;
     unsigned * pHashed = NULL;
     word pLeftOver[CLU_WRD_MAX], Func0, Func1, Func2;
     If_Grp_t G1 = {0}, G2 = {0}, R = {0}, R2 = {0};
@@ -2194,8 +2194,8 @@ float If_CutDelayLutStruct( If_Man_t * p, If_Cut_t * pCut, char * pStr, float Wi
 //#define IF_TRY_NEW
 
 #ifdef IF_TRY_NEW
-static Vec_Mem_t * s_vTtMem = NULL;
-static Vec_Mem_t * s_vTtMem2 = NULL;
+static ABC_THREAD_LOCAL Vec_Mem_t * s_vTtMem = NULL;
+static ABC_THREAD_LOCAL Vec_Mem_t * s_vTtMem2 = NULL;
 int If_TtMemCutNum()  { return Vec_MemEntryNum(s_vTtMem); }
 int If_TtMemCutNum2() { return Vec_MemEntryNum(s_vTtMem2); }
 //        printf( "Unique TTs = %d.  Unique classes = %d.    ", If_TtMemCutNum(), If_TtMemCutNum2() );
@@ -249,7 +249,7 @@ If_LibBox_t * If_LibBoxRead2( char * pFileName )
 ***********************************************************************/
 char * If_LibBoxGetToken( FILE * pFile )
 {
-    static char pBuffer[1000];
+    static ABC_THREAD_LOCAL char pBuffer[1000];
     int c; char * pTemp = pBuffer;
     while ( (c = fgetc(pFile)) != EOF )
     {
@@ -20,6 +20,7 @@
 
 #include "if.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -31,6 +32,22 @@ extern char * Dau_DsdMerge( char * pDsd0i, int * pPerm0, char * pDsd1i, int * pP
 extern int    If_CutDelayRecCost3( If_Man_t* p, If_Cut_t* pCut, If_Obj_t * pObj );
 extern int    Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char * pPerm, int * Cost, int AigLevel );
 
+// the smallest number of nodes of one level given to a thread
+#define IF_THREAD_NODES_MIN  64
+
+typedef struct If_ThData_t_ If_ThData_t;
+struct If_ThData_t_
+{
+    If_Man_t         Man;         // private copy of the manager (owns the cut merging scratch)
+    Vec_Int_t *      vLevel;      // the nodes of the current level
+    int              iThread;     // the index of this thread
+    int              nThreads;    // the number of threads working on the level
+    int              Mode;        // the mapping mode
+    int              fPreprocess; // the preprocessing flag
+    int              fFirst;      // the first round flag
+    int              nCutsMerged; // the number of merged cuts
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -150,28 +167,18 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
 
 /**Function*************************************************************
 
-  Synopsis    [Finds the best cut for the given node.]
+  Synopsis    [Prepares the node for cut computation.]
 
-  Description [Mapping modes: delay (0), area flow (1), area (2).]
+  Description [Updates the fanout estimate, dereferences the selected cut,
+  and fetches the cutset of the node.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+static inline void If_ObjPrepareMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode )
 {
-    If_Set_t * pCutSet;
-    If_Cut_t * pCut0, * pCut1, * pCut;
-    If_Cut_t * pCut0R, * pCut1R;
-    int fFunc0R, fFunc1R;
-    int i, k, v, iCutDsd, fChange;
-    int fSave0 = p->pPars->fDelayOpt || p->pPars->fDelayOptLut || p->pPars->fDsdBalance || p->pPars->fUserRecLib || p->pPars->fUserSesLib || 
-        p->pPars->fUseDsdTune || p->pPars->fUseCofVars || p->pPars->fUseAndVars || p->pPars->fUse34Spec || p->pPars->pLutStruct || p->pPars->pFuncCell2;
-    int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
-    assert( !If_ObjIsAnd(pObj->pFanin0) || pObj->pFanin0->pCutSet->nCuts > 0 );
-    assert( !If_ObjIsAnd(pObj->pFanin1) || pObj->pFanin1->pCutSet->nCuts > 0 );
-
     // prepare
     if ( Mode == 0 )
         pObj->EstRefs = (float)pObj->nRefs;
@@ -180,9 +187,34 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     // deref the selected cut
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
-
     // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    If_ManSetupNodeCutSet( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts of the node and selects the best one.]
+
+  Description [Only writes into the node's own cutset and best cut, and into
+  the cut merging scratch of the manager. Returns the number of merged cuts.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int If_ObjComputeCutsAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    If_Set_t * pCutSet = pObj->pCutSet;
+    If_Cut_t * pCut0, * pCut1, * pCut;
+    If_Cut_t * pCut0R, * pCut1R;
+    int fFunc0R, fFunc1R;
+    int i, k, v, iCutDsd, fChange, nCutsMerged = 0;
+    int fSave0 = p->pPars->fDelayOpt || p->pPars->fDelayOptLut || p->pPars->fDsdBalance || p->pPars->fUserRecLib || p->pPars->fUserSesLib || 
+        p->pPars->fUseDsdTune || p->pPars->fUseCofVars || p->pPars->fUseAndVars || p->pPars->fUse34Spec || p->pPars->pLutStruct || p->pPars->pFuncCell2;
+    int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
+    assert( !If_ObjIsAnd(pObj->pFanin0) || pObj->pFanin0->pCutSet->nCuts > 0 );
+    assert( !If_ObjIsAnd(pObj->pFanin1) || pObj->pFanin1->pCutSet->nCuts > 0 );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -266,8 +298,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         }
         if ( pObj->fSpec && pCut->nLeaves == (unsigned)p->pPars->nLutSize )
             continue;
-        p->nCutsMerged++;
-        p->nCutsTotal++;
+        nCutsMerged++;
         // check if this cut is contained in any of the available cuts
         if ( !p->pPars->fSkipCutFilter && If_CutFilter( pCutSet, pCut, fSave0 ) )
             continue;
@@ -320,6 +351,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                     pCut->fUseless = If_DsdManCheckDec( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
                 else if ( p->pPars->pFuncCell2 )
                     pCut->fUseless = !p->pPars->pFuncCell2( p, (word *)If_CutTruthW(p, pCut), pCut->nLeaves, NULL, NULL );
+                else if ( p->pPars->pCacheFile )
+                    pCut->fUseless = !If_ManCacheCheckCut( p, pCut );
                 else
                     pCut->fUseless = !p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct );
                 p->nCutsUselessAll += pCut->fUseless;
@@ -475,7 +508,25 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //        p->nBestCutSmall[0]++;
 //    else if ( If_ObjCutBest(pObj)->nLeaves == 1 )
 //        p->nBestCutSmall[1]++;
+    return nCutsMerged;
+}
 
+/**Function*************************************************************
+
+  Synopsis    [Completes cut computation for the node.]
+
+  Description [References the selected cut and recycles the cutsets 
+  that are no longer needed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void If_ObjFinishMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode )
+{
+    If_Cut_t * pCut;
+    int i;
     // ref the selected cut
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
@@ -489,6 +540,27 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     If_ManDerefNodeCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the best cut for the given node.]
+
+  Description [Mapping modes: delay (0), area flow (1), area (2).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    int nCutsMerged;
+    If_ObjPrepareMappingAnd( p, pObj, Mode );
+    nCutsMerged = If_ObjComputeCutsAnd( p, pObj, Mode, fPreprocess, fFirst );
+    p->nCutsMerged += nCutsMerged;
+    p->nCutsTotal  += nCutsMerged;
+    If_ObjFinishMappingAnd( p, pObj, Mode );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Finds the best cut for the choice node.]
@@ -573,6 +645,186 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if cut computation can be split among threads.]
+
+  Description [Cut computation is parallelized over the nodes of one level.
+  This requires that the cost of a cut only depends on the nodes of lower
+  levels, which is not the case for boxes, choices, truth-table-based costs,
+  and user-defined callbacks.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManMappingUsesThreads( If_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    If_Par_t * pPars = p->pPars;
+    return pPars->nProcs > 1 && p->pManTim == NULL && p->nChoices == 0 && !pPars->fTruth && 
+        !pPars->fLiftLeaves && !pPars->fPower && pPars->nGateSize == 0 && !pPars->fDelayOpt && 
+        !pPars->fDelayOptLut && !pPars->fDsdBalance && !pPars->fUserRecLib && !pPars->fUserSesLib && 
+        pPars->pFuncCost == NULL && pPars->pFuncUser == NULL;
+#else
+    return 0;
+#endif
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts for the share of the level assigned to the thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManMappingWorker( void * pArg )
+{
+    If_ThData_t * pThData = (If_ThData_t *)pArg;
+    If_Man_t * p = &pThData->Man;
+    int i;
+    for ( i = pThData->iThread; i < Vec_IntSize(pThData->vLevel); i += pThData->nThreads )
+        pThData->nCutsMerged += If_ObjComputeCutsAnd( p, If_ManObj(p, Vec_IntEntry(pThData->vLevel, i)), pThData->Mode, pThData->fPreprocess, pThData->fFirst );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the statistics of the thread's copy of the manager.]
+
+  Description [The first procedure resets the counters of the copy. 
+  The second procedure adds them to the counters of the manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManMappingStatsClean( If_Man_t * p )
+{
+    p->nCutsCountAll   = 0;
+    p->nCutsUselessAll = 0;
+    p->nCuts5          = 0;
+    p->nCuts5a         = 0;
+    p->nCacheHits      = 0;
+    p->nCacheMisses    = 0;
+    memset( p->nCutsUseless,  0, sizeof(p->nCutsUseless) );
+    memset( p->nCutsCount,    0, sizeof(p->nCutsCount) );
+    memset( p->timeCache,     0, sizeof(p->timeCache) );
+    memset( p->nBestCutSmall, 0, sizeof(p->nBestCutSmall) );
+    memset( p->nCountNonDec,  0, sizeof(p->nCountNonDec) );
+}
+void If_ManMappingStatsAdd( If_Man_t * p, If_Man_t * pCopy )
+{
+    int i;
+    p->nCutsCountAll   += pCopy->nCutsCountAll;
+    p->nCutsUselessAll += pCopy->nCutsUselessAll;
+    p->nCuts5          += pCopy->nCuts5;
+    p->nCuts5a         += pCopy->nCuts5a;
+    p->nCacheHits      += pCopy->nCacheHits;
+    p->nCacheMisses    += pCopy->nCacheMisses;
+    p->fReqTimeWarn    |= pCopy->fReqTimeWarn;
+    for ( i = 0; i < 32; i++ )
+    {
+        p->nCutsUseless[i] += pCopy->nCutsUseless[i];
+        p->nCutsCount[i]   += pCopy->nCutsCount[i];
+    }
+    for ( i = 0; i < 6; i++ )
+        p->timeCache[i] += pCopy->timeCache[i];
+    for ( i = 0; i < 2; i++ )
+    {
+        p->nBestCutSmall[i] += pCopy->nBestCutSmall[i];
+        p->nCountNonDec[i]  += pCopy->nCountNonDec[i];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass level by level using several threads.]
+
+  Description [The nodes of each level are prepared in the topological 
+  order, their cuts are computed in parallel, and the selected cuts are 
+  referenced in the topological order. In the delay mode, the result is 
+  the same as that of the sequential pass. In the area-flow mode, the 
+  result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingLevels( If_Man_t * p, int Mode, int fPreprocess, int fFirst, char * pLabel )
+{
+    ProgressBar * pProgress;
+    If_ThData_t * pThData;
+    Util_Pool_t * pPool;
+    Util_Task_t ** ppTasks;
+    Vec_Int_t * vLevel;
+    int nProcs = p->pPars->nProcs;
+    int i, k, Id, nThreads, nDone = 0;
+    // the calling thread computes the first share of each level
+    pPool    = Util_PoolGlobal( nProcs - 1 );
+    pThData  = ABC_CALLOC( If_ThData_t, nProcs );
+    ppTasks  = ABC_CALLOC( Util_Task_t *, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].Man         = *p;
+        pThData[i].iThread     = i;
+        pThData[i].Mode        = Mode;
+        pThData[i].fPreprocess = fPreprocess;
+        pThData[i].fFirst      = fFirst;
+        If_ManMappingStatsClean( &pThData[i].Man );
+    }
+    pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
+    Vec_WecForEachLevel( p->vLevels, vLevel, k )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        nDone += Vec_IntSize(vLevel);
+        Extra_ProgressBarUpdate( pProgress, nDone, pLabel );
+        // prepare the nodes
+        Vec_IntForEachEntry( vLevel, Id, i )
+            If_ObjPrepareMappingAnd( p, If_ManObj(p, Id), Mode );
+        // compute the cuts
+        nThreads = Abc_MaxInt( 1, Abc_MinInt(nProcs, Vec_IntSize(vLevel) / IF_THREAD_NODES_MIN) );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            pThData[i].vLevel   = vLevel;
+            pThData[i].nThreads = nThreads;
+        }
+        for ( i = 1; i < nThreads; i++ )
+            ppTasks[i] = Util_PoolSubmit( pPool, If_ManMappingWorker, (void *)(pThData + i) );  
+        If_ManMappingWorker( pThData );
+        for ( i = 1; i < nThreads; i++ )
+        {
+            Util_TaskWait( ppTasks[i] );
+            Util_TaskFree( ppTasks[i] );
+            ppTasks[i] = NULL;
+        }
+        // finalize the nodes
+        Vec_IntForEachEntry( vLevel, Id, i )
+            If_ObjFinishMappingAnd( p, If_ManObj(p, Id), Mode );
+    }
+    Extra_ProgressBarStop( pProgress );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        p->nCutsMerged += pThData[i].nCutsMerged;
+        p->nCutsTotal  += pThData[i].nCutsMerged;
+        If_ManMappingStatsAdd( p, &pThData[i].Man );
+    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( pThData );
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -637,6 +889,10 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+#ifdef ABC_USE_PTHREADS
+    else if ( p->vLevels && Mode < 2 )
+        If_ManPerformMappingLevels( p, Mode, fPreprocess, fFirst, pLabel );
+#endif
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
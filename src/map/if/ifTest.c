@@ -20,17 +20,7 @@
 
 #include "if.h"
 #include "aig/gia/gia.h"
-
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
-#endif
-
-#endif
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -205,41 +195,25 @@ Vec_Int_t * Gia_ManCreateFaninCounts( Gia_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 100
 typedef struct Par_ThData_t_
 {
     Gia_Man_t * p;
     int         Id;
-    int         Status;
 } Par_ThData_t;
-void * Gia_ParWorkerThread( void * pArg )
+int Gia_ParWorkerTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->Status;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->Status == 1 );
-        if ( pThData->Id == -1 )
-        {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        assert( pThData->Id >= 0 );
-        Gia_ParTestSimulateObj( pThData->p, pThData->Id );
-        pThData->Status = 0;
-    }
-	assert( 0 );
-	return NULL;
+    assert( pThData->Id >= 0 );
+    Gia_ParTestSimulateObj( pThData->p, pThData->Id );
+    return 1;
 }
 void Gia_ParTestSimulate2( Gia_Man_t * p, int nWords, int nProcs )
 {
-	pthread_t WorkerThread[PAR_THR_MAX];
-    Par_ThData_t ThData[PAR_THR_MAX];
+    Util_Pool_t * pPool = Util_PoolGlobal( nProcs );
+    Util_Task_t ** ppTasks = ABC_CALLOC( Util_Task_t *, nProcs );
+    Par_ThData_t * ThData = ABC_CALLOC( Par_ThData_t, nProcs );
     Vec_Int_t * vStack, * vFanins;
-    int i, k, iFan, status, nCountFanins;
-    assert( nProcs <= PAR_THR_MAX );
+    int i, k, iFan, nCountFanins;
     Gia_ManRandom( 1 );
     Gia_ParTestAlloc( p, nWords );
     Gia_ParTestSimulateInit( p );
@@ -251,39 +225,34 @@ void Gia_ParTestSimulate2( Gia_Man_t * p, int nWords, int nProcs )
     Gia_ManStaticFanoutStart( p );
     vFanins = Gia_ManCreateFaninCounts( p );
     nCountFanins = Vec_IntSum(vFanins);
-    // start the threads
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].p = p;
         ThData[i].Id = -1;
-        ThData[i].Status = 0;
-        status = pthread_create( WorkerThread + i, NULL, Gia_ParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
-    while ( nCountFanins > 0 || Vec_IntSize(vStack) > 0 )
+    while ( 1 )
     {
-        for ( i = 0; i < nProcs; i++ )
+        for ( i = 0; i < nProcs && Vec_IntSize(vStack) > 0; i++ )
         {
-            if ( ThData[i].Status )
+            if ( ppTasks[i] != NULL )
                 continue;
-            assert( ThData[i].Status == 0 );
-            if ( ThData[i].Id >= 0 )
-            {
-                Gia_ObjForEachFanoutStaticId( p, ThData[i].Id, iFan, k )
-                {
-                    assert( Vec_IntEntry(vFanins, iFan) > 0 );
-                    if ( Vec_IntAddToEntry(vFanins, iFan, -1) == 0 )
-                        Vec_IntPush( vStack, iFan );
-                    assert( nCountFanins > 0 );
-                    nCountFanins--;
-                }
-                ThData[i].Id = -1;
-            }
-            if ( Vec_IntSize(vStack) > 0 )
-            {
-                ThData[i].Id = Vec_IntPop( vStack );
-                ThData[i].Status = 1;
-            }
+            ThData[i].Id = Vec_IntPop( vStack );
+            ppTasks[i] = Util_PoolSubmit( pPool, Gia_ParWorkerTask, ThData + i );
         }
+        i = Util_TaskWaitAny( ppTasks, nProcs );
+        if ( i == -1 )
+            break;
+        Util_TaskFree( ppTasks[i] );
+        ppTasks[i] = NULL;
+        Gia_ObjForEachFanoutStaticId( p, ThData[i].Id, iFan, k )
+        {
+            assert( Vec_IntEntry(vFanins, iFan) > 0 );
+            if ( Vec_IntAddToEntry(vFanins, iFan, -1) == 0 )
+                Vec_IntPush( vStack, iFan );
+            assert( nCountFanins > 0 );
+            nCountFanins--;
+        }
+        ThData[i].Id = -1;
     }
     Vec_IntForEachEntry( vFanins, iFan, k )
         if ( iFan != 0 )
@@ -292,21 +261,8 @@ void Gia_ParTestSimulate2( Gia_Man_t * p, int nWords, int nProcs )
             Gia_ObjPrint( p, Gia_ManObj(p, k) );
         }
 //    assert( Vec_IntSum(vFanins) == 0 );
-    // stop the threads
-    while ( 1 )
-    {
-        for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].Status )
-                break;
-        if ( i == nProcs )
-            break;
-    }
-    for ( i = 0; i < nProcs; i++ )
-    {
-        assert( ThData[i].Status == 0 );
-        ThData[i].Id = -1;
-        ThData[i].Status = 1;
-    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( ThData );
     Gia_ManStaticFanoutStop( p );
     Vec_IntFree( vStack );
     Vec_IntFree( vFanins );
@@ -349,6 +349,73 @@ int If_ManCrossCut( If_Man_t * p )
     return nCutSizeMax;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects AND nodes by logic level.]
+
+  Description [Within each level, the nodes are in the topological order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * If_ManCollectLevels( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels;
+    If_Obj_t * pObj;
+    int i;
+    vLevels = Vec_WecStart( p->nLevelMax + 1 );
+    If_ManForEachNode( p, pObj, i )
+    {
+        assert( If_ObjLevel(pObj) > 0 && If_ObjLevel(pObj) <= p->nLevelMax );
+        Vec_WecPush( vLevels, If_ObjLevel(pObj), pObj->Id );
+    }
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cross-cut of the circuit traversed level by level.]
+
+  Description [The cutsets of all nodes of one level are fetched before 
+  the cutsets of their fanins are recycled.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutLevels( If_Man_t * p, Vec_Wec_t * vLevels )
+{
+    Vec_Int_t * vLevel;
+    If_Obj_t * pObj, * pFanin;
+    int i, k, Id, nCutSize = 0, nCutSizeMax = 0;
+    Vec_WecForEachLevel( vLevels, vLevel, k )
+    {
+        // consider the nodes
+        nCutSize += Vec_IntSize(vLevel);
+        nCutSizeMax = Abc_MaxInt( nCutSizeMax, nCutSize );
+        Vec_IntForEachEntry( vLevel, Id, i )
+        {
+            pObj = If_ManObj( p, Id );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            // consider the fanins
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    return nCutSizeMax;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the reverse topological order of nodes.]
@@ -564,7 +564,7 @@ int Ifd_ManFindDsd_rec( Ifd_Man_t * pMan, char * pStr, char ** p, int * pMatches
 #define IFM_MAX_VAR   16
 int * Ifd_ManComputeMatches( char * p )
 {
-    static int pMatches[IFM_MAX_STR];
+    static ABC_THREAD_LOCAL int pMatches[IFM_MAX_STR];
     int pNested[IFM_MAX_VAR];
     int v, nNested = 0;
     for ( v = 0; p[v]; v++ )
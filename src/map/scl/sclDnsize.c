@@ -108,30 +108,28 @@ int Abc_SclCheckImprovement( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vNodes, V
     abctime clk;
 clk = Abc_Clock();
 //    printf( "%d -> %d\n", Vec_IntSize(vNodes), Vec_IntSize(vEvals) );
-    // save old gate, timing, fanin load
+    // save old timing
     pCellOld = Abc_SclObjCell( pObj );
-    Abc_SclConeStore( p, vNodes );
     Abc_SclEvalStore( p, vEvals );
-    Abc_SclLoadStore( p, pObj );
-    // try different gate sizes for this node
-    gateBest = -1;
-    dGainBest = -DelayGap;
+    // collect different gate sizes for this node
+    Vec_PtrClear( p->vCellsB );
     SC_RingForEachCellRev( pCellOld, pCellNew, i )
     {
         if ( pCellNew->area >= pCellOld->area )
             continue;
         if ( i > Notches )
             break;
-        // set new cell
-        Abc_SclObjSetCell( pObj, pCellNew );
-        Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
-        // recompute timing
-        Abc_SclTimeCone( p, vNodes );
-        // set old cell
-        Abc_SclObjSetCell( pObj, pCellOld );
-        Abc_SclLoadRestore( p, pObj );
+        Vec_PtrPush( p->vCellsB, pCellNew );
+    }
+    // recompute timing for all of them together
+    Abc_SclTimeConeBatch( p, pObj, p->vCellsB, vNodes, vEvals, p->vTimesB );
+    // try different gate sizes for this node
+    gateBest = -1;
+    dGainBest = -DelayGap;
+    Vec_PtrForEachEntry( SC_Cell *, p->vCellsB, pCellNew, i )
+    {
         // evaluate gain
-        dGain = Abc_SclEvalPerformLegal( p, vEvals, p->MaxDelay0 );
+        dGain = Abc_SclEvalPerformLegalBatch( p, vEvals, i, p->MaxDelay0 );
         if ( dGain == -1 )
             continue;
         // save best gain
@@ -141,9 +139,6 @@ clk = Abc_Clock();
             gateBest = pCellNew->Id;
         }
     } 
-    // put back old cell and timing
-    Abc_SclObjSetCell( pObj, pCellOld );
-    Abc_SclConeRestore( p, vNodes );
 p->timeSize += Abc_Clock() - clk;
     if ( gateBest >= 0 )
     {
@@ -260,7 +255,7 @@ void Abc_SclDnsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     }
 
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, pPars->DelayUser, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, pPars->DelayUser, pPars->BuffTreeEst, pPars->nProcs );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
@@ -41,6 +41,7 @@ ABC_NAMESPACE_HEADER_START
 ////////////////////////////////////////////////////////////////////////
 
 #define ABC_SCL_CUR_VERSION 8
+#define ABC_SCL_IMG_VERSION 1   // the version of the memory-mapped library image
 
 typedef enum  
 {
@@ -85,6 +86,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads for timing recomputation
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -211,6 +213,8 @@ struct SC_Cell_
     SC_Cell *      pAve;           // average size cell of this class
     int            Order;          // order of the gate in the list
     int            nGates;         // the number of gates in the list      
+    char *         pImage;         // library image with the timing tables, until they are loaded
+    int            iImage;         // the offset of the cell in the image
 };
 
 struct SC_Lib_ 
@@ -230,6 +234,9 @@ struct SC_Lib_
     Vec_Ptr_t      vCellClasses;   // NamedSet<SC_Cell>
     int *          pBins;          // hashing gateName -> gateId
     int            nBins;
+    char *         pImage;         // library image this library was read from
+    size_t         nImage;         // the size of the image
+    int            fImageMap;      // the image is memory-mapped rather than allocated
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -436,6 +443,7 @@ static inline void Abc_SclCellFree( SC_Cell * p )
     ABC_FREE( p->pName );
     ABC_FREE( p );
 }
+extern void Abc_SclImageFree( SC_Lib * p );
 static inline void Abc_SclLibFree( SC_Lib * p )
 {
     SC_WireLoad * pWL;
@@ -461,6 +469,8 @@ static inline void Abc_SclLibFree( SC_Lib * p )
     ABC_FREE( p->default_wire_load );
     ABC_FREE( p->default_wire_load_sel );
     ABC_FREE( p->pBins );
+    if ( p->pImage )
+        Abc_SclImageFree( p );
     ABC_FREE( p );
 }
 
@@ -547,6 +557,108 @@ static inline void Scl_LibPinDeparture( SC_Timing * pTime, SC_Pair * pDepIn, SC_
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Lookup table delay computation for several points.]
+
+  Description [Performs the computation of Scl_LibLookup for nLanes pairs
+  of slew and load. The index search and the interpolation are done in
+  separate passes over the lanes, so that the interpolation is a straight
+  loop over the arrays.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define SC_LANES_MAX 64
+
+static inline void Scl_LibLookupBatch( SC_Surface * p, float * pSlew, float * pLoad, float * pRes, int nLanes )
+{
+    float * pIndex0 = Vec_FltArray(&p->vIndex0);
+    float * pIndex1 = Vec_FltArray(&p->vIndex1);
+    float * pDataS[SC_LANES_MAX], * pDataS1[SC_LANES_MAX];
+    float sfrac[SC_LANES_MAX], lfrac[SC_LANES_MAX], p0, p1;
+    int c, s, l, pL[SC_LANES_MAX];
+    assert( nLanes <= SC_LANES_MAX );
+    // handle constant table
+    if ( Vec_FltSize(&p->vIndex0) == 1 && Vec_FltSize(&p->vIndex1) == 1 )
+    {
+        p0 = Scl_LibLookup( p, 0, 0 );
+        for ( c = 0; c < nLanes; c++ )
+            pRes[c] = p0;
+        return;
+    }
+    // find closest sample points in surface
+    for ( c = 0; c < nLanes; c++ )
+    {
+        for ( s = 1; s < Vec_FltSize(&p->vIndex0)-1; s++ )
+            if ( pIndex0[s] > pSlew[c] )
+                break;
+        s--;
+        for ( l = 1; l < Vec_FltSize(&p->vIndex1)-1; l++ )
+            if ( pIndex1[l] > pLoad[c] )
+                break;
+        l--;
+        sfrac[c]   = (pSlew[c] - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
+        lfrac[c]   = (pLoad[c] - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
+        pDataS[c]  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s) );
+        pDataS1[c] = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s+1) );
+        pL[c]      = l;
+    }
+    // interpolate (or extrapolate) function values from sample points
+    for ( c = 0; c < nLanes; c++ )
+    {
+        p0 = pDataS [c][pL[c]] + lfrac[c] * (pDataS [c][pL[c]+1] - pDataS [c][pL[c]]);
+        p1 = pDataS1[c][pL[c]] + lfrac[c] * (pDataS1[c][pL[c]+1] - pDataS1[c][pL[c]]);
+        pRes[c] = p0 + sfrac[c] * (p1 - p0);
+    }
+}
+static inline void Scl_LibMaxBatch( float * pOut, float * pIn, float * pDelay, int nLanes )
+{
+    int c;
+    if ( pIn )
+        for ( c = 0; c < nLanes; c++ )
+            pOut[c] = Abc_MaxFloat( pOut[c], pIn[c] + pDelay[c] );
+    else
+        for ( c = 0; c < nLanes; c++ )
+            pOut[c] = Abc_MaxFloat( pOut[c], pDelay[c] );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Arrival time computation for several points.]
+
+  Description [The lanes are stored as arrays: pArrIn and pArrOut contain
+  rise times followed by fall times; pSlewIn and pSlewOut contain rise
+  slews followed by fall slews; pLoad contains rise loads followed by
+  fall loads. Each array part has nLanes entries.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Scl_LibPinArrivalBatch( SC_Timing * pTime, float * pArrIn, float * pSlewIn, float * pLoad, float * pArrOut, float * pSlewOut, int nLanes )
+{
+    float pDelay[SC_LANES_MAX];
+    int n = nLanes;
+    if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
+    {
+        Scl_LibLookupBatch( &pTime->pCellRise,  pSlewIn,     pLoad,     pDelay, n );  Scl_LibMaxBatch( pArrOut,      pArrIn,     pDelay, n );
+        Scl_LibLookupBatch( &pTime->pCellFall,  pSlewIn + n, pLoad + n, pDelay, n );  Scl_LibMaxBatch( pArrOut + n,  pArrIn + n, pDelay, n );
+        Scl_LibLookupBatch( &pTime->pRiseTrans, pSlewIn,     pLoad,     pDelay, n );  Scl_LibMaxBatch( pSlewOut,     NULL,       pDelay, n );
+        Scl_LibLookupBatch( &pTime->pFallTrans, pSlewIn + n, pLoad + n, pDelay, n );  Scl_LibMaxBatch( pSlewOut + n, NULL,       pDelay, n );
+    }
+    if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
+    {
+        Scl_LibLookupBatch( &pTime->pCellRise,  pSlewIn + n, pLoad,     pDelay, n );  Scl_LibMaxBatch( pArrOut,      pArrIn + n, pDelay, n );
+        Scl_LibLookupBatch( &pTime->pCellFall,  pSlewIn,     pLoad + n, pDelay, n );  Scl_LibMaxBatch( pArrOut + n,  pArrIn,     pDelay, n );
+        Scl_LibLookupBatch( &pTime->pRiseTrans, pSlewIn + n, pLoad,     pDelay, n );  Scl_LibMaxBatch( pSlewOut,     NULL,       pDelay, n );
+        Scl_LibLookupBatch( &pTime->pFallTrans, pSlewIn,     pLoad + n, pDelay, n );  Scl_LibMaxBatch( pSlewOut + n, NULL,       pDelay, n );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Lookup table delay computation.]
@@ -649,11 +761,24 @@ static inline void Scl_LibPinRequiredI( SC_Timing * pTime, SC_PairI * pReqIn, SC
   SeeAlso     []
 
 ***********************************************************************/
+extern void Abc_SclCellLoad( SC_Cell * pCell );
+static inline char * Scl_CellImage( SC_Cell * pCell )
+{
+    // pairs with the release store in Abc_SclCellLoad(), which clears the
+    // image pointer of the cell after its timing tables are loaded
+#if defined(__GNUC__)
+    return __atomic_load_n( &pCell->pImage, __ATOMIC_ACQUIRE );
+#else
+    return pCell->pImage;
+#endif
+}
 static inline SC_Timing * Scl_CellPinTime( SC_Cell * pCell, int iPin )
 {
     SC_Pin * pPin;
     SC_Timings * pRTime;
     assert( iPin >= 0 && iPin < pCell->n_inputs );
+    if ( Scl_CellImage(pCell) )
+        Abc_SclCellLoad( pCell );
     pPin = SC_CellPin( pCell, pCell->n_inputs );
     assert( Vec_PtrSize(&pPin->vRTimings) == pCell->n_inputs );
     pRTime = (SC_Timings *)Vec_PtrEntry( &pPin->vRTimings, iPin );
@@ -740,6 +865,11 @@ extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
+extern SC_Lib *      Abc_SclReadImage( char * pFileName );
+extern void          Abc_SclWriteImage( char * pFileName, SC_Lib * p );
+extern void          Abc_SclCellLoad( SC_Cell * pCell );
+extern void          Abc_SclLibLoad( SC_Lib * p );
+extern void          Abc_SclImageFree( SC_Lib * p );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
 /*=== sclLibUtil.c ===============================================================*/
 extern void          Abc_SclHashCells( SC_Lib * p );
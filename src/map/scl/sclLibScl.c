@@ -26,12 +26,112 @@
 #include "misc/util/utilNam.h"
 #include "map/scl/sclCon.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
+
+// The library image is a file that can be mapped into memory read-only
+// and shared by several processes. It starts with the header, followed by
+// the library fields in the SCL format, the array of cell records, and the
+// data of each cell: the pin records, the names, the truth tables, and the
+// timing arcs of the outputs with their tables. The data is referred to by
+// the offsets from the beginning of the image (offset 0 means no data).
+// When the image is read, only the cells and their pins are created, while
+// the timing tables of a cell are copied from the image when it is used.
+
+#define SCL_IMG_MAGIC  "ABCSCLI"   // the first 8 bytes of the image
+#define SCL_IMG_ENDIAN 0x01020304  // the byte order of the writer
+
+typedef struct Scl_ImgHead_t_ Scl_ImgHead_t;
+struct Scl_ImgHead_t_
+{
+    char           Magic[8];       // SCL_IMG_MAGIC
+    int            Version;        // ABC_SCL_IMG_VERSION
+    int            Endian;         // SCL_IMG_ENDIAN
+    int            nBytes;         // the size of the image
+    int            nCells;         // the number of cells
+    int            oLib;           // the library fields in the SCL format
+    int            oCells;         // the array of cell records
+};
+
+typedef struct Scl_ImgCell_t_ Scl_ImgCell_t;
+struct Scl_ImgCell_t_
+{
+    int            oName;
+    float          area;
+    float          leakage;
+    int            drive_strength;
+    int            n_inputs;
+    int            n_outputs;
+    int            oPins;          // the array of pin records
+};
+
+typedef struct Scl_ImgPin_t_ Scl_ImgPin_t;
+struct Scl_ImgPin_t_
+{
+    int            oName;
+    float          Cap[2];         // rise/fall cap (inputs) or max cap/slew (outputs)
+    int            oFunc;          // the formula (outputs)
+    int            oTruth;         // the truth table (outputs)
+    int            oArcs;          // the array of arc offsets, one for each input (outputs)
+};
+
+typedef struct Scl_ImgArc_t_ Scl_ImgArc_t;
+struct Scl_ImgArc_t_
+{
+    int            oName;          // the related pin
+    int            nTimings;       // the number of timings (0 or 1)
+    int            tsense;
+    int            oSurfs[4];      // cell rise, cell fall, rise trans, fall trans
+};
+
+// the surface record is followed by the indexes and the table rows
+typedef struct Scl_ImgSurf_t_ Scl_ImgSurf_t;
+struct Scl_ImgSurf_t_
+{
+    int            nIndex0;
+    int            nIndex1;
+    float          approx[3][6];
+};
+
+static inline void * Scl_ImgEntry( Vec_Str_t * vOut, int Offset ) { return Vec_StrArray(vOut) + Offset; }
+
+// the timing tables of a cell are loaded at most once under the mutex, even
+// if the cells are used by several threads; the cell is published after it
+// is loaded by clearing its image pointer with a release store, which the
+// readers load with acquire (see Scl_CellImage)
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_SclImgMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+#if defined(__GNUC__)
+#define SCL_IMG_PUBLISH(pCell) __atomic_store_n( &(pCell)->pImage, NULL, __ATOMIC_RELEASE )
+#else
+#define SCL_IMG_PUBLISH(pCell) ((pCell)->pImage = NULL)
+#endif
+
+// the largest number of cell inputs accepted in an image (the truth table
+// of a cell with more inputs would take more than 64 MB)
+#define SCL_IMG_INPUT_MAX 29
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -231,9 +331,9 @@ static void Abc_SclReadSurface( Vec_Str_t * vOut, int * pPos, SC_Surface * p )
     for ( i = 0; i < 6; i++ ) 
         p->approx[2][i] = Vec_StrGetF( vOut, pPos );
 }
-static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
+static int Abc_SclReadLibraryHead( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
 {
-    int i, j, k, n;
+    int i, j;
     int version = Vec_StrGetI( vOut, pPos );
     if ( version != ABC_SCL_CUR_VERSION )
     { 
@@ -283,6 +383,13 @@ static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
             Vec_PtrPush( &pWLS->vWireLoadModel, Vec_StrGetS(vOut, pPos) );
         }
     }
+    return 1;
+}
+static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
+{
+    int i, j, k, n;
+    if ( !Abc_SclReadLibraryHead( vOut, pPos, p ) )
+        return 0;
 
     for ( i = Vec_StrGetI(vOut, pPos); i != 0; i-- )
     {
@@ -336,7 +443,6 @@ static int Abc_SclReadLibrary( Vec_Str_t * vOut, int * pPos, SC_Lib * p )
 
             // read function
             // (possibly empty) formula is always given
-            assert( version == ABC_SCL_CUR_VERSION );
             assert( pPin->func_text == NULL );
             pPin->func_text = Vec_StrGetS(vOut, pPos); 
             if ( pPin->func_text[0] == 0 )
@@ -420,12 +526,19 @@ SC_Lib * Abc_SclReadFromFile( char * pFileName )
     FILE * pFile;
     Vec_Str_t * vOut;
     int nFileSize;
+    char Magic[8];
     pFile = fopen( pFileName, "rb" );
     if ( pFile == NULL )
     {
         printf( "Cannot open file \"%s\" for reading.\n", pFileName );
         return NULL;
     }
+    // check if this is the library image
+    if ( fread( Magic, 1, 8, pFile ) == 8 && !memcmp( Magic, SCL_IMG_MAGIC, 8 ) )
+    {
+        fclose( pFile );
+        return Abc_SclReadImage( pFileName );
+    }
     // get the file size, in bytes
     fseek( pFile, 0, SEEK_END );  
     nFileSize = ftell( pFile );  
@@ -483,14 +596,11 @@ static void Abc_SclWriteSurface( Vec_Str_t * vOut, SC_Surface * p )
     for ( i = 0; i < 6; i++ ) 
         Vec_StrPutF( vOut, p->approx[2][i] );
 }
-static void Abc_SclWriteLibrary( Vec_Str_t * vOut, SC_Lib * p )
+static void Abc_SclWriteLibraryHead( Vec_Str_t * vOut, SC_Lib * p )
 {
     SC_WireLoad * pWL;
     SC_WireLoadSel * pWLS;
-    SC_Cell * pCell;
-    SC_Pin * pPin;
-    int n_valid_cells;
-    int i, j, k;
+    int i, j;
 
     Vec_StrPutI( vOut, ABC_SCL_CUR_VERSION );
 
@@ -535,6 +645,15 @@ static void Abc_SclWriteLibrary( Vec_Str_t * vOut, SC_Lib * p )
             Vec_StrPutS( vOut, (char *)Vec_PtrEntry(&pWLS->vWireLoadModel, j) );
         }
     }
+}
+static void Abc_SclWriteLibrary( Vec_Str_t * vOut, SC_Lib * p )
+{
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    int n_valid_cells;
+    int i, j, k;
+
+    Abc_SclWriteLibraryHead( vOut, p );
 
     // Write 'cells' vector:
     n_valid_cells = 0;
@@ -613,6 +732,7 @@ static void Abc_SclWriteLibrary( Vec_Str_t * vOut, SC_Lib * p )
 void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
 {
     Vec_Str_t * vOut;
+    Abc_SclLibLoad( p );
     vOut = Vec_StrAlloc( 10000 );
     Abc_SclWriteLibrary( vOut, p );
     if ( Vec_StrSize(vOut) > 0 )
@@ -829,6 +949,7 @@ static void Abc_SclWriteLibraryText( FILE * s, SC_Lib * p )
 void Abc_SclWriteLiberty( char * pFileName, SC_Lib * p )
 {
     FILE * pFile = fopen( pFileName, "wb" );
+    Abc_SclLibLoad( p );
     if ( pFile == NULL )
         printf( "Cannot open text file \"%s\" for writing.\n", pFileName );
     else
@@ -839,6 +960,558 @@ void Abc_SclWriteLiberty( char * pFileName, SC_Lib * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writing library image into file.]
+
+  Description [The image is written from the library in memory, which is
+  normalized when it is read, so the image is ready to use after mapping.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SclImgAlloc( Vec_Str_t * vOut, int nBytes, int nAlign )
+{
+    int Offset;
+    while ( Vec_StrSize(vOut) % nAlign )
+        Vec_StrPush( vOut, 0 );
+    Offset = Vec_StrSize(vOut);
+    Vec_StrFillExtra( vOut, Offset + nBytes, 0 );
+    return Offset;
+}
+static int Abc_SclImgString( Vec_Str_t * vOut, char * pStr )
+{
+    int Offset = Abc_SclImgAlloc( vOut, strlen(pStr) + 1, 1 );
+    memcpy( Scl_ImgEntry(vOut, Offset), pStr, strlen(pStr) + 1 );
+    return Offset;
+}
+static int Abc_SclImgWriteSurface( Vec_Str_t * vOut, SC_Surface * p )
+{
+    Scl_ImgSurf_t * pSurf;
+    Vec_Flt_t * vVec;
+    float * pData;
+    int n0 = Vec_FltSize(&p->vIndex0);
+    int n1 = Vec_FltSize(&p->vIndex1), i;
+    int Offset = Abc_SclImgAlloc( vOut, sizeof(Scl_ImgSurf_t) + sizeof(float) * (n0 + n1 + n0 * n1), 4 );
+    assert( Vec_PtrSize(&p->vData) == n0 );
+    pSurf = (Scl_ImgSurf_t *)Scl_ImgEntry( vOut, Offset );
+    pSurf->nIndex0 = n0;
+    pSurf->nIndex1 = n1;
+    memcpy( pSurf->approx, p->approx, sizeof(p->approx) );
+    pData = (float *)(pSurf + 1);
+    for ( i = 0; i < n0; i++ )
+        *pData++ = Vec_FltEntry( &p->vIndex0, i );
+    for ( i = 0; i < n1; i++ )
+        *pData++ = Vec_FltEntry( &p->vIndex1, i );
+    Vec_PtrForEachEntry( Vec_Flt_t *, &p->vData, vVec, i )
+    {
+        assert( Vec_FltSize(vVec) == n1 );
+        memcpy( pData, Vec_FltArray(vVec), sizeof(float) * n1 );
+        pData += n1;
+    }
+    return Offset;
+}
+static int Abc_SclImgWriteArc( Vec_Str_t * vOut, SC_Timings * pRTime )
+{
+    Scl_ImgArc_t * pArc;
+    SC_Timing * pTime;
+    int oSurfs[4] = {0}, oName = 0;
+    int Offset = Abc_SclImgAlloc( vOut, sizeof(Scl_ImgArc_t), 4 );
+    if ( pRTime->pName )
+        oName = Abc_SclImgString( vOut, pRTime->pName );
+    assert( Vec_PtrSize(&pRTime->vTimings) <= 1 );
+    if ( Vec_PtrSize(&pRTime->vTimings) == 1 )
+    {
+        pTime = (SC_Timing *)Vec_PtrEntry( &pRTime->vTimings, 0 );
+        oSurfs[0] = Abc_SclImgWriteSurface( vOut, &pTime->pCellRise );
+        oSurfs[1] = Abc_SclImgWriteSurface( vOut, &pTime->pCellFall );
+        oSurfs[2] = Abc_SclImgWriteSurface( vOut, &pTime->pRiseTrans );
+        oSurfs[3] = Abc_SclImgWriteSurface( vOut, &pTime->pFallTrans );
+    }
+    // the pointers are taken after the image stops growing
+    pArc = (Scl_ImgArc_t *)Scl_ImgEntry( vOut, Offset );
+    pArc->oName    = oName;
+    pArc->nTimings = Vec_PtrSize(&pRTime->vTimings);
+    pArc->tsense   = pArc->nTimings ? (int)((SC_Timing *)Vec_PtrEntry(&pRTime->vTimings, 0))->tsense : 0;
+    memcpy( pArc->oSurfs, oSurfs, sizeof(oSurfs) );
+    return Offset;
+}
+static void Abc_SclImgWritePin( Vec_Str_t * vOut, SC_Cell * pCell, SC_Pin * pPin, int oPin )
+{
+    Scl_ImgPin_t * pImgPin;
+    SC_Timings * pRTime;
+    int oName = Abc_SclImgString( vOut, pPin->pName );
+    int oFunc = 0, oTruth = 0, oArcs = 0, oArc, k;
+    if ( pPin->dir == sc_dir_Output )
+    {
+        if ( pPin->func_text && pPin->func_text[0] )
+            oFunc = Abc_SclImgString( vOut, pPin->func_text );
+        assert( Vec_WrdSize(&pPin->vFunc) == Abc_Truth6WordNum(pCell->n_inputs) );
+        oTruth = Abc_SclImgAlloc( vOut, sizeof(word) * Vec_WrdSize(&pPin->vFunc), 8 );
+        memcpy( Scl_ImgEntry(vOut, oTruth), Vec_WrdArray(&pPin->vFunc), sizeof(word) * Vec_WrdSize(&pPin->vFunc) );
+        assert( Vec_PtrSize(&pPin->vRTimings) == pCell->n_inputs );
+        oArcs = Abc_SclImgAlloc( vOut, sizeof(int) * pCell->n_inputs, 4 );
+        SC_PinForEachRTiming( pPin, pRTime, k )
+        {
+            oArc = Abc_SclImgWriteArc( vOut, pRTime );
+            ((int *)Scl_ImgEntry(vOut, oArcs))[k] = oArc;
+        }
+    }
+    pImgPin = (Scl_ImgPin_t *)Scl_ImgEntry( vOut, oPin );
+    pImgPin->oName  = oName;
+    pImgPin->Cap[0] = pPin->dir == sc_dir_Output ? pPin->max_out_cap  : pPin->rise_cap;
+    pImgPin->Cap[1] = pPin->dir == sc_dir_Output ? pPin->max_out_slew : pPin->fall_cap;
+    pImgPin->oFunc  = oFunc;
+    pImgPin->oTruth = oTruth;
+    pImgPin->oArcs  = oArcs;
+}
+static void Abc_SclImgWriteLibrary( Vec_Str_t * vOut, SC_Lib * p )
+{
+    Vec_Str_t * vLib = Vec_StrAlloc( 1000 );
+    Scl_ImgHead_t * pHead;
+    Scl_ImgCell_t * pImgCell;
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    int i, k, oName, oPins, oLib, oCells, nCells = 0;
+    SC_LibForEachCell( p, pCell, i )
+        if ( !(pCell->seq || pCell->unsupp) )
+            nCells++;
+    Abc_SclImgAlloc( vOut, sizeof(Scl_ImgHead_t), 8 );
+    // the library fields
+    Abc_SclWriteLibraryHead( vLib, p );
+    oLib = Abc_SclImgAlloc( vOut, Vec_StrSize(vLib), 4 );
+    memcpy( Scl_ImgEntry(vOut, oLib), Vec_StrArray(vLib), Vec_StrSize(vLib) );
+    Vec_StrFree( vLib );
+    // the cells
+    oCells = Abc_SclImgAlloc( vOut, sizeof(Scl_ImgCell_t) * nCells, 4 );
+    nCells = 0;
+    SC_LibForEachCell( p, pCell, i )
+    {
+        if ( pCell->seq || pCell->unsupp )
+            continue;
+        oName = Abc_SclImgString( vOut, pCell->pName );
+        oPins = Abc_SclImgAlloc( vOut, sizeof(Scl_ImgPin_t) * Vec_PtrSize(&pCell->vPins), 4 );
+        SC_CellForEachPin( pCell, pPin, k )
+            Abc_SclImgWritePin( vOut, pCell, pPin, oPins + sizeof(Scl_ImgPin_t) * k );
+        pImgCell = (Scl_ImgCell_t *)Scl_ImgEntry( vOut, oCells ) + nCells++;
+        pImgCell->oName          = oName;
+        pImgCell->area           = pCell->area;
+        pImgCell->leakage        = pCell->leakage;
+        pImgCell->drive_strength = pCell->drive_strength;
+        pImgCell->n_inputs       = pCell->n_inputs;
+        pImgCell->n_outputs      = pCell->n_outputs;
+        pImgCell->oPins          = oPins;
+    }
+    // the header
+    pHead = (Scl_ImgHead_t *)Scl_ImgEntry( vOut, 0 );
+    memcpy( pHead->Magic, SCL_IMG_MAGIC, 8 );
+    pHead->Version = ABC_SCL_IMG_VERSION;
+    pHead->Endian  = SCL_IMG_ENDIAN;
+    pHead->nBytes  = Vec_StrSize(vOut);
+    pHead->nCells  = nCells;
+    pHead->oLib    = oLib;
+    pHead->oCells  = oCells;
+}
+void Abc_SclWriteImage( char * pFileName, SC_Lib * p )
+{
+    Vec_Str_t * vOut;
+    FILE * pFile;
+    Abc_SclLibLoad( p );
+    vOut = Vec_StrAlloc( 1 << 16 );
+    Abc_SclImgWriteLibrary( vOut, p );
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+    else
+    {
+        fwrite( Vec_StrArray(vOut), 1, Vec_StrSize(vOut), pFile );
+        fclose( pFile );
+    }
+    Vec_StrFree( vOut );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reading library image from file.]
+
+  Description [Maps the image into memory, or reads it if mapping is not
+  available, and creates the cells with their pins. The timing tables
+  stay in the image until the cell is used. All offsets of the image,
+  including those of the timing tables, are checked against its size
+  before the cells are created.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_SclImgFits( size_t nImage, int Offset, size_t nEntries, size_t nEntrySize, int Align )
+{
+    if ( Offset <= 0 || Offset % Align || (size_t)Offset > nImage )
+        return 0;
+    return nEntries <= (nImage - (size_t)Offset) / nEntrySize;
+}
+static inline int Abc_SclImgFitsStr( char * pImage, size_t nImage, int Offset )
+{
+    return Abc_SclImgFits( nImage, Offset, 1, 1, 1 ) && memchr( pImage + Offset, 0, nImage - (size_t)Offset ) != NULL;
+}
+static int Abc_SclImgCheckSurf( char * pImage, size_t nImage, int Offset )
+{
+    Scl_ImgSurf_t * pSurf;
+    size_t nMax = nImage / sizeof(float);
+    if ( !Abc_SclImgFits( nImage, Offset, 1, sizeof(Scl_ImgSurf_t), 4 ) )
+        return 0;
+    pSurf = (Scl_ImgSurf_t *)(pImage + Offset);
+    if ( pSurf->nIndex0 < 0 || pSurf->nIndex1 < 0 || (size_t)pSurf->nIndex0 > nMax || (size_t)pSurf->nIndex1 > nMax )
+        return 0;
+    if ( pSurf->nIndex0 > 0 && (size_t)pSurf->nIndex1 > nMax / pSurf->nIndex0 )
+        return 0;
+    return Abc_SclImgFits( nImage, Offset + (int)sizeof(Scl_ImgSurf_t), (size_t)pSurf->nIndex0 + pSurf->nIndex1 + (size_t)pSurf->nIndex0 * pSurf->nIndex1, sizeof(float), 4 );
+}
+static int Abc_SclImgCheckCell( char * pImage, size_t nImage, Scl_ImgCell_t * pImgCell )
+{
+    Scl_ImgPin_t * pImgPin;
+    Scl_ImgArc_t * pArc;
+    int * pArcs;
+    int j, k, s, nPins;
+    if ( !Abc_SclImgFitsStr( pImage, nImage, pImgCell->oName ) )
+        return 0;
+    if ( pImgCell->n_inputs < 0 || pImgCell->n_inputs > SCL_IMG_INPUT_MAX || pImgCell->n_outputs < 0 )
+        return 0;
+    if ( (size_t)pImgCell->n_outputs > nImage / sizeof(Scl_ImgPin_t) )
+        return 0;
+    nPins = pImgCell->n_inputs + pImgCell->n_outputs;
+    if ( !Abc_SclImgFits( nImage, pImgCell->oPins, nPins, sizeof(Scl_ImgPin_t), 4 ) )
+        return 0;
+    pImgPin = (Scl_ImgPin_t *)(pImage + pImgCell->oPins);
+    for ( j = 0; j < nPins; j++, pImgPin++ )
+    {
+        if ( !Abc_SclImgFitsStr( pImage, nImage, pImgPin->oName ) )
+            return 0;
+        if ( j < pImgCell->n_inputs )
+            continue;
+        if ( pImgPin->oFunc && !Abc_SclImgFitsStr( pImage, nImage, pImgPin->oFunc ) )
+            return 0;
+        if ( !Abc_SclImgFits( nImage, pImgPin->oTruth, Abc_Truth6WordNum(pImgCell->n_inputs), sizeof(word), 8 ) )
+            return 0;
+        if ( !Abc_SclImgFits( nImage, pImgPin->oArcs, pImgCell->n_inputs, sizeof(int), 4 ) )
+            return 0;
+        pArcs = (int *)(pImage + pImgPin->oArcs);
+        for ( k = 0; k < pImgCell->n_inputs; k++ )
+        {
+            if ( !Abc_SclImgFits( nImage, pArcs[k], 1, sizeof(Scl_ImgArc_t), 4 ) )
+                return 0;
+            pArc = (Scl_ImgArc_t *)(pImage + pArcs[k]);
+            if ( pArc->oName && !Abc_SclImgFitsStr( pImage, nImage, pArc->oName ) )
+                return 0;
+            if ( pArc->nTimings == 0 )
+                continue;
+            if ( pArc->nTimings != 1 || pArc->tsense < sc_ts_NULL || pArc->tsense > sc_ts_Non )
+                return 0;
+            for ( s = 0; s < 4; s++ )
+                if ( !Abc_SclImgCheckSurf( pImage, nImage, pArc->oSurfs[s] ) )
+                    return 0;
+        }
+    }
+    return 1;
+}
+static int Abc_SclImgCheck( char * pImage, size_t nImage )
+{
+    Scl_ImgHead_t * pHead = (Scl_ImgHead_t *)pImage;
+    int i;
+    if ( nImage < sizeof(Scl_ImgHead_t) || memcmp(pHead->Magic, SCL_IMG_MAGIC, 8) )
+    {
+        Abc_Print( -1, "The file is not an SCL library image.\n" );
+        return 0;
+    }
+    if ( pHead->Version != ABC_SCL_IMG_VERSION )
+    {
+        Abc_Print( -1, "Wrong version of the SCL library image.\n" );
+        return 0;
+    }
+    if ( pHead->Endian != SCL_IMG_ENDIAN )
+    {
+        Abc_Print( -1, "The SCL library image was written on a platform with a different byte order.\n" );
+        return 0;
+    }
+    if ( (size_t)pHead->nBytes != nImage )
+    {
+        Abc_Print( -1, "The SCL library image is truncated.\n" );
+        return 0;
+    }
+    if ( pHead->nCells < 0 || pHead->oLib <= 0 || pHead->oLib >= pHead->oCells || 
+         !Abc_SclImgFits( nImage, pHead->oCells, pHead->nCells, sizeof(Scl_ImgCell_t), 4 ) )
+    {
+        Abc_Print( -1, "The SCL library image is corrupted.\n" );
+        return 0;
+    }
+    for ( i = 0; i < pHead->nCells; i++ )
+        if ( !Abc_SclImgCheckCell( pImage, nImage, (Scl_ImgCell_t *)(pImage + pHead->oCells) + i ) )
+        {
+            Abc_Print( -1, "The SCL library image is corrupted (cell %d).\n", i );
+            return 0;
+        }
+    return 1;
+}
+static SC_Lib * Abc_SclImgReadLibrary( char * pImage, size_t nImage )
+{
+    Scl_ImgHead_t * pHead = (Scl_ImgHead_t *)pImage;
+    Scl_ImgCell_t * pImgCell;
+    Scl_ImgPin_t * pImgPin;
+    Vec_Str_t vLib;
+    SC_Lib * p;
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    word * pTruth;
+    int i, j, k, Pos = 0;
+    if ( !Abc_SclImgCheck( pImage, nImage ) )
+        return NULL;
+    // the library fields
+    vLib.nCap   = vLib.nSize = pHead->oCells - pHead->oLib;
+    vLib.pArray = pImage + pHead->oLib;
+    p = Abc_SclLibAlloc();
+    if ( !Abc_SclReadLibraryHead( &vLib, &Pos, p ) )
+    {
+        Abc_SclLibFree( p );
+        return NULL;
+    }
+    // the cells without the timing tables
+    pImgCell = (Scl_ImgCell_t *)(pImage + pHead->oCells);
+    for ( i = 0; i < pHead->nCells; i++, pImgCell++ )
+    {
+        pCell = Abc_SclCellAlloc();
+        pCell->Id = SC_LibCellNum(p);
+        Vec_PtrPush( &p->vCells, pCell );
+
+        pCell->pName          = Abc_UtilStrsav( pImage + pImgCell->oName );
+        pCell->area           = pImgCell->area;
+        pCell->leakage        = pImgCell->leakage;
+        pCell->drive_strength = pImgCell->drive_strength;
+
+        pCell->n_inputs       = pImgCell->n_inputs;
+        pCell->n_outputs      = pImgCell->n_outputs;
+
+        pCell->areaI          = Scl_Flt2Int(pCell->area);
+        pCell->leakageI       = Scl_Flt2Int(pCell->leakage);
+
+        pCell->pImage         = pImage;
+        pCell->iImage         = (char *)pImgCell - pImage;
+
+        pImgPin = (Scl_ImgPin_t *)(pImage + pImgCell->oPins);
+        for ( j = 0; j < pCell->n_inputs + pCell->n_outputs; j++, pImgPin++ )
+        {
+            pPin = Abc_SclPinAlloc();
+            Vec_PtrPush( &pCell->vPins, pPin );
+            pPin->pName = Abc_UtilStrsav( pImage + pImgPin->oName );
+            if ( j < pCell->n_inputs )
+            {
+                pPin->dir       = sc_dir_Input;
+                pPin->rise_cap  = pImgPin->Cap[0];
+                pPin->fall_cap  = pImgPin->Cap[1];
+                pPin->rise_capI = Scl_Flt2Int(pPin->rise_cap);
+                pPin->fall_capI = Scl_Flt2Int(pPin->fall_cap);
+                continue;
+            }
+            pPin->dir          = sc_dir_Output;
+            pPin->max_out_cap  = pImgPin->Cap[0];
+            pPin->max_out_slew = pImgPin->Cap[1];
+            if ( pImgPin->oFunc )
+                pPin->func_text = Abc_UtilStrsav( pImage + pImgPin->oFunc );
+            pTruth = (word *)(pImage + pImgPin->oTruth);
+            Vec_WrdGrow( &pPin->vFunc, Abc_Truth6WordNum(pCell->n_inputs) );
+            for ( k = 0; k < Vec_WrdCap(&pPin->vFunc); k++ )
+                Vec_WrdPush( &pPin->vFunc, pTruth[k] );
+        }
+    }
+    // hash gates by name
+    Abc_SclHashCells( p );
+    Abc_SclLinkCells( p );
+    return p;
+}
+SC_Lib * Abc_SclReadImage( char * pFileName )
+{
+    SC_Lib * p;
+    FILE * pFile;
+    char * pImage = NULL;
+    size_t nImage = 0;
+    int fImageMap = 0;
+#ifndef _WIN32
+    // map the file, so that its pages are shared by the processes reading it
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd != -1 && fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+    {
+        void * pMap = mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+        if ( pMap != MAP_FAILED )
+        {
+            pImage    = (char *)pMap;
+            nImage    = (size_t)Stat.st_size;
+            fImageMap = 1;
+        }
+    }
+    if ( fd != -1 )
+        close( fd );
+#endif
+    if ( pImage == NULL )
+    {
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+        {
+            printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+            return NULL;
+        }
+        fseek( pFile, 0, SEEK_END );  
+        nImage = ftell( pFile );  
+        rewind( pFile ); 
+        pImage = ABC_ALLOC( char, nImage );
+        nImage = fread( pImage, 1, nImage, pFile );
+        fclose( pFile );
+    }
+    p = Abc_SclImgReadLibrary( pImage, nImage );
+    if ( p == NULL )
+    {
+#ifndef _WIN32
+        if ( fImageMap )
+            munmap( pImage, nImage );
+        else
+#endif
+        ABC_FREE( pImage );
+        return NULL;
+    }
+    p->pImage    = pImage;
+    p->nImage    = nImage;
+    p->fImageMap = fImageMap;
+    p->pFileName = Abc_UtilStrsav( pFileName );
+    Abc_SclLibNormalize( p );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the timing tables of the cell from the image.]
+
+  Description [Is called when the timing of the cell is used for the first
+  time. The second procedure loads all cells.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclImgReadSurface( char * pImage, int Offset, SC_Surface * p )
+{
+    Scl_ImgSurf_t * pSurf = (Scl_ImgSurf_t *)(pImage + Offset);
+    float * pData = (float *)(pSurf + 1);
+    Vec_Flt_t * vVec;
+    Vec_Int_t * vVecI;
+    int i, j;
+    for ( i = 0; i < pSurf->nIndex0; i++, pData++ )
+    {
+        Vec_FltPush( &p->vIndex0, *pData );
+        Vec_IntPush( &p->vIndex0I, Scl_Flt2Int(*pData) );
+    }
+    for ( i = 0; i < pSurf->nIndex1; i++, pData++ )
+    {
+        Vec_FltPush( &p->vIndex1, *pData );
+        Vec_IntPush( &p->vIndex1I, Scl_Flt2Int(*pData) );
+    }
+    for ( i = 0; i < pSurf->nIndex0; i++ )
+    {
+        vVec = Vec_FltAlloc( pSurf->nIndex1 );
+        Vec_PtrPush( &p->vData, vVec );
+        vVecI = Vec_IntAlloc( pSurf->nIndex1 );
+        Vec_PtrPush( &p->vDataI, vVecI );
+        for ( j = 0; j < pSurf->nIndex1; j++, pData++ )
+        {
+            Vec_FltPush( vVec, *pData );
+            Vec_IntPush( vVecI, Scl_Flt2Int(*pData) );
+        }
+    }
+    memcpy( p->approx, pSurf->approx, sizeof(p->approx) );
+}
+void Abc_SclCellLoad( SC_Cell * pCell )
+{
+    Scl_ImgCell_t * pImgCell;
+    Scl_ImgPin_t * pImgPin;
+    Scl_ImgArc_t * pArc;
+    SC_Timings * pRTime;
+    SC_Timing * pTime;
+    SC_Pin * pPin;
+    char * pImage;
+    int j, k;
+#ifdef ABC_USE_PTHREADS
+    int status = pthread_mutex_lock( &s_SclImgMutex );  assert( status == 0 );
+#endif
+    if ( (pImage = pCell->pImage) != NULL )
+    {
+        pImgCell = (Scl_ImgCell_t *)(pImage + pCell->iImage);
+        SC_CellForEachPinOut( pCell, pPin, j )
+        {
+            pImgPin = (Scl_ImgPin_t *)(pImage + pImgCell->oPins) + j;
+            assert( Vec_PtrSize(&pPin->vRTimings) == 0 );
+            for ( k = 0; k < pCell->n_inputs; k++ )
+            {
+                pArc = (Scl_ImgArc_t *)(pImage + ((int *)(pImage + pImgPin->oArcs))[k]);
+                pRTime = Abc_SclTimingsAlloc();
+                Vec_PtrPush( &pPin->vRTimings, pRTime );
+                if ( pArc->oName )
+                    pRTime->pName = Abc_UtilStrsav( pImage + pArc->oName );
+                if ( pArc->nTimings == 0 )
+                    continue;
+                pTime = Abc_SclTimingAlloc();
+                Vec_PtrPush( &pRTime->vTimings, pTime );
+                pTime->tsense = (SC_TSense)pArc->tsense;
+                Abc_SclImgReadSurface( pImage, pArc->oSurfs[0], &pTime->pCellRise );
+                Abc_SclImgReadSurface( pImage, pArc->oSurfs[1], &pTime->pCellFall );
+                Abc_SclImgReadSurface( pImage, pArc->oSurfs[2], &pTime->pRiseTrans );
+                Abc_SclImgReadSurface( pImage, pArc->oSurfs[3], &pTime->pFallTrans );
+            }
+        }
+        // publish the cell after it is loaded
+        SCL_IMG_PUBLISH( pCell );
+    }
+#ifdef ABC_USE_PTHREADS
+    status = pthread_mutex_unlock( &s_SclImgMutex );  assert( status == 0 );
+#endif
+}
+void Abc_SclLibLoad( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    int i;
+    SC_LibForEachCell( p, pCell, i )
+        if ( Scl_CellImage(pCell) )
+            Abc_SclCellLoad( pCell );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the image of the library.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclImageFree( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    int i;
+    SC_LibForEachCell( p, pCell, i )
+        pCell->pImage = NULL;
+#ifndef _WIN32
+    if ( p->fImageMap )
+        munmap( p->pImage, p->nImage );
+    else
+#endif
+    ABC_FREE( p->pImage );
+    p->pImage = NULL;
+    p->nImage = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -196,6 +196,7 @@ void Abc_SclShortNames( SC_Lib * p )
     SC_Cell * pClass, * pCell; SC_Pin * pPin;
     int i, k, n, nClasses = Abc_SclLibClassNum(p);
     int nDigits = Abc_Base10Log( nClasses );
+    Abc_SclLibLoad( p );
     // itereate through classes
     SC_LibForEachCellClass( p, pClass, i )
     {
@@ -757,6 +758,7 @@ void Abc_SclLibNormalize( SC_Lib * p )
     float Load = p->unit_cap_fst * pow(10.0, 15 - p->unit_cap_snd);
     if ( Time == 1 && Load == 1 )
         return;
+    Abc_SclLibLoad( p );
     p->unit_time = 12;
     p->unit_cap_fst = 1;
     p->unit_cap_snd = 15;
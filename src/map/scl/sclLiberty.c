@@ -340,7 +340,7 @@ static inline Scl_Item_t * Scl_LibertyNewItem( Scl_Tree_t * p, int Type )
 ***********************************************************************/
 char * Scl_LibertyReadString( Scl_Tree_t * p, Scl_Pair_t Pair )   
 { 
-    static char Buffer[ABC_MAX_LIB_STR_LEN]; 
+    static ABC_THREAD_LOCAL char Buffer[ABC_MAX_LIB_STR_LEN]; 
     assert( Pair.End-Pair.Beg < ABC_MAX_LIB_STR_LEN );
     strncpy( Buffer, p->pContents+Pair.Beg, Pair.End-Pair.Beg ); 
     if ( Pair.Beg < Pair.End && Buffer[0] == '\"' )
@@ -22,6 +22,7 @@
 #include "map/mio/mio.h"
 #include "misc/vec/vecWec.h"
 #include "base/main/main.h"
+#include "misc/util/utilPool.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -397,6 +398,221 @@ void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
         printf( "after (%6.1f ps  %6.1f ps)\n", Abc_SclObjTimeOne(p, pObj, 1), Abc_SclObjTimeOne(p, pObj, 0) );
     }
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Computes timing of the window for several candidate cells.]
+
+  Description [Performs the computation of Abc_SclTimeCone for each cell
+  in ppCells, assuming that it is assigned to the pivot, without changing
+  the network or its timing. The candidates are evaluated together: each
+  object of the window has an array of values (a lane) for each candidate.
+  For each candidate, the arrival times of the objects in vEvals (rise and
+  fall) are written into vRes starting from entry 2 * c * |vEvals|.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclTimeConeBatchInt( SC_Man * p, Abc_Obj_t * pPivot, SC_Cell ** ppCells, int n, Vec_Int_t * vCone, Vec_Int_t * vEvals, float * pRes )
+{
+    SC_Cell * pCellOld = Abc_SclObjCell( pPivot );
+    float pLoad[2*SC_LANES_MAX], pFaninArr[2*SC_LANES_MAX], pFaninSlew[2*SC_LANES_MAX], pValue[SC_LANES_MAX];
+    float * pLanes, * pArr, * pSlew, * pArrIn, * pSlewIn, EstDelta;
+    SC_Pair Load, Arr, Slew, ArrIn, SlewIn;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, c, iPos, fEst = 0;
+    Vec_FltFill( p->vLanes, 4 * n * Vec_IntSize(vCone), 0 );
+    pLanes = Vec_FltArray( p->vLanes );
+    Abc_NtkForEachObjVec( vCone, p->pNtk, pObj, i )
+    {
+        pArr  = pLanes + 4 * n * i;
+        pSlew = pArr + 2 * n;
+        // compute the loads as Abc_SclUpdateLoad() does for the fanins of the pivot
+        for ( c = 0; c < n; c++ )
+        {
+            pLoad[c]   = Abc_SclObjLoad(p, pObj)->rise;
+            pLoad[n+c] = Abc_SclObjLoad(p, pObj)->fall;
+        }
+        Abc_ObjForEachFanin( pPivot, pFanin, k )
+            if ( pFanin == pObj )
+                for ( c = 0; c < n; c++ )
+                {
+                    pLoad[c]   += SC_CellPin(ppCells[c], k)->rise_cap - SC_CellPin(pCellOld, k)->rise_cap;
+                    pLoad[n+c] += SC_CellPin(ppCells[c], k)->fall_cap - SC_CellPin(pCellOld, k)->fall_cap;
+                }
+        if ( Abc_ObjIsCi(pObj) )
+        {
+            if ( p->pPiDrive == NULL )
+                continue;
+            for ( c = 0; c < n; c++ )
+            {
+                Load.rise = pLoad[c];  Load.fall = pLoad[n+c];
+                Scl_LibHandleInputDriver( p->pPiDrive, &Load, &Arr, &Slew );
+                pArr[c]  = Arr.rise;   pArr[n+c]  = Arr.fall;
+                pSlew[c] = Slew.rise;  pSlew[n+c] = Slew.fall;
+            }
+            continue;
+        }
+        assert( Abc_ObjIsNode(pObj) );
+        // replace the large loads by the estimated ones, as Abc_SclTimeNode() does
+        if ( p->EstLoadMax )
+        {
+            fEst = 0;
+            for ( c = 0; c < n; c++ )
+            {
+                pValue[c] = (0.5 * pLoad[n+c] + 0.5 * pLoad[c]) / (p->EstLoadAve * p->EstLoadMax);
+                if ( pValue[c] > 1 )
+                    pLoad[c] = pLoad[n+c] = p->EstLoadAve * p->EstLoadMax, fEst = 1;
+            }
+        }
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+        {
+            iPos = Vec_IntFind( vCone, Abc_ObjId(pFanin) );
+            if ( iPos >= 0 )
+            {
+                pArrIn  = pLanes + 4 * n * iPos;
+                pSlewIn = pArrIn + 2 * n;
+            }
+            else
+            {
+                for ( c = 0; c < n; c++ )
+                {
+                    pFaninArr[c]  = Abc_SclObjTime(p, pFanin)->rise;  pFaninArr[n+c]  = Abc_SclObjTime(p, pFanin)->fall;
+                    pFaninSlew[c] = Abc_SclObjSlew(p, pFanin)->rise;  pFaninSlew[n+c] = Abc_SclObjSlew(p, pFanin)->fall;
+                }
+                pArrIn  = pFaninArr;
+                pSlewIn = pFaninSlew;
+            }
+            if ( pObj != pPivot )
+            {
+                Scl_LibPinArrivalBatch( Scl_CellPinTime(Abc_SclObjCell(pObj), k), pArrIn, pSlewIn, pLoad, pArr, pSlew, n );
+                continue;
+            }
+            // the pivot has a different cell in each lane
+            for ( c = 0; c < n; c++ )
+            {
+                Load.rise   = pLoad[c];     Load.fall   = pLoad[n+c];
+                ArrIn.rise  = pArrIn[c];    ArrIn.fall  = pArrIn[n+c];
+                SlewIn.rise = pSlewIn[c];   SlewIn.fall = pSlewIn[n+c];
+                Arr.rise    = pArr[c];      Arr.fall    = pArr[n+c];
+                Slew.rise   = pSlew[c];     Slew.fall   = pSlew[n+c];
+                Scl_LibPinArrival( Scl_CellPinTime(ppCells[c], k), &ArrIn, &SlewIn, &Load, &Arr, &Slew );
+                pArr[c]  = Arr.rise;   pArr[n+c]  = Arr.fall;
+                pSlew[c] = Slew.rise;  pSlew[n+c] = Slew.fall;
+            }
+        }
+        if ( p->EstLoadMax && fEst )
+            for ( c = 0; c < n; c++ )
+                if ( pValue[c] > 1 )
+                {
+                    EstDelta = p->EstLinear * log( pValue[c] );
+                    pArr[c]   += EstDelta;
+                    pArr[n+c] += EstDelta;
+                }
+    }
+    // collect the arrival times of the evaluated objects
+    Abc_NtkForEachObjVec( vEvals, p->pNtk, pObj, i )
+    {
+        iPos = Vec_IntFind( vCone, Abc_ObjId(pObj) );
+        assert( iPos >= 0 );
+        pArr = pLanes + 4 * n * iPos;
+        for ( c = 0; c < n; c++ )
+        {
+            pRes[2 * (c * Vec_IntSize(vEvals) + i) + 0] = pArr[c];
+            pRes[2 * (c * Vec_IntSize(vEvals) + i) + 1] = pArr[n+c];
+        }
+    }
+}
+void Abc_SclTimeConeBatch( SC_Man * p, Abc_Obj_t * pPivot, Vec_Ptr_t * vCells, Vec_Int_t * vCone, Vec_Int_t * vEvals, Vec_Flt_t * vRes )
+{
+    int c, nLanes;
+    Vec_FltFill( vRes, 2 * Vec_PtrSize(vCells) * Vec_IntSize(vEvals), 0 );
+    for ( c = 0; c < Vec_PtrSize(vCells); c += nLanes )
+    {
+        nLanes = Abc_MinInt( SC_LANES_MAX, Vec_PtrSize(vCells) - c );
+        Abc_SclTimeConeBatchInt( p, pPivot, (SC_Cell **)Vec_PtrArray(vCells) + c, nLanes, vCone, vEvals, Vec_FltEntryP(vRes, 2 * c * Vec_IntSize(vEvals)) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes arrival times of the nodes level by level.]
+
+  Description [The nodes of one level depend only on the nodes of the
+  lower levels, so they are divided between the threads. Each thread uses
+  its own copy of the manager, which differs only in the statistics.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Abc_SclThr_t_ Abc_SclThr_t;
+struct Abc_SclThr_t_
+{
+    SC_Man         Man;           // the copy of the manager
+    Vec_Int_t *    vNodes;        // the nodes of the current level
+    int            iThread;       // the thread number
+    int            nThreads;      // the number of threads
+};
+static int Abc_SclTimeLevelTask( void * pArg )
+{
+    Abc_SclThr_t * pThr = (Abc_SclThr_t *)pArg;
+    int nNodes = Vec_IntSize( pThr->vNodes );
+    int i, iStop = (int)((word)nNodes * (pThr->iThread + 1) / pThr->nThreads);
+    for ( i = (int)((word)nNodes * pThr->iThread / pThr->nThreads); i < iStop; i++ )
+        Abc_SclTimeNode( &pThr->Man, Abc_NtkObj(pThr->Man.pNtk, Vec_IntEntry(pThr->vNodes, i)), 0 );
+    return 1;
+}
+static void Abc_SclTimeNodesPar( SC_Man * p )
+{
+    Util_Pool_t * pPool = Util_PoolGlobal( p->nProcs - 1 );
+    Util_Task_t ** ppTasks = ABC_CALLOC( Util_Task_t *, p->nProcs );
+    Abc_SclThr_t * pThrs = ABC_CALLOC( Abc_SclThr_t, p->nProcs );
+    Vec_Int_t * vLevel = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    Vec_Wec_t * vLevels = Vec_WecAlloc( 100 );
+    Vec_Int_t * vNodes;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Level, nEstNodes = p->nEstNodes;
+    // collect the nodes by level
+    Abc_NtkForEachNode1( p->pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Abc_ObjId(pFanin)) );
+        Vec_IntWriteEntry( vLevel, Abc_ObjId(pObj), Level + 1 );
+        Vec_WecPush( vLevels, Level, Abc_ObjId(pObj) );
+    }
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        pThrs[i].Man      = *p;
+        pThrs[i].iThread  = i;
+        pThrs[i].nThreads = p->nProcs;
+    }
+    Vec_WecForEachLevel( vLevels, vNodes, Level )
+    {
+        for ( i = 0; i < p->nProcs; i++ )
+            pThrs[i].vNodes = vNodes;
+        // the calling thread processes the first share
+        for ( i = 1; i < p->nProcs; i++ )
+            ppTasks[i] = Util_PoolSubmit( pPool, Abc_SclTimeLevelTask, (void *)(pThrs + i) );
+        Abc_SclTimeLevelTask( pThrs );
+        for ( i = 1; i < p->nProcs; i++ )
+        {
+            Util_TaskWait( ppTasks[i] );
+            Util_TaskFree( ppTasks[i] );
+        }
+    }
+    for ( i = 0; i < p->nProcs; i++ )
+        p->nEstNodes += pThrs[i].Man.nEstNodes - nEstNodes;
+    ABC_FREE( ppTasks );
+    ABC_FREE( pThrs );
+    Vec_IntFree( vLevel );
+    Vec_WecFree( vLevels );
+}
+
 void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
 {
     Abc_Obj_t * pObj;
@@ -407,8 +623,13 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     p->nEstNodes = 0;
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+    if ( p->nProcs > 1 )
+        Abc_SclTimeNodesPar( p );
+    else
+    {
+        Abc_NtkForEachNode1( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+    }
     Abc_NtkForEachCo( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     D = Abc_SclReadMaxDelay( p );
@@ -623,16 +844,18 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
 
   Synopsis    [Prepare timing manager.]
 
-  Description []
+  Description [The number of threads is set before the first timing
+  recomputation, which uses them.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    p->nProcs = Abc_MaxInt( nProcs, 1 );
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -671,7 +894,7 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
 void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, 1 );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
@@ -899,7 +1122,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 1 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
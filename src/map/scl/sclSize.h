@@ -67,11 +67,15 @@ struct SC_Man_
     Vec_Flt_t *    vLoads3;       // backup storage for loads
     Vec_Flt_t *    vTimes2;       // backup storage for times
     Vec_Flt_t *    vTimes3;       // backup storage for slews
+    Vec_Flt_t *    vLanes;        // timing of the window for each candidate cell
+    Vec_Flt_t *    vTimesB;       // arrival times of the evaluated nodes for each candidate cell
+    Vec_Ptr_t *    vCellsB;       // candidate cells evaluated together
     // buffer trees
     float          EstLoadMax;    // max ratio of Cout/Cin when this kicks in
     float          EstLoadAve;    // average load of the gate
     float          EstLinear;     // linear coefficient
     int            nEstNodes;     // the number of estimations
+    int            nProcs;        // the number of threads for timing recomputation
     // intermediate data
     Vec_Que_t *    vNodeByGain;   // nodes by gain
     Vec_Flt_t *    vNode2Gain;    // mapping node into its gain
@@ -172,6 +176,10 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
     p->vLoads3   = Vec_FltAlloc( 1000 );
     p->vTimes2   = Vec_FltAlloc( 1000 );
     p->vTimes3   = Vec_FltAlloc( 1000 );
+    p->vLanes    = Vec_FltAlloc( 1000 );
+    p->vTimesB   = Vec_FltAlloc( 1000 );
+    p->vCellsB   = Vec_PtrAlloc( 100 );
+    p->nProcs    = 1;
     // intermediate data
     p->vNode2Gain  = Vec_FltStart( p->nObjs );
     p->vNode2Gate  = Vec_IntStart( p->nObjs );
@@ -210,6 +218,9 @@ static inline void Abc_SclManFree( SC_Man * p )
     Vec_FltFreeP( &p->vLoads3 );
     Vec_FltFreeP( &p->vTimes2 );
     Vec_FltFreeP( &p->vTimes3 );
+    Vec_FltFreeP( &p->vLanes );
+    Vec_FltFreeP( &p->vTimesB );
+    Vec_PtrFreeP( &p->vCellsB );
     Vec_IntFreeP( &p->vUpdates );
     Vec_IntFreeP( &p->vUpdates2 );
     Vec_IntFreeP( &p->vGatesBest );
@@ -403,6 +414,39 @@ static inline float Abc_SclEvalPerformLegal( SC_Man * p, Vec_Int_t * vCone, floa
     assert( Vec_FltSize(p->vTimes3) == k );
     return Eval / Vec_IntSize(vCone);
 }
+static inline float Abc_SclEvalPerformBatch( SC_Man * p, Vec_Int_t * vEvals, int iCell )
+{
+    float * pTimes = Vec_FltEntryP( p->vTimesB, 2 * iCell * Vec_IntSize(vEvals) );
+    float Diff, Multi = 1.5, Eval = 0;
+    int i, k = 0;
+    for ( i = 0; i < Vec_IntSize(vEvals); i++ )
+    {
+        Diff  = (Vec_FltEntry(p->vTimes3, k) - pTimes[k]);  k++;
+        Diff += (Vec_FltEntry(p->vTimes3, k) - pTimes[k]);  k++;
+        Eval += 0.5 * (Diff > 0 ? Diff : Multi * Diff);
+    }
+    assert( Vec_FltSize(p->vTimes3) == k );
+    return Eval / Vec_IntSize(vEvals);
+}
+static inline float Abc_SclEvalPerformLegalBatch( SC_Man * p, Vec_Int_t * vEvals, int iCell, float D )
+{
+    float * pTimes = Vec_FltEntryP( p->vTimesB, 2 * iCell * Vec_IntSize(vEvals) );
+    float Rise, Fall, SlackR, SlackF, Multi = 1.0, Eval = 0;
+    Abc_Obj_t * pObj;
+    int i, k = 0;
+    Abc_NtkForEachObjVec( vEvals, p->pNtk, pObj, i )
+    {
+        SlackR = D - (pTimes[k] + Abc_SclObjDept(p, pObj)->rise);
+        Rise   = Vec_FltEntry(p->vTimes3, k) - pTimes[k];  k++;
+        SlackF = D - (pTimes[k] + Abc_SclObjDept(p, pObj)->fall);
+        Fall   = Vec_FltEntry(p->vTimes3, k) - pTimes[k];  k++;
+        if ( Rise + Multi * SlackR < 0 || Fall + Multi * SlackF < 0 )
+             return -1;
+        Eval += 0.5 * Rise + 0.5 * Fall;
+    }
+    assert( Vec_FltSize(p->vTimes3) == k );
+    return Eval / Vec_IntSize(vEvals);
+}
 static inline void Abc_SclConeClean( SC_Man * p, Vec_Int_t * vCone )
 {
     SC_Pair Zero = { 0.0, 0.0 };
@@ -510,8 +554,8 @@ static inline SC_Cell * Abc_SclObjResiable( SC_Man * p, Abc_Obj_t * pObj, int fU
 static inline void Abc_SclDumpStats( SC_Man * p, char * pFileName, abctime Time )
 {
     static char FileNameOld[1000] = {0};
-    static int nNodesOld, nAreaOld, nDelayOld;
-    static abctime clk = 0;
+    static ABC_THREAD_LOCAL int nNodesOld, nAreaOld, nDelayOld;
+    static ABC_THREAD_LOCAL abctime clk = 0;
     FILE * pTable;
     pTable = fopen( pFileName, "a+" );
     if ( strcmp( FileNameOld, p->pNtk->pName ) )
@@ -563,8 +607,9 @@ extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Ab
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
-extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
+extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
+extern void          Abc_SclTimeConeBatch( SC_Man * p, Abc_Obj_t * pPivot, Vec_Ptr_t * vCells, Vec_Int_t * vCone, Vec_Int_t * vEvals, Vec_Flt_t * vRes );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
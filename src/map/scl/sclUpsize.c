@@ -277,30 +277,28 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
     SC_Cell * pCellOld, * pCellNew;
     float dGain, dGainBest;
     int k, gateBest, NoChange = 0;
-    // save old gate, timing, fanin load
+    // save old timing
     pCellOld = Abc_SclObjCell( pObj );
-    Abc_SclConeStore( p, vRecalcs );
     Abc_SclEvalStore( p, vEvals );
-    Abc_SclLoadStore( p, pObj );
-    // try different gate sizes for this node
-    gateBest = -1;
-    dGainBest = -DelayGap;
+    // collect different gate sizes for this node
+    Vec_PtrClear( p->vCellsB );
     SC_RingForEachCell( pCellOld, pCellNew, k )
     {
         if ( pCellNew == pCellOld )
             continue;
         if ( k > Notches )
             break;
-        // set new cell
-        Abc_SclObjSetCell( pObj, pCellNew );
-        Abc_SclUpdateLoad( p, pObj, pCellOld, pCellNew );
-        // recompute timing
-        Abc_SclTimeCone( p, vRecalcs );
-        // set old cell
-        Abc_SclObjSetCell( pObj, pCellOld );
-        Abc_SclLoadRestore( p, pObj );
+        Vec_PtrPush( p->vCellsB, pCellNew );
+    }
+    // recompute timing for all of them together
+    Abc_SclTimeConeBatch( p, pObj, p->vCellsB, vRecalcs, vEvals, p->vTimesB );
+    // try different gate sizes for this node
+    gateBest = -1;
+    dGainBest = -DelayGap;
+    Vec_PtrForEachEntry( SC_Cell *, p->vCellsB, pCellNew, k )
+    {
         // save best gain
-        dGain = Abc_SclEvalPerform( p, vEvals );
+        dGain = Abc_SclEvalPerformBatch( p, vEvals, k );
         if ( dGainBest < dGain )
         {
             dGainBest = dGain;
@@ -315,9 +313,6 @@ int Abc_SclFindBestCell( SC_Man * p, Abc_Obj_t * pObj, Vec_Int_t * vRecalcs, Vec
     }
 //    printf( "Best = %.2f   ", dGainBest );
 //    printf( "\n" );
-    // put back old cell and timing
-    Abc_SclObjSetCell( pObj, pCellOld );
-    Abc_SclConeRestore( p, vRecalcs );
     *pGainBest = dGainBest;
     return gateBest;
 }
@@ -890,7 +885,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     if ( pPars->Window == 1 )
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, pPars->nProcs );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
@@ -444,8 +444,8 @@ Super2_Lib_t * Super2_LibCompute( Super2_Man_t * pMan, Super2_Lib_t * pLib )
 }
 
 
-static unsigned s_uMaskBit;
-static unsigned s_uMaskAll;
+static ABC_THREAD_LOCAL unsigned s_uMaskBit;
+static ABC_THREAD_LOCAL unsigned s_uMaskAll;
 
 /**Function*************************************************************
 
@@ -1215,7 +1215,7 @@ void Super_WriteLibraryGateName_rec( Super_Gate_t * pGate, char * pBuffer )
 }
 char * Super_WriteLibraryGateName( Super_Gate_t * pGate )
 {
-    static char Buffer[2000];
+    static ABC_THREAD_LOCAL char Buffer[2000];
     Buffer[0] = 0;
     Super_WriteLibraryGateName_rec( pGate, Buffer );
     return Buffer;
@@ -52,7 +52,7 @@ define_cube_size(n)
 int n;
 {
     register int q, i;
-    static int called_before = 0;
+    static ABC_THREAD_LOCAL int called_before = 0;
 
     /* check if the cube is already just the right size */
     if (cube.fullset != 0 && cube.num_binary_vars == n && cube.num_vars == n)
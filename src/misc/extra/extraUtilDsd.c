@@ -1063,7 +1063,7 @@ void Sdm_ManFree( Sdm_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-static Sdm_Man_t * s_SdmMan = NULL;
+static ABC_THREAD_LOCAL Sdm_Man_t * s_SdmMan = NULL;
 Sdm_Man_t * Sdm_ManRead()
 {
     if ( s_SdmMan == NULL )
@@ -145,7 +145,7 @@ char * Extra_FileNameExtension( char * FileName )
 ***********************************************************************/
 char * Extra_FileNameAppend( char * pBase, char * pSuffix )
 {
-    static char Buffer[500];
+    static ABC_THREAD_LOCAL char Buffer[500];
     assert( strlen(pBase) + strlen(pSuffix) < 500 );
     sprintf( Buffer, "%s%s", pBase, pSuffix );
     return Buffer;
@@ -184,7 +184,7 @@ char * Extra_FileNameGeneric( char * FileName )
 ***********************************************************************/
 char * Extra_FileNameGenericAppend( char * pBase, char * pSuffix )
 {
-    static char Buffer[1000];
+    static ABC_THREAD_LOCAL char Buffer[1000];
     char * pDot;
     assert( strlen(pBase) + strlen(pSuffix) < 1000 );
     strcpy( Buffer, pBase );
@@ -445,7 +445,7 @@ int Extra_FileIsType( char * pFileName, char * pS1, char * pS2, char * pS3 )
 ***********************************************************************/
 char * Extra_TimeStamp()
 {
-    static char Buffer[100];
+    static ABC_THREAD_LOCAL char Buffer[100];
 	char * TimeStamp;
 	time_t ltime;
     // get the current time
@@ -159,7 +159,7 @@ int Extra_NumCombinations( int k, int n )
 ***********************************************************************/
 int * Extra_DeriveRadixCode( int Number, int Radix, int nDigits )
 {
-    static int Code[100];
+    static ABC_THREAD_LOCAL int Code[100];
     int i;
     assert( nDigits < 100 );
     for ( i = 0; i < nDigits; i++ )
@@ -494,8 +494,8 @@ unsigned Extra_TruthCanonNN( unsigned uTruth, int nVars )
 ***********************************************************************/
 unsigned Extra_TruthCanonP( unsigned uTruth, int nVars )
 {
-    static int nVarsOld, nPerms;
-    static char ** pPerms = NULL;
+    static ABC_THREAD_LOCAL int nVarsOld, nPerms;
+    static ABC_THREAD_LOCAL char ** pPerms = NULL;
 
     unsigned uTruthMin, uPerm;
     int k;
@@ -537,8 +537,8 @@ unsigned Extra_TruthCanonP( unsigned uTruth, int nVars )
 ***********************************************************************/
 unsigned Extra_TruthCanonNP( unsigned uTruth, int nVars )
 {
-    static int nVarsOld, nPerms;
-    static char ** pPerms = NULL;
+    static ABC_THREAD_LOCAL int nVarsOld, nPerms;
+    static ABC_THREAD_LOCAL char ** pPerms = NULL;
 
     unsigned uTruthMin, uPhase, uPerm;
     int nMints, k, i;
@@ -585,8 +585,8 @@ unsigned Extra_TruthCanonNP( unsigned uTruth, int nVars )
 ***********************************************************************/
 unsigned Extra_TruthCanonNPN( unsigned uTruth, int nVars )
 {
-    static int nVarsOld, nPerms;
-    static char ** pPerms = NULL;
+    static ABC_THREAD_LOCAL int nVarsOld, nPerms;
+    static ABC_THREAD_LOCAL char ** pPerms = NULL;
 
     unsigned uTruthMin, uTruthC, uPhase, uPerm;
     int nMints, k, i;
@@ -61,6 +61,18 @@
 #endif
 #endif
 
+// storage class for the state that is kept separately by each thread
+// (the current frame, the command-line parser, etc)
+#if !defined(ABC_THREAD_LOCAL)
+#if defined(_MSC_VER)
+#define ABC_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define ABC_THREAD_LOCAL __thread
+#else
+#define ABC_THREAD_LOCAL
+#endif
+#endif
+
 /*
 #ifdef __cplusplus
 #error "C++ code"
@@ -445,22 +445,41 @@ word Abc_IsopCheck( word * pOn, word * pOnDc, word * pRes, int nVars, word CostL
 
   Synopsis    [Create truth table for the given cover.]
 
-  Description []
+  Description [The elementary truth tables are computed by the first
+  caller; the others wait until the tables are published. The state
+  is read with acquire and written with release semantics, so that a
+  thread seeing the tables as ready also sees their contents.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
+#if defined(__GNUC__)
+#define ABC_ISOP_LOAD_ACQ(p)      __atomic_load_n( p, __ATOMIC_ACQUIRE )
+#define ABC_ISOP_STORE_REL(p, v)  __atomic_store_n( p, v, __ATOMIC_RELEASE )
+#define ABC_ISOP_CAS(p, o, n)     __sync_bool_compare_and_swap( p, o, n )
+#else
+#define ABC_ISOP_LOAD_ACQ(p)      (*(p))
+#define ABC_ISOP_STORE_REL(p, v)  (*(p) = (v))
+#define ABC_ISOP_CAS(p, o, n)     (*(p) == (o) ? (*(p) = (n), 1) : 0)
+#endif
 static inline word ** Abc_IsopTtElems()
 {
     static word TtElems[ABC_ISOP_MAX_VAR+1][ABC_ISOP_MAX_WORD], * pTtElems[ABC_ISOP_MAX_VAR+1] = {NULL};
-    if ( pTtElems[0] == NULL )
+    static int State = 0; // 0 = not started, 1 = being computed, 2 = ready
+    if ( ABC_ISOP_LOAD_ACQ(&State) != 2 )
     {
-        int v;
-        for ( v = 0; v <= ABC_ISOP_MAX_VAR; v++ )
-            pTtElems[v] = TtElems[v];
-        Abc_TtElemInit( pTtElems, ABC_ISOP_MAX_VAR );
+        if ( ABC_ISOP_CAS(&State, 0, 1) )
+        {
+            int v;
+            for ( v = 0; v <= ABC_ISOP_MAX_VAR; v++ )
+                pTtElems[v] = TtElems[v];
+            Abc_TtElemInit( pTtElems, ABC_ISOP_MAX_VAR );
+            ABC_ISOP_STORE_REL( &State, 2 );
+        }
+        else
+            while ( ABC_ISOP_LOAD_ACQ(&State) != 2 );
     }
     return pTtElems;
 }
@@ -1024,7 +1043,7 @@ int Abc_IsopTest( word * pFunc, int nVars, Vec_Int_t * vCover )
     int fVerbose = 0;    
     static word TotalCost[6] = {0};
     static abctime TotalTime[6] = {0};
-    static int Counter;
+    static ABC_THREAD_LOCAL int Counter;
     word pRes[ABC_ISOP_MAX_WORD];
     word Cost;
     abctime clk;
@@ -0,0 +1,183 @@
+/**CFile****************************************************************
+
+  FileName    [utilMmap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Paged storage.]
+
+  Synopsis    [Growable array in a memory-mapped file.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: utilMmap.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "abc_global.h"
+#include "utilMmap.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+struct Util_Mmap_t_
+{
+    char *           pBase;       // the reserved range of addresses
+    size_t           nBytesMax;   // the size of the reserved range
+    size_t           nBytesPage;  // the size of one page
+    size_t           nBytes;      // the size of the committed part
+    int              fd;          // the backing file
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef _WIN32
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the array backed by a temporary file in the directory.]
+
+  Description [Reserves nBytesMax bytes of addresses without committing
+  memory. The page size is rounded up to the system page size. Returns
+  NULL if the file cannot be created or the addresses cannot be reserved;
+  the caller is expected to fall back to the heap in this case.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Mmap_t * Util_MmapStart( char * pDir, size_t nBytesMax, size_t nBytesPage )
+{
+    Util_Mmap_t * p;
+    size_t nSysPage = (size_t)sysconf( _SC_PAGESIZE );
+    char * pFileName;
+    void * pBase;
+    int fd;
+    assert( pDir != NULL && nBytesMax > 0 );
+    nBytesPage = nBytesPage ? (nBytesPage + nSysPage - 1) / nSysPage * nSysPage : nSysPage;
+    nBytesMax  = (nBytesMax + nBytesPage - 1) / nBytesPage * nBytesPage;
+    // create the file, which disappears when it is closed
+    pFileName = ABC_ALLOC( char, strlen(pDir) + 20 );
+    sprintf( pFileName, "%s/abc_mmap_XXXXXX", pDir );
+    fd = mkstemp( pFileName );
+    if ( fd != -1 )
+        unlink( pFileName );
+    ABC_FREE( pFileName );
+    if ( fd == -1 )
+        return NULL;
+    // reserve the addresses
+    pBase = mmap( NULL, nBytesMax, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+    if ( pBase == MAP_FAILED )
+    {
+        close( fd );
+        return NULL;
+    }
+    p = ABC_CALLOC( Util_Mmap_t, 1 );
+    p->pBase      = (char *)pBase;
+    p->nBytesMax  = nBytesMax;
+    p->nBytesPage = nBytesPage;
+    p->fd         = fd;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the array and removes the file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_MmapStop( Util_Mmap_t * p )
+{
+    munmap( p->pBase, p->nBytesMax );
+    close( p->fd );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes sure that the first nBytes bytes are committed.]
+
+  Description [Extends the file and maps the new pages at the end of the
+  committed part. The new bytes are zero. Returns 0 if the reserved range
+  is exhausted or the file cannot be extended.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_MmapGrow( Util_Mmap_t * p, size_t nBytes )
+{
+    size_t nBytesNew;
+    if ( nBytes <= p->nBytes )
+        return 1;
+    if ( nBytes > p->nBytesMax )
+        return 0;
+    nBytesNew = (nBytes + p->nBytesPage - 1) / p->nBytesPage * p->nBytesPage;
+    if ( ftruncate( p->fd, (off_t)nBytesNew ) )
+        return 0;
+    if ( mmap( p->pBase + p->nBytes, nBytesNew - p->nBytes, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_FIXED, p->fd, (off_t)p->nBytes ) == MAP_FAILED )
+        return 0;
+    p->nBytes = nBytesNew;
+    return 1;
+}
+
+#else
+
+Util_Mmap_t * Util_MmapStart( char * pDir, size_t nBytesMax, size_t nBytesPage ) { return NULL; }
+void          Util_MmapStop( Util_Mmap_t * p )                                   { assert( 0 );     }
+int           Util_MmapGrow( Util_Mmap_t * p, size_t nBytes )                    { return 0;        }
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the beginning and the committed size of the array.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Util_MmapArray( Util_Mmap_t * p )
+{
+    return p->pBase;
+}
+size_t Util_MmapSize( Util_Mmap_t * p )
+{
+    return p->nBytes;
+}
+
+ABC_NAMESPACE_IMPL_END
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
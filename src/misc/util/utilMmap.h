@@ -0,0 +1,67 @@
+/**CFile****************************************************************
+
+  FileName    [utilMmap.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Paged storage.]
+
+  Synopsis    [Growable array in a memory-mapped file.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: utilMmap.h,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilMmap_h
+#define ABC__misc__util__utilMmap_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include <stddef.h>
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The array occupies a range of addresses reserved for its largest size,
+// which is backed by an unlinked temporary file and committed in pages
+// of a fixed size. Growing the array never moves it, so the pointers into
+// it remain valid, and the OS can write its pages back to the file when
+// the memory is short.
+typedef struct Util_Mmap_t_ Util_Mmap_t;
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilMmap.c ==========================================================*/
+
+extern Util_Mmap_t * Util_MmapStart( char * pDir, size_t nBytesMax, size_t nBytesPage );
+extern void          Util_MmapStop( Util_Mmap_t * p );
+extern void *        Util_MmapArray( Util_Mmap_t * p );
+extern size_t        Util_MmapSize( Util_Mmap_t * p );
+extern int           Util_MmapGrow( Util_Mmap_t * p, size_t nBytes );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,700 @@
+/**CFile****************************************************************
+
+  FileName    [utilPool.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Thread pool.]
+
+  Synopsis    [Work-stealing thread pool shared by the parallel engines.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: utilPool.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "abc_global.h"
+#include "misc/vec/vec.h"
+#include "utilPool.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// task states
+#define UTIL_TASK_QUEUED   0
+#define UTIL_TASK_RUNNING  1
+#define UTIL_TASK_DONE     2
+#define UTIL_TASK_WAITED   4   // added to the state when a thread sleeps until the task is done
+#define UTIL_TASK_STATE(s) ((s) & 3)
+
+// the largest number of exit procedures of one worker
+#define UTIL_POOL_EXIT_MAX 16
+
+// the counters and the task states shared by the threads
+#if defined(__GNUC__)
+#define UTIL_POOL_LOAD(p)     __atomic_load_n( p, __ATOMIC_ACQUIRE )
+#define UTIL_POOL_STORE(p, v) __atomic_store_n( p, v, __ATOMIC_RELEASE )
+#define UTIL_POOL_ADD(p, v)   __sync_add_and_fetch( p, v )
+#define UTIL_POOL_XCHG(p, v)  __atomic_exchange_n( p, v, __ATOMIC_ACQ_REL )
+#define UTIL_POOL_OR(p, v)    __atomic_fetch_or( p, v, __ATOMIC_ACQ_REL )
+#define UTIL_POOL_FENCE()     __sync_synchronize()
+#else
+#define UTIL_POOL_LOAD(p)     (*(p))
+#define UTIL_POOL_STORE(p, v) (*(p) = (v))
+#define UTIL_POOL_ADD(p, v)   (*(p) += (v))
+static inline int UTIL_POOL_XCHG( volatile int * p, int v ) { int Old = *p; *p = v;  return Old; }
+static inline int UTIL_POOL_OR( volatile int * p, int v )   { int Old = *p; *p |= v; return Old; }
+#define UTIL_POOL_FENCE()
+#endif
+
+struct Util_Task_t_
+{
+    Util_Pool_t *    pPool;       // the pool running this task
+    Util_TaskFunc_t  pFunc;       // the task procedure
+    void *           pArg;        // the argument of the procedure
+    void *           pCtx;        // the context of the submitting thread
+    volatile int     Status;      // the state of the task
+    volatile int     fCancel;     // set when the task is cancelled
+    int              Result;      // the value returned by the procedure
+};
+
+#ifdef ABC_USE_PTHREADS
+
+// the largest number of workers in one pool
+#define UTIL_POOL_WORKER_MAX 1024
+
+typedef struct Util_Worker_t_ Util_Worker_t;
+struct Util_Worker_t_
+{
+    Util_Pool_t *    pPool;       // the pool of this worker
+    pthread_t        Thread;      // the thread of this worker
+    pthread_mutex_t  Mutex;       // protects the deque
+    Vec_Ptr_t *      vTasks;      // the deque of tasks submitted by this worker
+    int              iHead;       // the oldest task in the deque
+    int              iThread;     // the index of this worker
+    int              iVictim;     // the next worker to steal from
+    int              nExitFuncs;  // the number of exit procedures
+    Util_PoolExitFunc_t pExitFuncs[UTIL_POOL_EXIT_MAX]; // called before the thread exits
+};
+
+struct Util_Pool_t_
+{
+    pthread_mutex_t  Mutex;       // protects sleeping, waking up and stopping
+    pthread_cond_t   CondWork;    // signaled when a task is submitted
+    pthread_cond_t   CondDone;    // broadcast when a task is finished
+    pthread_mutex_t  MutexQue;    // protects the tasks submitted from outside
+    Vec_Ptr_t *      vTasks;      // the tasks submitted from outside of the pool
+    int              iHead;       // the oldest task submitted from outside
+    volatile int     nWorkers;    // the number of workers
+    volatile int     nQueued;     // the number of tasks waiting in the deques
+    volatile int     nSleeping;   // the number of workers waiting for tasks
+    volatile int     nHelping;    // the number of workers waiting for tasks to finish
+    int              fStop;       // set when the pool is stopped
+    Util_Worker_t *  pWorkers[UTIL_POOL_WORKER_MAX]; // the workers
+};
+
+// the pool used by the engines of ABC
+static pthread_mutex_t s_PoolMutex = PTHREAD_MUTEX_INITIALIZER;
+static Util_Pool_t *   s_pPoolGlobal = NULL;
+
+// the worker and the task of the current thread
+static ABC_THREAD_LOCAL Util_Worker_t * s_pWorkerCur = NULL;
+
+#endif
+
+static ABC_THREAD_LOCAL Util_Task_t * s_pTaskCur = NULL;
+
+// the procedures passing the context to the tasks (set once at startup)
+static Util_PoolGetCtx_t s_pGetCtx = NULL;
+static Util_PoolSetCtx_t s_pSetCtx = NULL;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Task APIs that do not depend on threads.]
+
+  Description [Util_TaskCurrent() returns the task executed by the
+  calling thread, or NULL if the thread does not execute a task.
+  Long-running tasks poll Util_TaskIsCancelled() to stop early.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_TaskIsDone( Util_Task_t * pTask )
+{
+    return UTIL_TASK_STATE(UTIL_POOL_LOAD(&pTask->Status)) == UTIL_TASK_DONE;
+}
+void Util_TaskCancel( Util_Task_t * pTask )
+{
+    pTask->fCancel = 1;
+}
+int Util_TaskIsCancelled( Util_Task_t * pTask )
+{
+    return pTask != NULL && pTask->fCancel;
+}
+Util_Task_t * Util_TaskCurrent()
+{
+    return s_pTaskCur;
+}
+void Util_TaskFree( Util_Task_t * pTask )
+{
+    if ( pTask == NULL )
+        return;
+    assert( UTIL_TASK_STATE(pTask->Status) == UTIL_TASK_DONE );
+    ABC_FREE( pTask );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the procedures passing the context to the tasks.]
+
+  Description [The context of the thread submitting a task is installed
+  in the thread executing it for the duration of the task. The ABC frame
+  sets these procedures when it is started, so that the tasks see the
+  frame of the command that created them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_PoolSetContextHooks( Util_PoolGetCtx_t pGetCtx, Util_PoolSetCtx_t pSetCtx )
+{
+    s_pGetCtx = pGetCtx;
+    s_pSetCtx = pSetCtx;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Executes one task.]
+
+  Description [A task cancelled before it started is not executed and
+  its result is -1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_TaskExecute( Util_Task_t * pTask )
+{
+    Util_Task_t * pTaskOld = s_pTaskCur;
+    void * pCtxOld = NULL;
+    if ( pTask->fCancel )
+        return;
+    if ( s_pGetCtx && s_pSetCtx )
+    {
+        pCtxOld = s_pGetCtx();
+        s_pSetCtx( pTask->pCtx );
+    }
+    s_pTaskCur = pTask;
+    pTask->Result = pTask->pFunc( pTask->pArg );
+    s_pTaskCur = pTaskOld;
+    if ( s_pGetCtx && s_pSetCtx )
+        s_pSetCtx( pCtxOld );
+}
+
+#ifndef ABC_USE_PTHREADS
+
+// without threads, the tasks are executed when they are submitted
+struct Util_Pool_t_
+{
+    int              nThreads;    // the number of threads
+};
+static Util_Pool_t s_PoolGlobal = { 1 };
+
+Util_Pool_t * Util_PoolStart( int nThreads )   { return &s_PoolGlobal; }
+void          Util_PoolStop( Util_Pool_t * p ) {}
+Util_Pool_t * Util_PoolGlobal( int nThreads )  { return &s_PoolGlobal; }
+void          Util_PoolGlobalStop()            {}
+int           Util_PoolThreadNum( Util_Pool_t * p ) { return 1; }
+int           Util_PoolThreadAtExit( Util_PoolExitFunc_t pFunc ) { return 0; }
+Util_Task_t * Util_PoolSubmit( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg )
+{
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 );
+    pTask->pPool  = p;
+    pTask->pFunc  = pFunc;
+    pTask->pArg   = pArg;
+    pTask->pCtx   = s_pGetCtx ? s_pGetCtx() : NULL;
+    pTask->Result = -1;
+    Util_TaskExecute( pTask );
+    pTask->Status = UTIL_TASK_DONE;
+    return pTask;
+}
+int Util_TaskWait( Util_Task_t * pTask )
+{
+    return pTask->Result;
+}
+int Util_TaskWaitAny( Util_Task_t ** ppTasks, int nTasks )
+{
+    int i;
+    for ( i = 0; i < nTasks; i++ )
+        if ( ppTasks[i] != NULL )
+            return i;
+    return -1;
+}
+
+#else // pthreads are used
+
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the next task for the given worker.]
+
+  Description [The worker takes the newest task of its own deque, then
+  the oldest task submitted from outside of the pool, then the oldest
+  task of another worker. Taking the newest own task keeps the data of
+  nested tasks in the cache, while stealing the oldest task of another
+  worker takes the largest piece of its work. Each deque has its own
+  mutex, so the owner and a thief contend only for this deque. Returns
+  NULL if the tasks were taken by other workers first.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Util_Task_t * Util_PoolTakeOldest( pthread_mutex_t * pMutex, Vec_Ptr_t * vTasks, int * piHead )
+{
+    Util_Task_t * pTask = NULL;
+    int status;
+    status = pthread_mutex_lock( pMutex );  assert( status == 0 );
+    if ( *piHead < Vec_PtrSize(vTasks) )
+    {
+        pTask = (Util_Task_t *)Vec_PtrEntry( vTasks, (*piHead)++ );
+        if ( *piHead == Vec_PtrSize(vTasks) )
+        {
+            Vec_PtrClear( vTasks );
+            *piHead = 0;
+        }
+    }
+    status = pthread_mutex_unlock( pMutex );  assert( status == 0 );
+    return pTask;
+}
+static Util_Task_t * Util_PoolTakeNewest( Util_Worker_t * pWorker )
+{
+    Util_Task_t * pTask = NULL;
+    int status;
+    status = pthread_mutex_lock( &pWorker->Mutex );  assert( status == 0 );
+    if ( pWorker->iHead < Vec_PtrSize(pWorker->vTasks) )
+    {
+        pTask = (Util_Task_t *)Vec_PtrPop( pWorker->vTasks );
+        if ( pWorker->iHead == Vec_PtrSize(pWorker->vTasks) )
+        {
+            Vec_PtrClear( pWorker->vTasks );
+            pWorker->iHead = 0;
+        }
+    }
+    status = pthread_mutex_unlock( &pWorker->Mutex );  assert( status == 0 );
+    return pTask;
+}
+static Util_Task_t * Util_PoolTake( Util_Pool_t * p, Util_Worker_t * pWorker )
+{
+    Util_Worker_t * pVictim;
+    Util_Task_t * pTask = NULL;
+    int i, nWorkers;
+    if ( UTIL_POOL_LOAD(&p->nQueued) == 0 )
+        return NULL;
+    pTask = Util_PoolTakeNewest( pWorker );
+    if ( pTask == NULL )
+        pTask = Util_PoolTakeOldest( &p->MutexQue, p->vTasks, &p->iHead );
+    nWorkers = UTIL_POOL_LOAD(&p->nWorkers);
+    for ( i = 0; pTask == NULL && i < nWorkers; i++ )
+    {
+        pVictim = p->pWorkers[(pWorker->iVictim + i) % nWorkers];
+        if ( pVictim == pWorker )
+            continue;
+        pTask = Util_PoolTakeOldest( &pVictim->Mutex, pVictim->vTasks, &pVictim->iHead );
+        if ( pTask )
+            pWorker->iVictim = (pWorker->iVictim + i + 1) % nWorkers;
+    }
+    if ( pTask )
+        UTIL_POOL_ADD( &p->nQueued, -1 );
+    return pTask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the task taken from the deques.]
+
+  Description [The threads waiting for the task are woken up only if
+  there are such threads. The waiting threads mark the state of the task 
+  before sleeping, and the state is changed to done by one atomic exchange,
+  so either they see the task finished or the exchange returns the mark.
+  The task may be freed by its owner as soon as it is done, so it is not 
+  accessed after the exchange.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_PoolRun( Util_Pool_t * p, Util_Task_t * pTask )
+{
+    int status;
+    assert( UTIL_TASK_STATE(UTIL_POOL_LOAD(&pTask->Status)) == UTIL_TASK_QUEUED );
+    UTIL_POOL_OR( &pTask->Status, UTIL_TASK_RUNNING );
+    Util_TaskExecute( pTask );
+    if ( (UTIL_POOL_XCHG(&pTask->Status, UTIL_TASK_DONE) & UTIL_TASK_WAITED) == 0 )
+        return;
+    status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+    status = pthread_cond_broadcast( &p->CondDone );  assert( status == 0 );
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The procedure of the worker threads.]
+
+  Description [Idle workers sleep on the condition variable instead of
+  polling. Before exiting, the worker calls its exit procedures in the
+  reverse order of registration.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Util_PoolThreadAtExit( Util_PoolExitFunc_t pFunc )
+{
+    Util_Worker_t * pWorker = s_pWorkerCur;
+    int i;
+    if ( pWorker == NULL )
+        return 0;
+    for ( i = 0; i < pWorker->nExitFuncs; i++ )
+        if ( pWorker->pExitFuncs[i] == pFunc )
+            return 1;
+    assert( pWorker->nExitFuncs < UTIL_POOL_EXIT_MAX );
+    pWorker->pExitFuncs[pWorker->nExitFuncs++] = pFunc;
+    return 1;
+}
+static void * Util_PoolWorkerThread( void * pArg )
+{
+    Util_Worker_t * pWorker = (Util_Worker_t *)pArg;
+    Util_Pool_t * p = pWorker->pPool;
+    Util_Task_t * pTask;
+    int i, fStop = 0, status;
+    s_pWorkerCur = pWorker;
+    while ( !fStop )
+    {
+        if ( (pTask = Util_PoolTake(p, pWorker)) )
+        {
+            Util_PoolRun( p, pTask );
+            continue;
+        }
+        status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+        UTIL_POOL_ADD( &p->nSleeping, 1 );
+        if ( UTIL_POOL_LOAD(&p->nQueued) == 0 )
+        {
+            if ( p->fStop )
+                fStop = 1;
+            else
+            {
+                status = pthread_cond_wait( &p->CondWork, &p->Mutex );  assert( status == 0 );
+            }
+        }
+        UTIL_POOL_ADD( &p->nSleeping, -1 );
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    }
+    for ( i = pWorker->nExitFuncs - 1; i >= 0; i-- )
+        pWorker->pExitFuncs[i]();
+    s_pWorkerCur = NULL;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds workers until the pool has the given number of threads.]
+
+  Description [Called with the pool mutex held. The worker is published
+  before its thread is started, so that the other workers can steal from
+  it without taking the pool mutex.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Util_PoolGrow( Util_Pool_t * p, int nThreads )
+{
+    Util_Worker_t * pWorker;
+    int status;
+    nThreads = Abc_MinInt( nThreads, UTIL_POOL_WORKER_MAX );
+    while ( p->nWorkers < nThreads )
+    {
+        pWorker = ABC_CALLOC( Util_Worker_t, 1 );
+        pWorker->pPool   = p;
+        pWorker->vTasks  = Vec_PtrAlloc( 100 );
+        pWorker->iThread = p->nWorkers;
+        pWorker->iVictim = p->nWorkers + 1;
+        status = pthread_mutex_init( &pWorker->Mutex, NULL );  assert( status == 0 );
+        p->pWorkers[p->nWorkers] = pWorker;
+        UTIL_POOL_STORE( &p->nWorkers, p->nWorkers + 1 );
+        status = pthread_create( &pWorker->Thread, NULL, Util_PoolWorkerThread, (void *)pWorker );  assert( status == 0 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the pool.]
+
+  Description [Stopping the pool finishes the tasks still in the deques
+  and joins the workers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Pool_t * Util_PoolStart( int nThreads )
+{
+    Util_Pool_t * p = ABC_CALLOC( Util_Pool_t, 1 );
+    int status;
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    status = pthread_mutex_init( &p->MutexQue, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->CondWork, NULL );  assert( status == 0 );
+    status = pthread_cond_init( &p->CondDone, NULL );  assert( status == 0 );
+    p->vTasks = Vec_PtrAlloc( 100 );
+    status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+    Util_PoolGrow( p, Abc_MaxInt(1, nThreads) );
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    return p;
+}
+void Util_PoolStop( Util_Pool_t * p )
+{
+    Util_Worker_t * pWorker;
+    int i, status;
+    status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+    p->fStop = 1;
+    status = pthread_cond_broadcast( &p->CondWork );  assert( status == 0 );
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        pWorker = p->pWorkers[i];
+        status = pthread_join( pWorker->Thread, NULL );  assert( status == 0 );
+    }
+    assert( p->nQueued == 0 );
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        pWorker = p->pWorkers[i];
+        assert( Vec_PtrSize(pWorker->vTasks) == pWorker->iHead );
+        Vec_PtrFree( pWorker->vTasks );
+        pthread_mutex_destroy( &pWorker->Mutex );
+        ABC_FREE( pWorker );
+    }
+    Vec_PtrFree( p->vTasks );
+    pthread_cond_destroy( &p->CondWork );
+    pthread_cond_destroy( &p->CondDone );
+    pthread_mutex_destroy( &p->MutexQue );
+    pthread_mutex_destroy( &p->Mutex );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the pool shared by the engines.]
+
+  Description [The pool is started on the first call and grows when an
+  engine asks for more threads than the pool has. It is never shrunk,
+  so the thread count is the largest one requested so far. The pool is
+  stopped by Util_PoolGlobalStop() when the last ABC frame is released,
+  which runs the exit procedures of the workers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Pool_t * Util_PoolGlobal( int nThreads )
+{
+    int status;
+    status = pthread_mutex_lock( &s_PoolMutex );  assert( status == 0 );
+    if ( s_pPoolGlobal == NULL )
+        s_pPoolGlobal = Util_PoolStart( nThreads );
+    else
+    {
+        status = pthread_mutex_lock( &s_pPoolGlobal->Mutex );  assert( status == 0 );
+        Util_PoolGrow( s_pPoolGlobal, nThreads );
+        status = pthread_mutex_unlock( &s_pPoolGlobal->Mutex );  assert( status == 0 );
+    }
+    status = pthread_mutex_unlock( &s_PoolMutex );  assert( status == 0 );
+    return s_pPoolGlobal;
+}
+void Util_PoolGlobalStop()
+{
+    Util_Pool_t * p;
+    int status;
+    // a worker cannot join itself, so the pool stays when called from a task
+    if ( s_pWorkerCur != NULL )
+        return;
+    status = pthread_mutex_lock( &s_PoolMutex );  assert( status == 0 );
+    p = s_pPoolGlobal;
+    s_pPoolGlobal = NULL;
+    status = pthread_mutex_unlock( &s_PoolMutex );  assert( status == 0 );
+    if ( p )
+        Util_PoolStop( p );
+}
+int Util_PoolThreadNum( Util_Pool_t * p )
+{
+    return UTIL_POOL_LOAD( &p->nWorkers );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Submits a task.]
+
+  Description [A task submitted by a worker goes to the worker's own
+  deque, so that the subtasks of a task are executed first by the same
+  thread and stolen by the others only when they run out of work. The
+  counter of queued tasks is incremented before the task is added, so
+  it is never below the number of tasks in the deques. The pool mutex 
+  is taken only to wake up the sleeping or waiting threads. The returned 
+  handle is freed by Util_TaskFree() after the task is done.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Util_Task_t * Util_PoolSubmit( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg )
+{
+    Util_Task_t * pTask = ABC_CALLOC( Util_Task_t, 1 );
+    Util_Worker_t * pWorker = s_pWorkerCur;
+    int status;
+    pTask->pPool  = p;
+    pTask->pFunc  = pFunc;
+    pTask->pArg   = pArg;
+    pTask->pCtx   = s_pGetCtx ? s_pGetCtx() : NULL;
+    pTask->Status = UTIL_TASK_QUEUED;
+    pTask->Result = -1;
+    UTIL_POOL_ADD( &p->nQueued, 1 );
+    if ( pWorker && pWorker->pPool == p )
+    {
+        status = pthread_mutex_lock( &pWorker->Mutex );  assert( status == 0 );
+        Vec_PtrPush( pWorker->vTasks, pTask );
+        status = pthread_mutex_unlock( &pWorker->Mutex );  assert( status == 0 );
+    }
+    else
+    {
+        status = pthread_mutex_lock( &p->MutexQue );  assert( status == 0 );
+        Vec_PtrPush( p->vTasks, pTask );
+        status = pthread_mutex_unlock( &p->MutexQue );  assert( status == 0 );
+    }
+    UTIL_POOL_FENCE();
+    if ( UTIL_POOL_LOAD(&p->nSleeping) == 0 && UTIL_POOL_LOAD(&p->nHelping) == 0 )
+        return pTask;
+    // wake up a sleeping worker or the workers helping in Util_TaskWait()
+    status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+    if ( p->nSleeping )
+        status = pthread_cond_signal( &p->CondWork );
+    else
+        status = pthread_cond_broadcast( &p->CondDone );
+    assert( status == 0 );
+    status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    return pTask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Waits for the task and returns its result.]
+
+  Description [A worker of the pool waiting for a task executes other
+  tasks meanwhile, so that tasks can wait for their subtasks without
+  blocking the pool. Other threads sleep until the task is done.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Util_TaskFindDone( Util_Task_t ** ppTasks, int nTasks, int * pfFound )
+{
+    int i;
+    *pfFound = 0;
+    for ( i = 0; i < nTasks; i++ )
+    {
+        if ( ppTasks[i] == NULL )
+            continue;
+        *pfFound = 1;
+        if ( UTIL_TASK_STATE(UTIL_POOL_LOAD(&ppTasks[i]->Status)) == UTIL_TASK_DONE )
+            return i;
+    }
+    return -1;
+}
+int Util_TaskWaitAny( Util_Task_t ** ppTasks, int nTasks )
+{
+    Util_Pool_t * p = NULL;
+    Util_Worker_t * pWorker = NULL;
+    Util_Task_t * pTask;
+    int i, iTask, fFound, status;
+    for ( i = 0; i < nTasks && p == NULL; i++ )
+        if ( ppTasks[i] )
+            p = ppTasks[i]->pPool;
+    if ( p == NULL )
+        return -1;
+    if ( s_pWorkerCur && s_pWorkerCur->pPool == p )
+        pWorker = s_pWorkerCur;
+    while ( (iTask = Util_TaskFindDone(ppTasks, nTasks, &fFound)) == -1 )
+    {
+        assert( fFound );
+        if ( pWorker && (pTask = Util_PoolTake(p, pWorker)) )
+        {
+            Util_PoolRun( p, pTask );
+            continue;
+        }
+        status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+        if ( pWorker )
+            UTIL_POOL_ADD( &p->nHelping, 1 );
+        for ( i = 0; i < nTasks; i++ )
+            if ( ppTasks[i] )
+                UTIL_POOL_OR( &ppTasks[i]->Status, UTIL_TASK_WAITED );
+        if ( Util_TaskFindDone(ppTasks, nTasks, &fFound) == -1 && !(pWorker && UTIL_POOL_LOAD(&p->nQueued) > 0) )
+        {
+            status = pthread_cond_wait( &p->CondDone, &p->Mutex );  assert( status == 0 );
+        }
+        if ( pWorker )
+            UTIL_POOL_ADD( &p->nHelping, -1 );
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+    }
+    return iTask;
+}
+int Util_TaskWait( Util_Task_t * pTask )
+{
+    Util_TaskWaitAny( &pTask, 1 );
+    return pTask->Result;
+}
+
+#endif // pthreads are used
+
+ABC_NAMESPACE_IMPL_END
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,82 @@
+/**CFile****************************************************************
+
+  FileName    [utilPool.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Thread pool.]
+
+  Synopsis    [Work-stealing thread pool shared by the parallel engines.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: utilPool.h,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilPool_h
+#define ABC__misc__util__utilPool_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Util_Pool_t_ Util_Pool_t;
+typedef struct Util_Task_t_ Util_Task_t;
+
+// the task procedure; its return value is the result of the task
+typedef int (*Util_TaskFunc_t)( void * pArg );
+
+// the procedures reading and setting the context of the calling thread
+// (the ABC frame), which is passed from the submitting thread to the task
+typedef void * (*Util_PoolGetCtx_t)();
+typedef void   (*Util_PoolSetCtx_t)( void * pCtx );
+
+// the procedure called by a worker thread before it exits
+typedef void   (*Util_PoolExitFunc_t)();
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilPool.c ==========================================================*/
+
+extern Util_Pool_t * Util_PoolStart( int nThreads );
+extern void          Util_PoolStop( Util_Pool_t * p );
+extern Util_Pool_t * Util_PoolGlobal( int nThreads );
+extern void          Util_PoolGlobalStop();
+extern void          Util_PoolSetContextHooks( Util_PoolGetCtx_t pGetCtx, Util_PoolSetCtx_t pSetCtx );
+extern int           Util_PoolThreadAtExit( Util_PoolExitFunc_t pFunc );
+extern int           Util_PoolThreadNum( Util_Pool_t * p );
+extern Util_Task_t * Util_PoolSubmit( Util_Pool_t * p, Util_TaskFunc_t pFunc, void * pArg );
+extern int           Util_TaskWait( Util_Task_t * pTask );
+extern int           Util_TaskWaitAny( Util_Task_t ** ppTasks, int nTasks );
+extern int           Util_TaskIsDone( Util_Task_t * pTask );
+extern void          Util_TaskCancel( Util_Task_t * pTask );
+extern int           Util_TaskIsCancelled( Util_Task_t * pTask );
+extern Util_Task_t * Util_TaskCurrent();
+extern void          Util_TaskFree( Util_Task_t * pTask );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
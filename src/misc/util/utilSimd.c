@@ -0,0 +1,411 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Word-parallel simulation kernels.]
+
+  Synopsis    [Vectorized AND/copy/compare of simulation info with runtime dispatch.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "abc_global.h"
+#include "utilSimd.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+// the vector kernels are compiled for x86 with GCC-compatible compilers;
+// they are enabled per function using target attributes, so that the rest
+// of the binary does not depend on the instruction set of the build machine
+#if !defined(ABC_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ABC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef void (*Abc_SimdAndFunc_t)  ( word *, word *, word *, int, word, word );
+typedef void (*Abc_SimdDupFunc_t)  ( word *, word *, int, word );
+typedef int  (*Abc_SimdEqualFunc_t)( word *, word *, int, word );
+
+// the kernels of one level, which are switched together
+typedef struct Abc_SimdKernels_t_ Abc_SimdKernels_t;
+struct Abc_SimdKernels_t_
+{
+    int                    Level;
+    Abc_SimdAndFunc_t      pAnd;
+    Abc_SimdDupFunc_t      pDup;
+    Abc_SimdEqualFunc_t    pEqual;
+};
+
+static int                       s_SimdLevelMax = ABC_SIMD_NONE;  // the best level supported by the CPU
+static const Abc_SimdKernels_t * s_pSimd        = NULL;           // the kernels currently used (NULL = not detected)
+#ifdef ABC_USE_PTHREADS
+static pthread_once_t            s_SimdOnce     = PTHREAD_ONCE_INIT;
+#endif
+
+// the kernel table is read by other threads while the level is changed
+#if defined(__GNUC__)
+#define ABC_SIMD_LOAD_ACQ(p)      __atomic_load_n( p, __ATOMIC_ACQUIRE )
+#define ABC_SIMD_STORE_REL(p, v)  __atomic_store_n( p, v, __ATOMIC_RELEASE )
+#else
+#define ABC_SIMD_LOAD_ACQ(p)      (*(p))
+#define ABC_SIMD_STORE_REL(p, v)  (*(p) = (v))
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar kernels.]
+
+  Description [Complemented fanins are handled by XOR-ing with an all-0
+  or all-1 mask, which lets each kernel use one loop for all polarities.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdAnd_Scalar( word * pSim, word * pSim0, word * pSim1, int nWords, word Mask0, word Mask1 )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+}
+static void Abc_SimdDup_Scalar( word * pSim, word * pSim0, int nWords, word Mask0 )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pSim[w] = pSim0[w] ^ Mask0;
+}
+static int Abc_SimdEqual_Scalar( word * pSim0, word * pSim1, int nWords, word Mask )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( pSim0[w] != (pSim1[w] ^ Mask) )
+            return 0;
+    return 1;
+}
+
+#ifdef ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [SSE2 kernels (2 words per step).]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("sse2")))
+static void Abc_SimdAnd_Sse2( word * pSim, word * pSim0, word * pSim1, int nWords, word Mask0, word Mask1 )
+{
+    __m128i M0 = _mm_set1_epi64x( (long long)Mask0 );
+    __m128i M1 = _mm_set1_epi64x( (long long)Mask1 );
+    int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+    {
+        __m128i A = _mm_xor_si128( _mm_loadu_si128((const __m128i *)(pSim0 + w)), M0 );
+        __m128i B = _mm_xor_si128( _mm_loadu_si128((const __m128i *)(pSim1 + w)), M1 );
+        _mm_storeu_si128( (__m128i *)(pSim + w), _mm_and_si128(A, B) );
+    }
+    for ( ; w < nWords; w++ )
+        pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+}
+__attribute__((target("sse2")))
+static void Abc_SimdDup_Sse2( word * pSim, word * pSim0, int nWords, word Mask0 )
+{
+    __m128i M0 = _mm_set1_epi64x( (long long)Mask0 );
+    int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+        _mm_storeu_si128( (__m128i *)(pSim + w), _mm_xor_si128(_mm_loadu_si128((const __m128i *)(pSim0 + w)), M0) );
+    for ( ; w < nWords; w++ )
+        pSim[w] = pSim0[w] ^ Mask0;
+}
+__attribute__((target("sse2")))
+static int Abc_SimdEqual_Sse2( word * pSim0, word * pSim1, int nWords, word Mask )
+{
+    __m128i M = _mm_set1_epi64x( (long long)Mask );
+    int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+    {
+        __m128i A = _mm_loadu_si128( (const __m128i *)(pSim0 + w) );
+        __m128i B = _mm_xor_si128( _mm_loadu_si128((const __m128i *)(pSim1 + w)), M );
+        if ( _mm_movemask_epi8(_mm_cmpeq_epi32(A, B)) != 0xFFFF )
+            return 0;
+    }
+    for ( ; w < nWords; w++ )
+        if ( pSim0[w] != (pSim1[w] ^ Mask) )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels (4 words per step).]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static void Abc_SimdAnd_Avx2( word * pSim, word * pSim0, word * pSim1, int nWords, word Mask0, word Mask1 )
+{
+    __m256i M0 = _mm256_set1_epi64x( (long long)Mask0 );
+    __m256i M1 = _mm256_set1_epi64x( (long long)Mask1 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i A = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pSim0 + w)), M0 );
+        __m256i B = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pSim1 + w)), M1 );
+        _mm256_storeu_si256( (__m256i *)(pSim + w), _mm256_and_si256(A, B) );
+    }
+    for ( ; w < nWords; w++ )
+        pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+}
+__attribute__((target("avx2")))
+static void Abc_SimdDup_Avx2( word * pSim, word * pSim0, int nWords, word Mask0 )
+{
+    __m256i M0 = _mm256_set1_epi64x( (long long)Mask0 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+        _mm256_storeu_si256( (__m256i *)(pSim + w), _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(pSim0 + w)), M0) );
+    for ( ; w < nWords; w++ )
+        pSim[w] = pSim0[w] ^ Mask0;
+}
+__attribute__((target("avx2")))
+static int Abc_SimdEqual_Avx2( word * pSim0, word * pSim1, int nWords, word Mask )
+{
+    __m256i M = _mm256_set1_epi64x( (long long)Mask );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i A = _mm256_loadu_si256( (const __m256i *)(pSim0 + w) );
+        __m256i B = _mm256_xor_si256( _mm256_loadu_si256((const __m256i *)(pSim1 + w)), M );
+        if ( _mm256_movemask_epi8(_mm256_cmpeq_epi64(A, B)) != -1 )
+            return 0;
+    }
+    for ( ; w < nWords; w++ )
+        if ( pSim0[w] != (pSim1[w] ^ Mask) )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels (8 words per step).]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f")))
+static void Abc_SimdAnd_Avx512( word * pSim, word * pSim0, word * pSim1, int nWords, word Mask0, word Mask1 )
+{
+    __m512i M0 = _mm512_set1_epi64( (long long)Mask0 );
+    __m512i M1 = _mm512_set1_epi64( (long long)Mask1 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i A = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pSim0 + w)), M0 );
+        __m512i B = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pSim1 + w)), M1 );
+        _mm512_storeu_si512( (void *)(pSim + w), _mm512_and_si512(A, B) );
+    }
+    for ( ; w < nWords; w++ )
+        pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdDup_Avx512( word * pSim, word * pSim0, int nWords, word Mask0 )
+{
+    __m512i M0 = _mm512_set1_epi64( (long long)Mask0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        _mm512_storeu_si512( (void *)(pSim + w), _mm512_xor_si512(_mm512_loadu_si512((const void *)(pSim0 + w)), M0) );
+    for ( ; w < nWords; w++ )
+        pSim[w] = pSim0[w] ^ Mask0;
+}
+__attribute__((target("avx512f")))
+static int Abc_SimdEqual_Avx512( word * pSim0, word * pSim1, int nWords, word Mask )
+{
+    __m512i M = _mm512_set1_epi64( (long long)Mask );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i A = _mm512_loadu_si512( (const void *)(pSim0 + w) );
+        __m512i B = _mm512_xor_si512( _mm512_loadu_si512((const void *)(pSim1 + w)), M );
+        if ( _mm512_cmpneq_epi64_mask(A, B) )
+            return 0;
+    }
+    for ( ; w < nWords; w++ )
+        if ( pSim0[w] != (pSim1[w] ^ Mask) )
+            return 0;
+    return 1;
+}
+
+#endif // ABC_SIMD_X86
+
+// the kernels of each level (the levels not compiled in use the scalar ones)
+static const Abc_SimdKernels_t s_SimdKernels[4] = {
+    { ABC_SIMD_NONE,   Abc_SimdAnd_Scalar, Abc_SimdDup_Scalar, Abc_SimdEqual_Scalar },
+#ifdef ABC_SIMD_X86
+    { ABC_SIMD_SSE2,   Abc_SimdAnd_Sse2,   Abc_SimdDup_Sse2,   Abc_SimdEqual_Sse2   },
+    { ABC_SIMD_AVX2,   Abc_SimdAnd_Avx2,   Abc_SimdDup_Avx2,   Abc_SimdEqual_Avx2   },
+    { ABC_SIMD_AVX512, Abc_SimdAnd_Avx512, Abc_SimdDup_Avx512, Abc_SimdEqual_Avx512 }
+#else
+    { ABC_SIMD_NONE,   Abc_SimdAnd_Scalar, Abc_SimdDup_Scalar, Abc_SimdEqual_Scalar },
+    { ABC_SIMD_NONE,   Abc_SimdAnd_Scalar, Abc_SimdDup_Scalar, Abc_SimdEqual_Scalar },
+    { ABC_SIMD_NONE,   Abc_SimdAnd_Scalar, Abc_SimdDup_Scalar, Abc_SimdEqual_Scalar }
+#endif
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Detects the best instruction set supported by the CPU.]
+
+  Description [The detection runs once, even if several threads call
+  the kernels for the first time together.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_SimdDetect()
+{
+#ifdef ABC_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        return ABC_SIMD_AVX512;
+    if ( __builtin_cpu_supports("avx2") )
+        return ABC_SIMD_AVX2;
+    if ( __builtin_cpu_supports("sse2") )
+        return ABC_SIMD_SSE2;
+#endif
+    return ABC_SIMD_NONE;
+}
+static void Abc_SimdInit()
+{
+    s_SimdLevelMax = Abc_SimdDetect();
+    ABC_SIMD_STORE_REL( &s_pSimd, s_SimdKernels + s_SimdLevelMax );
+}
+static inline const Abc_SimdKernels_t * Abc_SimdKernels()
+{
+    const Abc_SimdKernels_t * pSimd = ABC_SIMD_LOAD_ACQ( &s_pSimd );
+    if ( pSimd != NULL )
+        return pSimd;
+#ifdef ABC_USE_PTHREADS
+    pthread_once( &s_SimdOnce, Abc_SimdInit );
+#else
+    Abc_SimdInit();
+#endif
+    return ABC_SIMD_LOAD_ACQ( &s_pSimd );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels.]
+
+  Description [The level is clamped to what the CPU supports. A negative
+  level selects the best available one. The kernels of the level are
+  published by one pointer store, so that a thread running a kernel
+  never sees a mix of two levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SimdSetLevel( int Level )
+{
+    Abc_SimdKernels(); // detects the CPU once
+    if ( Level < 0 || Level > s_SimdLevelMax )
+        Level = s_SimdLevelMax;
+    ABC_SIMD_STORE_REL( &s_pSimd, s_SimdKernels + Level );
+}
+int Abc_SimdLevel()
+{
+    return Abc_SimdKernels()->Level;
+}
+int Abc_SimdLevelMax()
+{
+    Abc_SimdKernels();
+    return s_SimdLevelMax;
+}
+const char * Abc_SimdLevelName( int Level )
+{
+    if ( Level == ABC_SIMD_SSE2 )   return "SSE2";
+    if ( Level == ABC_SIMD_AVX2 )   return "AVX2";
+    if ( Level == ABC_SIMD_AVX512 ) return "AVX-512";
+    return "scalar";
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Dispatched kernels.]
+
+  Description [Computes pSim = pSim0^fCompl0 & pSim1^fCompl1,
+  pSim = pSim0^fCompl0, and checks pSim0 == pSim1^fCompl.
+  The arrays do not have to be aligned.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SimdAnd( word * pSim, word * pSim0, word * pSim1, int nWords, int fCompl0, int fCompl1 )
+{
+    Abc_SimdKernels()->pAnd( pSim, pSim0, pSim1, nWords, fCompl0 ? ~(word)0 : 0, fCompl1 ? ~(word)0 : 0 );
+}
+void Abc_SimdDup( word * pSim, word * pSim0, int nWords, int fCompl0 )
+{
+    Abc_SimdKernels()->pDup( pSim, pSim0, nWords, fCompl0 ? ~(word)0 : 0 );
+}
+int Abc_SimdEqual( word * pSim0, word * pSim1, int nWords, int fCompl )
+{
+    return Abc_SimdKernels()->pEqual( pSim0, pSim1, nWords, fCompl ? ~(word)0 : 0 );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,71 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Word-parallel simulation kernels.]
+
+  Synopsis    [External declarations.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: utilSimd.h,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// below this number of 64-bit words, the scalar loops are faster than the dispatched kernels
+#define ABC_SIMD_WORDS_MIN  8
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef enum {
+    ABC_SIMD_NONE = 0,          // 0: scalar 64-bit words
+    ABC_SIMD_SSE2,              // 1: 128-bit vectors
+    ABC_SIMD_AVX2,              // 2: 256-bit vectors
+    ABC_SIMD_AVX512             // 3: 512-bit vectors
+} Abc_SimdLevel_t;
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ===============================================================*/
+extern int             Abc_SimdLevel();
+extern int             Abc_SimdLevelMax();
+extern void            Abc_SimdSetLevel( int Level );
+extern const char *    Abc_SimdLevelName( int Level );
+extern void            Abc_SimdAnd( word * pSim, word * pSim0, word * pSim1, int nWords, int fCompl0, int fCompl1 );
+extern void            Abc_SimdDup( word * pSim, word * pSim0, int nWords, int fCompl0 );
+extern int             Abc_SimdEqual( word * pSim0, word * pSim1, int nWords, int fCompl );
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
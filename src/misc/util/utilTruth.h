@@ -24,6 +24,13 @@
 ////////////////////////////////////////////////////////////////////////
 ///                          INCLUDES                                ///
 ////////////////////////////////////////////////////////////////////////
+
+// the multi-word kernels process two words at a time when the compiler
+// targets SSE2 (always the case on x86-64); ABC_NO_SIMD disables this
+#if !defined(ABC_NO_SIMD) && defined(__SSE2__)
+#define ABC_TT_SSE2
+#include <emmintrin.h>
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                         PARAMETERS                               ///
@@ -205,6 +212,152 @@ static inline void Abc_TtMask( word * pTruth, int nWords, int nBits )
             pTruth[w] = 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Word-parallel kernels of the multi-word operations.]
+
+  Description [The in-word kernels exchange, cofactor, or compare the bits 
+  selected by Mask with the bits Shift positions above them in each word. 
+  The block kernels do the same for the words Step positions apart in each 
+  block of 2*Step words. The vector loops require no alignment, and the 
+  scalar loops finish the remaining words.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Abc_TtDeltaSwap( word t, word Mask, int Shift )
+{
+    word Delta = ((t >> Shift) ^ t) & Mask;
+    return t ^ Delta ^ (Delta << Shift);
+}
+static inline void Abc_TtWordsDeltaSwap( word * pTruth, int nWords, word Mask, int Shift )
+{
+    int w = 0;
+#ifdef ABC_TT_SSE2
+    __m128i M = _mm_set1_epi64x( (long long)Mask ), S = _mm_cvtsi32_si128( Shift );
+    for ( ; w + 2 <= nWords; w += 2 )
+    {
+        __m128i t = _mm_loadu_si128( (__m128i *)(pTruth + w) );
+        __m128i d = _mm_and_si128( _mm_xor_si128(_mm_srl_epi64(t, S), t), M );
+        _mm_storeu_si128( (__m128i *)(pTruth + w), _mm_xor_si128(t, _mm_xor_si128(d, _mm_sll_epi64(d, S))) );
+    }
+#endif
+    for ( ; w < nWords; w++ )
+        pTruth[w] = Abc_TtDeltaSwap( pTruth[w], Mask, Shift );
+}
+static inline void Abc_TtWordsCofactor( word * pTruth, int nWords, word Mask, int Shift, int fCof1 )
+{
+    int w = 0;
+#ifdef ABC_TT_SSE2
+    __m128i M = _mm_set1_epi64x( (long long)Mask ), S = _mm_cvtsi32_si128( Shift );
+    for ( ; w + 2 <= nWords; w += 2 )
+    {
+        __m128i t = _mm_loadu_si128( (__m128i *)(pTruth + w) );
+        t = fCof1 ? _mm_andnot_si128( M, t ) : _mm_and_si128( t, M );
+        t = fCof1 ? _mm_or_si128( t, _mm_srl_epi64(t, S) ) : _mm_or_si128( t, _mm_sll_epi64(t, S) );
+        _mm_storeu_si128( (__m128i *)(pTruth + w), t );
+    }
+#endif
+    if ( fCof1 )
+        for ( ; w < nWords; w++ )
+            pTruth[w] = (pTruth[w] & ~Mask) | ((pTruth[w] & ~Mask) >> Shift);
+    else
+        for ( ; w < nWords; w++ )
+            pTruth[w] = (pTruth[w] & Mask) | ((pTruth[w] & Mask) << Shift);
+}
+static inline int Abc_TtWordsHasDelta( word * pTruth, int nWords, word Mask, int Shift )
+{
+    int w = 0;
+#ifdef ABC_TT_SSE2
+    __m128i M = _mm_set1_epi64x( (long long)Mask ), S = _mm_cvtsi32_si128( Shift ), Z = _mm_setzero_si128();
+    for ( ; w + 2 <= nWords; w += 2 )
+    {
+        __m128i t = _mm_loadu_si128( (__m128i *)(pTruth + w) );
+        if ( _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(_mm_xor_si128(_mm_srl_epi64(t, S), t), M), Z)) != 0xFFFF )
+            return 1;
+    }
+#endif
+    for ( ; w < nWords; w++ )
+        if ( ((pTruth[w] >> Shift) ^ pTruth[w]) & Mask )
+            return 1;
+    return 0;
+}
+static inline void Abc_TtBlocksDeltaSwap( word * pTruth, int nWords, word Mask, int Shift, int Step )
+{
+    word * pLimit = pTruth + nWords, Delta;
+    int i;
+#ifdef ABC_TT_SSE2
+    __m128i M = _mm_set1_epi64x( (long long)Mask ), S = _mm_cvtsi32_si128( Shift );
+#endif
+    for ( ; pTruth < pLimit; pTruth += 2*Step )
+    {
+        i = 0;
+#ifdef ABC_TT_SSE2
+        for ( ; i + 2 <= Step; i += 2 )
+        {
+            __m128i t0 = _mm_loadu_si128( (__m128i *)(pTruth + i) );
+            __m128i t1 = _mm_loadu_si128( (__m128i *)(pTruth + i + Step) );
+            __m128i d  = _mm_and_si128( _mm_xor_si128(_mm_srl_epi64(t0, S), t1), M );
+            _mm_storeu_si128( (__m128i *)(pTruth + i),        _mm_xor_si128(t0, _mm_sll_epi64(d, S)) );
+            _mm_storeu_si128( (__m128i *)(pTruth + i + Step), _mm_xor_si128(t1, d) );
+        }
+#endif
+        for ( ; i < Step; i++ )
+        {
+            Delta = ((pTruth[i] >> Shift) ^ pTruth[i + Step]) & Mask;
+            pTruth[i]        ^= Delta << Shift;
+            pTruth[i + Step] ^= Delta;
+        }
+    }
+}
+static inline void Abc_TtBlocksSwap( word * pTruth, int nWords, int Step, int iStep )
+{
+    // exchanges the upper halves of the iStep-word blocks in the lower half with
+    // the lower halves of the iStep-word blocks in the upper half (iStep <= Step)
+    word * pLimit = pTruth + nWords;
+    int i, j;
+    for ( ; pTruth < pLimit; pTruth += 2*Step )
+        for ( i = 0; i < Step; i += 2*iStep )
+        {
+            j = 0;
+#ifdef ABC_TT_SSE2
+            for ( ; j + 2 <= iStep; j += 2 )
+            {
+                __m128i t0 = _mm_loadu_si128( (__m128i *)(pTruth + iStep + i + j) );
+                __m128i t1 = _mm_loadu_si128( (__m128i *)(pTruth + Step + i + j) );
+                _mm_storeu_si128( (__m128i *)(pTruth + iStep + i + j), t1 );
+                _mm_storeu_si128( (__m128i *)(pTruth + Step + i + j),  t0 );
+            }
+#endif
+            for ( ; j < iStep; j++ )
+                ABC_SWAP( word, pTruth[iStep + i + j], pTruth[Step + i + j] );
+        }
+}
+static inline int Abc_TtBlocksDiffer( word * pTruth, int nWords, int Step )
+{
+    word * pLimit = pTruth + nWords;
+    int i;
+    for ( ; pTruth < pLimit; pTruth += 2*Step )
+    {
+        i = 0;
+#ifdef ABC_TT_SSE2
+        for ( ; i + 2 <= Step; i += 2 )
+        {
+            __m128i t0 = _mm_loadu_si128( (__m128i *)(pTruth + i) );
+            __m128i t1 = _mm_loadu_si128( (__m128i *)(pTruth + i + Step) );
+            if ( _mm_movemask_epi8(_mm_cmpeq_epi8(t0, t1)) != 0xFFFF )
+                return 1;
+        }
+#endif
+        for ( ; i < Step; i++ )
+            if ( pTruth[i] != pTruth[i + Step] )
+                return 1;
+    }
+    return 0;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -631,11 +784,7 @@ static inline void Abc_TtCofactor0( word * pTruth, int nWords, int iVar )
     if ( nWords == 1 )
         pTruth[0] = ((pTruth[0] & s_Truths6Neg[iVar]) << (1 << iVar)) | (pTruth[0] & s_Truths6Neg[iVar]);
     else if ( iVar <= 5 )
-    {
-        int w, shift = (1 << iVar);
-        for ( w = 0; w < nWords; w++ )
-            pTruth[w] = ((pTruth[w] & s_Truths6Neg[iVar]) << shift) | (pTruth[w] & s_Truths6Neg[iVar]);
-    }
+        Abc_TtWordsCofactor( pTruth, nWords, s_Truths6Neg[iVar], 1 << iVar, 0 );
     else // if ( iVar > 5 )
     {
         word * pLimit = pTruth + nWords;
@@ -650,11 +799,7 @@ static inline void Abc_TtCofactor1( word * pTruth, int nWords, int iVar )
     if ( nWords == 1 )
         pTruth[0] = (pTruth[0] & s_Truths6[iVar]) | ((pTruth[0] & s_Truths6[iVar]) >> (1 << iVar));
     else if ( iVar <= 5 )
-    {
-        int w, shift = (1 << iVar);
-        for ( w = 0; w < nWords; w++ )
-            pTruth[w] = (pTruth[w] & s_Truths6[iVar]) | ((pTruth[w] & s_Truths6[iVar]) >> shift);
-    }
+        Abc_TtWordsCofactor( pTruth, nWords, s_Truths6Neg[iVar], 1 << iVar, 1 );
     else // if ( iVar > 5 )
     {
         word * pLimit = pTruth + nWords;
@@ -1160,24 +1305,8 @@ static inline int Abc_TtHasVar( word * t, int nVars, int iVar )
     if ( nVars <= 6 )
         return Abc_Tt6HasVar( t[0], iVar );
     if ( iVar < 6 )
-    {
-        int i, Shift = (1 << iVar);
-        int nWords = Abc_TtWordNum( nVars );
-        for ( i = 0; i < nWords; i++ )
-            if ( ((t[i] >> Shift) & s_Truths6Neg[iVar]) != (t[i] & s_Truths6Neg[iVar]) )
-                return 1;
-        return 0;
-    }
-    else
-    {
-        int i, Step = (1 << (iVar - 6));
-        word * tLimit = t + Abc_TtWordNum( nVars );
-        for ( ; t < tLimit; t += 2*Step )
-            for ( i = 0; i < Step; i++ )
-                if ( t[i] != t[Step+i] )
-                    return 1;
-        return 0;
-    }
+        return Abc_TtWordsHasDelta( t, Abc_TtWordNum(nVars), s_Truths6Neg[iVar], 1 << iVar );
+    return Abc_TtBlocksDiffer( t, Abc_TtWordNum(nVars), Abc_TtWordNum(iVar) );
 }
 static inline int Abc_TtSupport( word * t, int nVars )
 {
@@ -1329,18 +1458,14 @@ static inline int Abc_Tt6IsXorType( word t, int nVars )
 ***********************************************************************/
 static inline word Abc_Tt6Flip( word Truth, int iVar )
 {
-    return Truth = ((Truth << (1 << iVar)) & s_Truths6[iVar]) | ((Truth & s_Truths6[iVar]) >> (1 << iVar));
+    return Abc_TtDeltaSwap( Truth, s_Truths6Neg[iVar], 1 << iVar );
 }
 static inline void Abc_TtFlip( word * pTruth, int nWords, int iVar )
 {
     if ( nWords == 1 )
         pTruth[0] = ((pTruth[0] << (1 << iVar)) & s_Truths6[iVar]) | ((pTruth[0] & s_Truths6[iVar]) >> (1 << iVar));
 	else if ( iVar <= 5 )
-	{
-		int w, shift = (1 << iVar);
-		for ( w = 0; w < nWords; w++ )
-            pTruth[w] = ((pTruth[w] << shift) & s_Truths6[iVar]) | ((pTruth[w] & s_Truths6[iVar]) >> shift);
-	}
+        Abc_TtWordsDeltaSwap( pTruth, nWords, s_Truths6Neg[iVar], 1 << iVar );
 	else // if ( iVar > 5 )
 	{
         word * pLimit = pTruth + nWords;
@@ -1389,38 +1514,23 @@ static inline word Abc_Tt6Permute_rec( word t, int * pPerm, int nVars )
 ***********************************************************************/
 static inline word Abc_Tt6SwapAdjacent( word Truth, int iVar )
 {
-    return (Truth & s_PMasks[iVar][0]) | ((Truth & s_PMasks[iVar][1]) << (1 << iVar)) | ((Truth & s_PMasks[iVar][2]) >> (1 << iVar));
+    return Abc_TtDeltaSwap( Truth, s_PMasks[iVar][1], 1 << iVar );
 }
 static inline void Abc_TtSwapAdjacent( word * pTruth, int nWords, int iVar )
 {
     if ( iVar < 5 )
-    {
-        int i, Shift = (1 << iVar);
-        for ( i = 0; i < nWords; i++ )
-            pTruth[i] = (pTruth[i] & s_PMasks[iVar][0]) | ((pTruth[i] & s_PMasks[iVar][1]) << Shift) | ((pTruth[i] & s_PMasks[iVar][2]) >> Shift);
-    }
+        Abc_TtWordsDeltaSwap( pTruth, nWords, s_PMasks[iVar][1], 1 << iVar );
     else if ( iVar == 5 )
-    {
-        unsigned * pTruthU = (unsigned *)pTruth;
-        unsigned * pLimitU = (unsigned *)(pTruth + nWords);
-		for ( ; pTruthU < pLimitU; pTruthU += 4 )
-            ABC_SWAP( unsigned, pTruthU[1], pTruthU[2] );
-    }
+        Abc_TtBlocksDeltaSwap( pTruth, nWords, s_Truths6Neg[5], 32, 1 );
     else // if ( iVar > 5 )
-    {
-        word * pLimit = pTruth + nWords;
-		int i, iStep = Abc_TtWordNum(iVar);
-		for ( ; pTruth < pLimit; pTruth += 4*iStep )
-			for ( i = 0; i < iStep; i++ )
-                ABC_SWAP( word, pTruth[i + iStep], pTruth[i + 2*iStep] );
-    }
+        Abc_TtBlocksSwap( pTruth, nWords, 2*Abc_TtWordNum(iVar), Abc_TtWordNum(iVar) );
 }
 static inline word Abc_Tt6SwapVars( word t, int iVar, int jVar )
 {
     word * s_PMasks = s_PPMasks[iVar][jVar];
     int shift = (1 << jVar) - (1 << iVar);
     assert( iVar < jVar );
-    return (t & s_PMasks[0]) | ((t & s_PMasks[1]) << shift) | ((t & s_PMasks[2]) >> shift);
+    return Abc_TtDeltaSwap( t, s_PMasks[1], shift );
 }
 static inline void Abc_TtSwapVars( word * pTruth, int nVars, int iVar, int jVar )
 {
@@ -1436,39 +1546,15 @@ static inline void Abc_TtSwapVars( word * pTruth, int nVars, int iVar, int jVar
     }
 	if ( jVar <= 5 )
     {
-        word * s_PMasks = s_PPMasks[iVar][jVar];
-	    int nWords = Abc_TtWordNum(nVars);
-		int w, shift = (1 << jVar) - (1 << iVar);
-		for ( w = 0; w < nWords; w++ )
-            pTruth[w] = (pTruth[w] & s_PMasks[0]) | ((pTruth[w] & s_PMasks[1]) << shift) | ((pTruth[w] & s_PMasks[2]) >> shift);
+        Abc_TtWordsDeltaSwap( pTruth, Abc_TtWordNum(nVars), s_PPMasks[iVar][jVar][1], (1 << jVar) - (1 << iVar) );
         return;
 	}
 	if ( iVar <= 5 && jVar > 5 )
 	{
-	    word low2High, high2Low;
-        word * pLimit = pTruth + Abc_TtWordNum(nVars);
-        int j, jStep = Abc_TtWordNum(jVar);
-		int shift = 1 << iVar;
-		for ( ; pTruth < pLimit; pTruth += 2*jStep )
-			for ( j = 0; j < jStep; j++ )
-			{
-                low2High = (pTruth[j] & s_Truths6[iVar]) >> shift;
-                high2Low = (pTruth[j+jStep] << shift) & s_Truths6[iVar];
-                pTruth[j] = (pTruth[j] & ~s_Truths6[iVar]) | high2Low;
-                pTruth[j+jStep] = (pTruth[j+jStep] & s_Truths6[iVar]) | low2High;
-			}
+        Abc_TtBlocksDeltaSwap( pTruth, Abc_TtWordNum(nVars), s_Truths6Neg[iVar], 1 << iVar, Abc_TtWordNum(jVar) );
         return;
 	}
-	{
-        word * pLimit = pTruth + Abc_TtWordNum(nVars);
-		int i, iStep = Abc_TtWordNum(iVar);
-		int j, jStep = Abc_TtWordNum(jVar);
-		for ( ; pTruth < pLimit; pTruth += 2*jStep )
-			for ( i = 0; i < jStep; i += 2*iStep )
-				for ( j = 0; j < iStep; j++ )
-                    ABC_SWAP( word, pTruth[iStep + i + j], pTruth[jStep + i + j] );
-        return;
-	}	
+    Abc_TtBlocksSwap( pTruth, Abc_TtWordNum(nVars), Abc_TtWordNum(jVar), Abc_TtWordNum(iVar) );
 }
 // moves one var (v) to the given position (p)
 static inline void Abc_TtMoveVar( word * pF, int nVars, int * V2P, int * P2V, int v, int p )
@@ -0,0 +1,175 @@
+/**CFile****************************************************************
+
+  FileName    [utilTsim.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Ternary simulation.]
+
+  Synopsis    [Two-rail ternary simulation kernels.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: utilTsim.h,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilTsim_h
+#define ABC__misc__util__utilTsim_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// A ternary value is represented by two rails: the first rail is set if
+// the value may be 0, the second rail is set if the value may be 1.
+// Constant 0, constant 1, and X are 1, 2, and 3, as GIA_ZER, GIA_ONE,
+// and GIA_UND in "gia.h". Complementation swaps the rails, while AND
+// is the OR of the first rails and the AND of the second rails.
+
+// In the bit-parallel form, the ternary values of an object are stored
+// as nWords words of the first rail followed by nWords words of the
+// second rail, so each bit position is an independent simulation lane.
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Ternary operations on the two-bit encoding.]
+
+  Description [Branch-free versions of the scalar operations.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_TsimNotCond( int Value, int fCompl )
+{
+    return fCompl ? ((Value & 1) << 1) | (Value >> 1) : Value;
+}
+static inline int Abc_TsimAnd( int Value0, int Value1 )
+{
+    return ((Value0 | Value1) & 1) | (Value0 & Value1 & 2);
+}
+static inline int Abc_TsimAndCond( int Value0, int fCompl0, int Value1, int fCompl1 )
+{
+    return Abc_TsimAnd( Abc_TsimNotCond(Value0, fCompl0), Abc_TsimNotCond(Value1, fCompl1) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns the same ternary value in all lanes.]
+
+  Description [The value is 1 (const 0), 2 (const 1) or 3 (X).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_TsimWordsConst( word * pRes, int Value, int nWords )
+{
+    word Rail0 = (Value & 1) ? ~(word)0 : 0;
+    word Rail1 = (Value & 2) ? ~(word)0 : 0;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pRes[w] = Rail0, pRes[nWords+w] = Rail1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the value X in the lanes given by the mask.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_TsimWordsSetX( word * pRes, word * pMask, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pRes[w] |= pMask[w], pRes[nWords+w] |= pMask[w];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the buffer and the AND gate in all lanes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_TsimWordsBuf( word * pRes, word * p0, int fCompl0, int nWords )
+{
+    word * p00 = fCompl0 ? p0 + nWords : p0;
+    word * p01 = fCompl0 ? p0 : p0 + nWords;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pRes[w] = p00[w], pRes[nWords+w] = p01[w];
+}
+static inline void Abc_TsimWordsAnd( word * pRes, word * p0, int fCompl0, word * p1, int fCompl1, int nWords )
+{
+    word * p00 = fCompl0 ? p0 + nWords : p0;
+    word * p01 = fCompl0 ? p0 : p0 + nWords;
+    word * p10 = fCompl1 ? p1 + nWords : p1;
+    word * p11 = fCompl1 ? p1 : p1 + nWords;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+    {
+        pRes[w]        = p00[w] | p10[w];
+        pRes[nWords+w] = p01[w] & p11[w];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the lanes where the value is the given constant.]
+
+  Description [The constant is 0 or 1. The result is written into pRes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_TsimWordsIsConst( word * pRes, word * p, int fConst1, int nWords )
+{
+    word * pOther = fConst1 ? p : p + nWords; // the rail that should be empty
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pRes[w] = ~pOther[w];
+}
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
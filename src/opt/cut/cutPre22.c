@@ -149,7 +149,7 @@ static void Cut_CellSuppMin( Cut_Cell_t * pCell );
 static void Cut_CellCrossBar( Cut_Cell_t * pCell );
 
 
-static Cut_CMan_t * s_pCMan = NULL;
+static ABC_THREAD_LOCAL Cut_CMan_t * s_pCMan = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
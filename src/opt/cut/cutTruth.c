@@ -125,7 +125,7 @@ void Cut_TruthNCanonicize( Cut_Cut_t * pCut )
 ***********************************************************************/
 void Cut_TruthComputeOld( Cut_Cut_t * pCut, Cut_Cut_t * pCut0, Cut_Cut_t * pCut1, int fCompl0, int fCompl1 )
 {
-    static unsigned uTruth0[8], uTruth1[8];
+    static ABC_THREAD_LOCAL unsigned uTruth0[8], uTruth1[8];
     int nTruthWords = Cut_TruthWords( pCut->nVarsMax );
     unsigned * pTruthRes;
     int i, uPhase;
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "darInt.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,6 +28,24 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the smallest number of nodes per thread in one level
+#define DAR_THREAD_NODES_MIN  256
+
+typedef struct Dar_ThData_t_ Dar_ThData_t;
+struct Dar_ThData_t_
+{
+    Dar_Man_t        Man;         // the copy of the manager (with private counters)
+    Vec_Int_t *      vLevel;      // the nodes of the current level
+    int              iBeg;        // the first node of the thread
+    int              iEnd;        // the last node of the thread (exclusive)
+    int              fSkipTtMin;  // skip truth table minimization
+    Vec_Int_t *      vGains;      // the best gain and the best cut of each node
+};
+
+#ifdef ABC_USE_PTHREADS
+static int Dar_ManRewriteDeferred( Dar_Man_t * p, int nProcs );
+#endif
+
 // iterator over the nodes in the topological order
 #define Aig_ManForEachNodeInOrder( p, pObj )                                    \
     for ( assert(p->pOrderData), p->iPrev = 0, p->iNext = p->pOrderData[1];     \
@@ -58,12 +77,169 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fUseZeros    =  0;
     pPars->fPower       =  0;
     pPars->fRecycle     =  1;
+    pPars->nProcs       =  1;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
 }
 
 #define MAX_VAL 10
 
+/**Function*************************************************************
+
+  Synopsis    [Checks that the node can be expressed using the cut leaves.]
+
+  Description [Used by the deferred rewriting, where the cuts are computed
+  before the AIG is modified. The cut remains functionally correct because
+  each replacement preserves the functions of the nodes, but the node may 
+  appear in the TFI of a leaf, which would create a combinational loop. 
+  The levels are assumed to be up to date, which is the case when fanouts 
+  are represented. Returns 0 if the node is in the TFI of a leaf.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dar_ManObjIsInTfi_rec( Aig_Man_t * p, Aig_Obj_t * pNode, Aig_Obj_t * pObj )
+{
+    if ( pNode == pObj )
+        return 1;
+    if ( pNode->Level <= pObj->Level || Aig_ObjIsTravIdCurrent(p, pNode) )
+        return 0;
+    Aig_ObjSetTravIdCurrent(p, pNode);
+    if ( Dar_ManObjIsInTfi_rec( p, Aig_ObjFanin0(pNode), pObj ) )
+        return 1;
+    return Aig_ObjIsNode(pNode) && Dar_ManObjIsInTfi_rec( p, Aig_ObjFanin1(pNode), pObj );
+}
+static int Dar_ManCutIsValid( Aig_Man_t * p, Aig_Obj_t * pObj, Dar_Cut_t * pCut )
+{
+    Aig_Obj_t * pLeaf;
+    int i;
+    assert( p->pFanData != NULL );
+    Dar_CutForEachLeaf( p, pCut, pLeaf, i )
+    {
+        if ( pLeaf == NULL || pLeaf->Level < pObj->Level )
+            continue;
+        Aig_ManIncrementTravId( p );
+        if ( Dar_ManObjIsInTfi_rec( p, pLeaf, pObj ) )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the node by a constant or a leaf if it has a trivial cut.]
+
+  Description [Returns 1 if the node is replaced.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dar_ManRewriteTrivial( Dar_Man_t * p, Aig_Obj_t * pObj, int fCheck )
+{
+    Dar_Cut_t * pCut;
+    Aig_Obj_t * pObjNew;
+    int k;
+    // check if there is a trivial cut
+    Dar_ObjForEachCut( pObj, pCut, k )
+        if ( pCut->nLeaves == 0 || (pCut->nLeaves == 1 && pCut->pLeaves[0] != pObj->Id && Aig_ManObj(p->pAig, pCut->pLeaves[0])) )
+            if ( !fCheck || Dar_ManCutIsValid(p->pAig, pObj, pCut) )
+                break;
+    if ( k == (int)pObj->nCuts )
+        return 0;
+    assert( pCut->nLeaves < 2 );
+    if ( pCut->nLeaves == 0 ) // replace by constant
+    {
+        assert( pCut->uTruth == 0 || pCut->uTruth == 0xFFFF );
+        pObjNew = Aig_NotCond( Aig_ManConst1(p->pAig), pCut->uTruth==0 );
+    }
+    else
+    {
+        assert( pCut->uTruth == 0xAAAA || pCut->uTruth == 0x5555 );
+        pObjNew = Aig_NotCond( Aig_ManObj(p->pAig, pCut->pLeaves[0]), pCut->uTruth==0x5555 );
+    }
+    // remove the old cuts
+    Dar_ObjSetCuts( pObj, NULL );
+    // replace the node
+    Aig_ObjReplace( p->pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the cuts of the node.]
+
+  Description [Evaluates all cuts if kCut is -1 and the given cut otherwise.
+  If fCheck is set, skips the cuts that are not cuts of the node in the 
+  current AIG. The best gain found so far is not reset. Returns the number
+  of the cut that improved the best gain or -1.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dar_ManRewriteEval( Dar_Man_t * p, Aig_Obj_t * pObj, int Required, int kCut, int fCheck )
+{
+    Dar_Cut_t * pCut;
+    int k, kBest = -1, nMffcSize = -1, GainBest, LevelBest;
+    Dar_ObjForEachCut( pObj, pCut, k )
+    {
+        int nLeavesOld = pCut->nLeaves;
+        if ( kCut >= 0 && k != kCut )
+            continue;
+        if ( fCheck && !Dar_ManCutIsValid(p->pAig, pObj, pCut) )
+            continue;
+        GainBest  = p->GainBest;
+        LevelBest = p->LevelBest;
+        if ( pCut->nLeaves == 3 )
+            pCut->pLeaves[pCut->nLeaves++] = 0;
+        Dar_LibEval( p, pObj, pCut, Required, &nMffcSize );
+        pCut->nLeaves = nLeavesOld; 
+        if ( p->GainBest != GainBest || p->LevelBest != LevelBest )
+            kBest = k;
+    }
+    return kBest;
+}
+static inline int Dar_ManRewriteGainIsGood( Dar_Man_t * p )
+{
+    return p->GainBest > 0 || (p->GainBest == 0 && p->pPars->fUseZeros);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the node by the best subgraph found.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManRewriteCommit( Dar_Man_t * p, Aig_Obj_t * pObj, int Required )
+{
+    Aig_Obj_t * pObjNew;
+    int nNodeBefore, nNodeAfter;
+    // remove the old cuts
+    Dar_ObjSetCuts( pObj, NULL );
+    // if we end up here, a rewriting step is accepted
+    nNodeBefore = Aig_ManNodeNum( p->pAig );
+    pObjNew = Dar_LibBuildBest( p ); // pObjNew can be complemented!
+    pObjNew = Aig_NotCond( pObjNew, Aig_ObjPhaseReal(pObjNew) ^ pObj->fPhase );
+    assert( (int)Aig_Regular(pObjNew)->Level <= Required );
+    // replace the node
+    Aig_ObjReplace( p->pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
+    // compare the gains
+    nNodeAfter = Aig_ManNodeNum( p->pAig );
+    assert( p->GainBest <= nNodeBefore - nNodeAfter );
+    // count gains of this class
+    p->ClassGains[p->ClassBest] += nNodeBefore - nNodeAfter;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -80,12 +256,11 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     extern Vec_Int_t * Saig_ManComputeSwitchProbs( Aig_Man_t * p, int nFrames, int nPref, int fProbOne );
     Dar_Man_t * p;
 //    Bar_Progress_t * pProgress;
-    Dar_Cut_t * pCut;
-    Aig_Obj_t * pObj, * pObjNew;
-    int i, k, nNodesOld, nNodeBefore, nNodeAfter, Required;
+    Aig_Obj_t * pObj;
+    int i, nNodesOld, Required;
     abctime clk = 0, clkStart;
     int Counter = 0;
-    int nMffcSize;//, nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
+//    int nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
     // prepare the library
     Dar_LibPrepare( pPars->nSubgMax ); 
     // create rewriting manager
@@ -106,6 +281,12 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     p->nNodesInit = Aig_ManNodeNum(pAig);
     nNodesOld = Vec_PtrSize( pAig->vObjs );
 
+#ifdef ABC_USE_PTHREADS
+    // evaluate the nodes using several threads
+    if ( pPars->nProcs > 1 && pPars->fFanout && !pPars->fPower && Dar_ManRewriteDeferred( p, pPars->nProcs ) )
+        goto finish;
+#endif
+
 //    pProgress = Bar_ProgressStart( stdout, nNodesOld );
     Aig_ManForEachObj( pAig, pObj, i )
 //    pProgress = Bar_ProgressStart( stdout, 100 );
@@ -141,63 +322,25 @@ clk = Abc_Clock();
 p->timeCuts += Abc_Clock() - clk;
 
         // check if there is a trivial cut
-        Dar_ObjForEachCut( pObj, pCut, k )
-            if ( pCut->nLeaves == 0 || (pCut->nLeaves == 1 && pCut->pLeaves[0] != pObj->Id && Aig_ManObj(p->pAig, pCut->pLeaves[0])) )
-                break;
-        if ( k < (int)pObj->nCuts )
-        {
-            assert( pCut->nLeaves < 2 );
-            if ( pCut->nLeaves == 0 ) // replace by constant
-            {
-                assert( pCut->uTruth == 0 || pCut->uTruth == 0xFFFF );
-                pObjNew = Aig_NotCond( Aig_ManConst1(p->pAig), pCut->uTruth==0 );
-            }
-            else
-            {
-                assert( pCut->uTruth == 0xAAAA || pCut->uTruth == 0x5555 );
-                pObjNew = Aig_NotCond( Aig_ManObj(p->pAig, pCut->pLeaves[0]), pCut->uTruth==0x5555 );
-            }
-            // remove the old cuts
-            Dar_ObjSetCuts( pObj, NULL );
-            // replace the node
-            Aig_ObjReplace( pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
+        if ( Dar_ManRewriteTrivial( p, pObj, 0 ) )
             continue;
-        }
 
         // evaluate the cuts
+        Required = pAig->vLevelR? Aig_ObjRequiredLevel(pAig, pObj) : ABC_INFINITY;
         p->GainBest = -1;
-        nMffcSize   = -1;
-        Required    = pAig->vLevelR? Aig_ObjRequiredLevel(pAig, pObj) : ABC_INFINITY;
-        Dar_ObjForEachCut( pObj, pCut, k )
-        {
-            int nLeavesOld = pCut->nLeaves;
-            if ( pCut->nLeaves == 3 )
-                pCut->pLeaves[pCut->nLeaves++] = 0;
-            Dar_LibEval( p, pObj, pCut, Required, &nMffcSize );
-            pCut->nLeaves = nLeavesOld; 
-        }
+        Dar_ManRewriteEval( p, pObj, Required, -1, 0 );
         // check the best gain
-        if ( !(p->GainBest > 0 || (p->GainBest == 0 && p->pPars->fUseZeros)) )
+        if ( !Dar_ManRewriteGainIsGood(p) )
         {
 //            Aig_ObjOrderAdvance( pAig );
             continue;
         }
 //        nMffcGains[p->GainBest < MAX_VAL ? p->GainBest : MAX_VAL][nMffcSize < MAX_VAL ? nMffcSize : MAX_VAL]++;
-        // remove the old cuts
-        Dar_ObjSetCuts( pObj, NULL );
-        // if we end up here, a rewriting step is accepted
-        nNodeBefore = Aig_ManNodeNum( pAig );
-        pObjNew = Dar_LibBuildBest( p ); // pObjNew can be complemented!
-        pObjNew = Aig_NotCond( pObjNew, Aig_ObjPhaseReal(pObjNew) ^ pObj->fPhase );
-        assert( (int)Aig_Regular(pObjNew)->Level <= Required );
-        // replace the node
-        Aig_ObjReplace( pAig, pObj, pObjNew, p->pPars->fUpdateLevel );
-        // compare the gains
-        nNodeAfter = Aig_ManNodeNum( pAig );
-        assert( p->GainBest <= nNodeBefore - nNodeAfter );
-        // count gains of this class
-        p->ClassGains[p->ClassBest] += nNodeBefore - nNodeAfter;
+        Dar_ManRewriteCommit( p, pObj, Required );
     }
+#ifdef ABC_USE_PTHREADS
+finish:
+#endif
 //    Aig_ManOrderStop( pAig );
 /*
     printf( "Distribution of gain (row) by MFFC size (column) %s 0-costs:\n", p->pPars->fUseZeros? "with":"without" );
@@ -273,6 +416,285 @@ int Dar_ManCutCount( Aig_Man_t * pAig, int * pnCutsK )
     return nCuts;
 }
 
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts for the share of the level assigned to the thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManCutsWorker( void * pArg )
+{
+    Dar_ThData_t * pThData = (Dar_ThData_t *)pArg;
+    int i;
+    for ( i = pThData->iBeg; i < pThData->iEnd; i++ )
+        Dar_ObjExpandCuts( &pThData->Man, Aig_ManObj(pThData->Man.pAig, Vec_IntEntry(pThData->vLevel, i)), pThData->fSkipTtMin );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts for all nodes level by level using several threads.]
+
+  Description [The cut sets of the nodes of each level are allocated in 
+  the topological order, after which the cuts are computed in parallel.
+  The cuts of a node only depend on the cuts of its fanins, so the result 
+  is the same as that of the sequential computation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_ManComputeCutsLevels( Dar_Man_t * p, int fSkipTtMin, int nProcs )
+{
+    Dar_ThData_t * pThData;
+    Util_Pool_t * pPool;
+    Util_Task_t ** ppTasks;
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel, * vLevelIds;
+    Aig_Obj_t * pObj;
+    int i, k, Id, Level, nThreads, nNodes;
+    // group the nodes by levels
+    vLevelIds = Vec_IntStart( Aig_ManObjNumMax(p->pAig) );
+    vLevels = Vec_WecAlloc( 100 );
+    Aig_ManForEachNode( p->pAig, pObj, i )
+    {
+        Level = 1 + Abc_MaxInt( Vec_IntEntry(vLevelIds, Aig_ObjId(Aig_Regular(Aig_ObjReal_rec(Aig_ObjChild0(pObj))))), 
+                                Vec_IntEntry(vLevelIds, Aig_ObjId(Aig_Regular(Aig_ObjReal_rec(Aig_ObjChild1(pObj))))) );
+        Vec_IntWriteEntry( vLevelIds, i, Level );
+        Vec_WecPush( vLevels, Level, i );
+    }
+    Vec_IntFree( vLevelIds );
+    // the calling thread computes the first share of each level
+    pPool   = Util_PoolGlobal( nProcs - 1 );
+    pThData = ABC_CALLOC( Dar_ThData_t, nProcs );
+    ppTasks = ABC_CALLOC( Util_Task_t *, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].Man = *p;
+        pThData[i].Man.nCutsAll = pThData[i].Man.nCutsTried = 0;
+        pThData[i].Man.nCutsSkipped = pThData[i].Man.nCutsUsed = 0;
+        pThData[i].fSkipTtMin = fSkipTtMin;
+    }
+    Vec_WecForEachLevel( vLevels, vLevel, k )
+    {
+        if ( Vec_IntSize(vLevel) == 0 )
+            continue;
+        // prepare the cut sets
+        Vec_IntForEachEntry( vLevel, Id, i )
+            Dar_ObjPrepareCuts( p, Aig_ManObj(p->pAig, Id) );
+        // compute the cuts
+        nNodes   = Vec_IntSize(vLevel);
+        nThreads = Abc_MaxInt( 1, Abc_MinInt(nProcs, nNodes / DAR_THREAD_NODES_MIN) );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            pThData[i].vLevel = vLevel;
+            pThData[i].iBeg   = (int)((word)nNodes * i / nThreads);
+            pThData[i].iEnd   = (int)((word)nNodes * (i + 1) / nThreads);
+        }
+        for ( i = 1; i < nThreads; i++ )
+            ppTasks[i] = Util_PoolSubmit( pPool, Dar_ManCutsWorker, (void *)(pThData + i) );  
+        Dar_ManCutsWorker( pThData );
+        for ( i = 1; i < nThreads; i++ )
+        {
+            Util_TaskWait( ppTasks[i] );
+            Util_TaskFree( ppTasks[i] );
+            ppTasks[i] = NULL;
+        }
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        p->nCutsAll     += pThData[i].Man.nCutsAll;
+        p->nCutsTried   += pThData[i].Man.nCutsTried;
+        p->nCutsSkipped += pThData[i].Man.nCutsSkipped;
+        p->nCutsUsed    += pThData[i].Man.nCutsUsed;
+    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( pThData );
+    Vec_WecFree( vLevels );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the nodes assigned to the thread.]
+
+  Description [The AIG is not modified. For each node with a positive gain
+  (or zero gain, if zero-cost replacements are allowed), records the gain
+  and the number of the best cut.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManEvalWorker( void * pArg )
+{
+    Dar_ThData_t * pThData = (Dar_ThData_t *)pArg;
+    Dar_Man_t * p = &pThData->Man;
+    Dar_Cut_t * pCut;
+    Aig_Obj_t * pObj;
+    int i, k, kBest, Required;
+    // the library is thread-local; it is freed when the worker exits
+    Dar_LibStart();
+    Dar_LibPrepare( p->pPars->nSubgMax ); 
+    for ( i = pThData->iBeg; i < pThData->iEnd; i++ )
+    {
+        pObj = Aig_ManObj( p->pAig, i );
+        if ( pObj == NULL || !Aig_ObjIsNode(pObj) )
+            continue;
+        // the nodes with trivial cuts are replaced later
+        Dar_ObjForEachCut( pObj, pCut, k )
+            if ( pCut->nLeaves == 0 || (pCut->nLeaves == 1 && pCut->pLeaves[0] != pObj->Id) )
+                break;
+        if ( k < (int)pObj->nCuts )
+            continue;
+        Required = p->pAig->vLevelR? Aig_ObjRequiredLevel(p->pAig, pObj) : ABC_INFINITY;
+        p->GainBest = -1;
+        kBest = Dar_ManRewriteEval( p, pObj, Required, -1, 0 );
+        if ( kBest == -1 || !Dar_ManRewriteGainIsGood(p) )
+            continue;
+        Vec_IntWriteEntry( pThData->vGains, 2*i,   p->GainBest );
+        Vec_IntWriteEntry( pThData->vGains, 2*i+1, kBest );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs rewriting with the gains computed by several threads.]
+
+  Description [First, the cuts of all nodes are computed level by level 
+  and the nodes are evaluated by the threads, while the AIG is not 
+  modified. Next, the nodes are visited in the topological order and the
+  replacements are committed one at a time. Before committing, the gain 
+  of the best cut is recomputed in the current AIG, because the MFFC of 
+  the node may overlap with those of the nodes already replaced. If the 
+  gain has decreased, all cuts of the node are evaluated again. Unlike
+  the sequential rewriting, the cuts are not recomputed after the fanin 
+  cone of the node has changed, so the result may be somewhat larger.
+  Returns 0 if the AIG is not in the topological order, in which case 
+  nothing is done.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dar_ManRewriteDeferred( Dar_Man_t * p, int nProcs )
+{
+    Aig_Man_t * pAig = p->pAig;
+    Dar_ThData_t * pThData;
+    Util_Pool_t * pPool;
+    Util_Task_t ** ppTasks;
+    Vec_Int_t * vGains;
+    Aig_Obj_t * pObj;
+    int i, k, nThreads, nNodesOld, Gain, Required;
+    abctime clk;
+    // the cuts are computed level by level
+    if ( Aig_ManBufNum(pAig) > 0 )
+        return 0;
+    Aig_ManForEachNode( pAig, pObj, i )
+        if ( Aig_ObjFaninId0(pObj) > i || Aig_ObjFaninId1(pObj) > i )
+            return 0;
+    // compute the cuts
+clk = Abc_Clock();
+    Aig_MmFixedRestart( p->pMemCuts );
+    Dar_ObjPrepareCuts( p, Aig_ManConst1(pAig) );
+    Aig_ManForEachCi( pAig, pObj, i )
+        Dar_ObjPrepareCuts( p, pObj );
+    Dar_ManComputeCutsLevels( p, 0, nProcs );
+p->timeCuts += Abc_Clock() - clk;
+    // evaluate the nodes
+clk = Abc_Clock();
+    nNodesOld = Vec_PtrSize( pAig->vObjs );
+    vGains    = Vec_IntStartFull( 2 * nNodesOld );
+    nThreads  = Abc_MaxInt( 1, Abc_MinInt(nProcs, nNodesOld / DAR_THREAD_NODES_MIN) );
+    pPool     = Util_PoolGlobal( nThreads - 1 );
+    pThData   = ABC_CALLOC( Dar_ThData_t, nThreads );
+    ppTasks   = ABC_CALLOC( Util_Task_t *, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Dar_Man_t * pMan = &pThData[i].Man;
+        *pMan = *p;
+        pMan->vLeavesBest = Vec_PtrAlloc( 4 );
+        pMan->vMffcTable  = Vec_IntStart( 256 );
+        pMan->vMffcIds    = Vec_IntAlloc( 100 );
+        pMan->vMffcDerefs = Vec_IntAlloc( 100 );
+        pMan->nCutsBad = pMan->nCutsGood = pMan->nTotalSubgs = 0;
+        memset( pMan->ClassTimes, 0, sizeof(int) * 222 );
+        memset( pMan->ClassSubgs, 0, sizeof(int) * 222 );
+        pThData[i].vGains = vGains;
+        pThData[i].iBeg   = (int)((word)nNodesOld * i / nThreads);
+        pThData[i].iEnd   = (int)((word)nNodesOld * (i + 1) / nThreads);
+    }
+    for ( i = 1; i < nThreads; i++ )
+        ppTasks[i] = Util_PoolSubmit( pPool, Dar_ManEvalWorker, (void *)(pThData + i) );  
+    Dar_ManEvalWorker( pThData );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        Util_TaskWait( ppTasks[i] );
+        Util_TaskFree( ppTasks[i] );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        Dar_Man_t * pMan = &pThData[i].Man;
+        p->nCutsBad    += pMan->nCutsBad;
+        p->nCutsGood   += pMan->nCutsGood;
+        p->nTotalSubgs += pMan->nTotalSubgs;
+        for ( k = 0; k < 222; k++ )
+        {
+            p->ClassTimes[k] += pMan->ClassTimes[k];
+            p->ClassSubgs[k] += pMan->ClassSubgs[k];
+        }
+        Vec_PtrFree( pMan->vLeavesBest );
+        Vec_IntFree( pMan->vMffcTable );
+        Vec_IntFree( pMan->vMffcIds );
+        Vec_IntFree( pMan->vMffcDerefs );
+    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( pThData );
+p->timeEval = Abc_Clock() - clk;
+    // commit the replacements
+    Aig_ManForEachObj( pAig, pObj, i )
+    {
+        if ( pAig->Time2Quit && !(i & 256) && Abc_Clock() > pAig->Time2Quit )
+            break;
+        if ( i >= nNodesOld )
+            break;
+        if ( !Aig_ObjIsNode(pObj) )
+            continue;
+        p->nNodesTried++;
+        if ( Dar_ManRewriteTrivial( p, pObj, 1 ) )
+            continue;
+        if ( (Gain = Vec_IntEntry(vGains, 2*i)) == -1 )
+            continue;
+        // recompute the gain of the best cut in the current AIG
+        Required = pAig->vLevelR? Aig_ObjRequiredLevel(pAig, pObj) : ABC_INFINITY;
+        p->GainBest = -1;
+        Dar_ManRewriteEval( p, pObj, Required, Vec_IntEntry(vGains, 2*i+1), 1 );
+        // evaluate all cuts if the gain has decreased
+        if ( p->GainBest < Gain )
+        {
+            p->nNodesReeval++;
+            Dar_ManRewriteEval( p, pObj, Required, -1, 1 );
+        }
+        if ( !Dar_ManRewriteGainIsGood(p) )
+            continue;
+        Dar_ManRewriteCommit( p, pObj, Required );
+    }
+    Vec_IntFree( vGains );
+    return 1;
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -285,6 +707,22 @@ int Dar_ManCutCount( Aig_Man_t * pAig, int * pnCutsK )
 
 ***********************************************************************/
 Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int fVerbose )
+{ 
+    return Dar_ManComputeCutsPar( pAig, nCutsMax, fSkipTtMin, 1, fVerbose );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts for all nodes using the given number of threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_MmFixed_t * Dar_ManComputeCutsPar( Aig_Man_t * pAig, int nCutsMax, int fSkipTtMin, int nProcs, int fVerbose )
 { 
     Dar_Man_t * p;
     Dar_RwrPar_t Pars, * pPars = &Pars; 
@@ -309,6 +747,11 @@ Aig_MmFixed_t * Dar_ManComputeCuts( Aig_Man_t * pAig, int nCutsMax, int fSkipTtM
     Aig_ManForEachCi( pAig, pObj, i )
         Dar_ObjPrepareCuts( p, pObj );
     // compute cuts for each nodes in the topological order
+#ifdef ABC_USE_PTHREADS
+    if ( nProcs > 1 )
+        Dar_ManComputeCutsLevels( p, fSkipTtMin, nProcs );
+    else
+#endif
     Aig_ManForEachNode( pAig, pObj, i )
         Dar_ObjComputeCuts( p, pObj, fSkipTtMin );
     // print verbose stats
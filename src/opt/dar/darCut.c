@@ -736,22 +736,42 @@ void Dar_ManCutsRestart( Dar_Man_t * p, Aig_Obj_t * pRoot )
 
 ***********************************************************************/
 Dar_Cut_t * Dar_ObjComputeCuts( Dar_Man_t * p, Aig_Obj_t * pObj, int fSkipTtMin )
+{
+    assert( !Aig_IsComplement(pObj) );
+    assert( Aig_ObjIsNode(pObj) );
+    assert( Dar_ObjCuts(pObj) == NULL );
+    // set up the first cut
+    Dar_ObjPrepareCuts( p, pObj );
+    // add the cuts derived from the fanin cuts
+    return Dar_ObjExpandCuts( p, pObj, fSkipTtMin );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the cuts derived from the fanin cuts to the prepared cut set.]
+
+  Description [Only reads the cuts of the fanins and writes the cut set
+  of this node, so that it can be called concurrently for the nodes of 
+  one level, provided each thread uses its own copy of the manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dar_Cut_t * Dar_ObjExpandCuts( Dar_Man_t * p, Aig_Obj_t * pObj, int fSkipTtMin )
 {
     Aig_Obj_t * pFanin0 = Aig_ObjReal_rec( Aig_ObjChild0(pObj) );
     Aig_Obj_t * pFanin1 = Aig_ObjReal_rec( Aig_ObjChild1(pObj) );
     Aig_Obj_t * pFaninR0 = Aig_Regular(pFanin0);
     Aig_Obj_t * pFaninR1 = Aig_Regular(pFanin1);
-    Dar_Cut_t * pCutSet, * pCut0, * pCut1, * pCut;
+    Dar_Cut_t * pCutSet = Dar_ObjCuts(pObj), * pCut0, * pCut1, * pCut;
     int i, k; 
 
-    assert( !Aig_IsComplement(pObj) );
-    assert( Aig_ObjIsNode(pObj) );
-    assert( Dar_ObjCuts(pObj) == NULL );
+    assert( pCutSet != NULL );
     assert( Dar_ObjCuts(pFaninR0) != NULL );
     assert( Dar_ObjCuts(pFaninR1) != NULL );
 
-    // set up the first cut
-    pCutSet = Dar_ObjPrepareCuts( p, pObj );
     // make sure fanins cuts are computed
     Dar_ObjForEachCut( pFaninR0, pCut0, i )
     Dar_ObjForEachCut( pFaninR1, pCut1, k )
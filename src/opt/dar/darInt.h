@@ -80,6 +80,10 @@ struct Dar_Man_t_
     int              GainBest;       // the best gain
     int              LevelBest;      // the level of node with the best gain
     int              ClassBest;      // the equivalence class of the best replacement
+    // MFFC in the AIG that is not modified (used by the threads)
+    Vec_Int_t *      vMffcTable;     // hash table of the visited nodes (entry number + 1)
+    Vec_Int_t *      vMffcIds;       // the visited nodes
+    Vec_Int_t *      vMffcDerefs;    // the number of fanouts dereferenced
     // function statistics
     int              nTotalSubgs;    // the total number of subgraphs tried
     int              ClassTimes[222];// the runtimes for each class
@@ -95,6 +99,7 @@ struct Dar_Man_t_
     int              nCutsBad;       // bad cuts due to absent fanin
     int              nCutsGood;      // good cuts
     int              nCutsSkipped;   // skipped bad cuts
+    int              nNodesReeval;   // the nodes whose gain was recomputed
     // timing statistics
     abctime          timeCuts;
     abctime          timeEval;
@@ -136,6 +141,7 @@ extern void            Dar_ManCutsFree( Dar_Man_t * p );
 extern Dar_Cut_t *     Dar_ObjPrepareCuts( Dar_Man_t * p, Aig_Obj_t * pObj );
 extern Dar_Cut_t *     Dar_ObjComputeCuts_rec( Dar_Man_t * p, Aig_Obj_t * pObj );
 extern Dar_Cut_t *     Dar_ObjComputeCuts( Dar_Man_t * p, Aig_Obj_t * pObj, int fSkipTtMin );
+extern Dar_Cut_t *     Dar_ObjExpandCuts( Dar_Man_t * p, Aig_Obj_t * pObj, int fSkipTtMin );
 extern void            Dar_ObjCutPrint( Aig_Man_t * p, Aig_Obj_t * pObj );
 /*=== darData.c ===========================================================*/
 extern Vec_Int_t *     Dar_LibReadNodes();
@@ -21,6 +21,7 @@
 #include "darInt.h"
 #include "aig/gia/gia.h"
 #include "dar.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -105,7 +106,7 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
-static Dar_Lib_t * s_DarLib = NULL;
+static ABC_THREAD_LOCAL Dar_Lib_t * s_DarLib = NULL;
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -590,6 +591,11 @@ Dar_Lib_t * Dar_LibRead()
   SeeAlso     []
 
 ***********************************************************************/
+static void Dar_LibStopThread()
+{
+    if ( s_DarLib != NULL )
+        Dar_LibStop();
+}
 void Dar_LibStart()
 {
 //    abctime clk = Abc_Clock();
@@ -597,6 +603,8 @@ void Dar_LibStart()
         return;
     assert( s_DarLib == NULL );
     s_DarLib = Dar_LibRead();
+    // the library of a pool worker is freed when the worker exits
+    Util_PoolThreadAtExit( Dar_LibStopThread );
 //    printf( "The 4-input library started with %d nodes and %d subgraphs. ", s_DarLib->nObjs - 4, s_DarLib->nSubgrTotal );
 //    ABC_PRT( "Time", Abc_Clock() - clk );
 }
@@ -763,6 +771,83 @@ int Dar_LibCutMarkMffc( Aig_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * p
     return nNodes;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Marks the MFFC of the node without modifying the AIG.]
+
+  Description [The reference counters of the AIG are not changed, while
+  the number of dereferenced fanouts of each visited node is stored in 
+  the hash table of the manager. The node belongs to the MFFC if all of 
+  its fanouts are dereferenced. This way, several threads can compute the 
+  MFFCs in the same AIG. Returns the number of nodes in the MFFC.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int * Dar_LibMffcLookup( Dar_Man_t * p, int Id )
+{
+    int Mask = Vec_IntSize(p->vMffcTable) - 1;
+    int i = (int)((unsigned)Id * 0x9E3779B1 >> 8) & Mask;
+    for ( ; Vec_IntEntry(p->vMffcTable, i); i = (i + 1) & Mask )
+        if ( Vec_IntEntry(p->vMffcIds, Vec_IntEntry(p->vMffcTable, i) - 1) == Id )
+            break;
+    return Vec_IntEntryP( p->vMffcTable, i );
+}
+static inline int * Dar_LibMffcDerefs( Dar_Man_t * p, int Id )
+{
+    int i, * pPlace = Dar_LibMffcLookup( p, Id );
+    if ( *pPlace )
+        return Vec_IntEntryP( p->vMffcDerefs, *pPlace - 1 );
+    Vec_IntPush( p->vMffcIds, Id );
+    Vec_IntPush( p->vMffcDerefs, 0 );
+    *pPlace = Vec_IntSize(p->vMffcIds);
+    if ( 2 * Vec_IntSize(p->vMffcIds) > Vec_IntSize(p->vMffcTable) )
+    {
+        Vec_IntFill( p->vMffcTable, 2 * Vec_IntSize(p->vMffcTable), 0 );
+        for ( i = 0; i < Vec_IntSize(p->vMffcIds); i++ )
+            *Dar_LibMffcLookup( p, Vec_IntEntry(p->vMffcIds, i) ) = i + 1;
+    }
+    return Vec_IntEntryP( p->vMffcDerefs, Vec_IntSize(p->vMffcDerefs) - 1 );
+}
+static inline int Dar_LibMffcIsMember( Dar_Man_t * p, Aig_Obj_t * pObj )
+{
+    int * pPlace = Dar_LibMffcLookup( p, pObj->Id );
+    return *pPlace && Vec_IntEntry(p->vMffcDerefs, *pPlace - 1) == (int)pObj->nRefs;
+}
+int Dar_LibMffcDeref_rec( Dar_Man_t * p, Aig_Obj_t * pNode )
+{
+    Aig_Obj_t * pFanin;
+    int Counter = 0;
+    if ( Aig_ObjIsCi(pNode) || Aig_ObjIsConst1(pNode) )
+        return 0;
+    pFanin = Aig_ObjFanin0(pNode);
+    if ( ++*Dar_LibMffcDerefs(p, pFanin->Id) == (int)pFanin->nRefs )
+        Counter += Dar_LibMffcDeref_rec( p, pFanin );
+    if ( Aig_ObjIsBuf(pNode) )
+        return Counter;
+    pFanin = Aig_ObjFanin1(pNode);
+    if ( ++*Dar_LibMffcDerefs(p, pFanin->Id) == (int)pFanin->nRefs )
+        Counter += Dar_LibMffcDeref_rec( p, pFanin );
+    return Counter + 1;
+}
+int Dar_LibCutMarkMffcFrozen( Dar_Man_t * p, Aig_Obj_t * pRoot, int nLeaves )
+{
+    int i;
+    assert( Aig_ObjIsNode(pRoot) );
+    // remove the previous MFFC in the reverse order
+    for ( i = Vec_IntSize(p->vMffcIds) - 1; i >= 0; i-- )
+        *Dar_LibMffcLookup( p, Vec_IntEntry(p->vMffcIds, i) ) = 0;
+    Vec_IntClear( p->vMffcIds );
+    Vec_IntClear( p->vMffcDerefs );
+    // the cut leaves are never dereferenced completely
+    for ( i = 0; i < nLeaves; i++ )
+        *Dar_LibMffcDerefs( p, Aig_Regular(s_DarLib->pDatas[i].pFunc)->Id ) = -ABC_INFINITY;
+    *Dar_LibMffcDerefs( p, pRoot->Id ) = pRoot->nRefs;
+    return Dar_LibMffcDeref_rec( p, pRoot );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Evaluates one cut.]
@@ -838,7 +923,10 @@ void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
             // update the level to be more accurate
             pData->Level = Aig_Regular(pData->pFunc)->Level;
             // mark the node if it is part of MFFC
-            pData->fMffc = Aig_ObjIsTravIdCurrent(p->pAig, Aig_Regular(pData->pFunc));
+            if ( p->vMffcTable )
+                pData->fMffc = Dar_LibMffcIsMember(p, Aig_Regular(pData->pFunc));
+            else
+                pData->fMffc = Aig_ObjIsTravIdCurrent(p->pAig, Aig_Regular(pData->pFunc));
             // assign the probability
             if ( p->pPars->fPower )
             {
@@ -930,7 +1018,10 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
     if ( !Dar_LibCutMatch(p, pCut) )
         return;
     // mark MFFC of the node
-    nNodesSaved = Dar_LibCutMarkMffc( p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
+    if ( p->vMffcTable )
+        nNodesSaved = Dar_LibCutMarkMffcFrozen( p, pRoot, pCut->nLeaves );
+    else
+        nNodesSaved = Dar_LibCutMarkMffc( p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
     // evaluate the cut
     Class = s_DarLib->pMap[pCut->uTruth];
     Dar_LibEvalAssignNums( p, Class, pRoot );
@@ -76,6 +76,9 @@ void Dar_ManStop( Dar_Man_t * p )
         Aig_MmFixedStop( p->pMemCuts, 0 );
     if ( p->vLeavesBest ) 
         Vec_PtrFree( p->vLeavesBest );
+    Vec_IntFreeP( &p->vMffcTable );
+    Vec_IntFreeP( &p->vMffcIds );
+    Vec_IntFreeP( &p->vMffcDerefs );
     ABC_FREE( p );
 }
 
@@ -105,6 +108,8 @@ void Dar_ManPrintStats( Dar_Man_t * p )
 
     printf( "Bufs = %5d. BufMax = %5d. BufReplace = %6d. BufFix = %6d.  Levels = %4d.\n", 
         Aig_ManBufNum(p->pAig), p->pAig->nBufMax, p->pAig->nBufReplaces, p->pAig->nBufFixes, Aig_ManLevels(p->pAig) );
+    if ( p->pPars->nProcs > 1 )
+        printf( "Threads = %3d. Reevaluated = %8d.\n", p->pPars->nProcs, p->nNodesReeval );
     ABC_PRT( "Cuts  ", p->timeCuts );
     ABC_PRT( "Eval  ", p->timeEval );
     ABC_PRT( "Other ", p->timeOther );
@@ -488,8 +488,8 @@ static inline unsigned Abc_TtSemiCanonicize( word * pTruth, int nVars, char * pC
 ***********************************************************************/
 void Abc_TtCofactorTest10( word * pTruth, int nVars, int N )
 {
-    static word pCopy1[1024];
-    static word pCopy2[1024];
+    static ABC_THREAD_LOCAL word pCopy1[1024];
+    static ABC_THREAD_LOCAL word pCopy2[1024];
     int nWords = Abc_TtWordNum( nVars );
     int i;
     for ( i = 0; i < nVars - 1; i++ )
@@ -580,7 +580,7 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
 {
     if ( fSwapOnly )
     {
-        static word pCopy[1024];
+        static ABC_THREAD_LOCAL word pCopy[1024];
         Abc_TtCopy( pCopy, pTruth, nWords, 0 );
         Abc_TtSwapAdjacent( pCopy, nWords, i );
         if ( Abc_TtCompareRev(pTruth, pCopy, nWords) == 1 )
@@ -591,8 +591,8 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
         return 0;
     }
     {
-        static word pCopy[1024];
-        static word pBest[1024];
+        static ABC_THREAD_LOCAL word pCopy[1024];
+        static ABC_THREAD_LOCAL word pBest[1024];
         int Config = 0;
         // save two copies
         Abc_TtCopy( pCopy, pTruth, nWords, 0 );
@@ -771,7 +771,7 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
         return Config;
     }
     {
-        static word pCopy1[1024];
+        static ABC_THREAD_LOCAL word pCopy1[1024];
         int Config;
         Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
         Config = Abc_TtCofactorPermConfig( pTruth, i, nWords, 0, fNaive );
@@ -821,8 +821,8 @@ unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
 
 #ifdef CANON_VERIFY
     char pCanonPermCopy[16];
-    static word pCopy1[1024];
-    static word pCopy2[1024];
+    static ABC_THREAD_LOCAL word pCopy1[1024];
+    static ABC_THREAD_LOCAL word pCopy2[1024];
     Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
 #endif
 
@@ -924,8 +924,8 @@ unsigned Abc_TtCanonicizePhase( word * pTruth, int nVars )
 //    Counter++;
 
 #ifdef CANON_VERIFY
-    static word pCopy1[1024];
-    static word pCopy2[1024];
+    static ABC_THREAD_LOCAL word pCopy1[1024];
+    static ABC_THREAD_LOCAL word pCopy2[1024];
     Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
 #endif
 
@@ -1030,7 +1030,7 @@ unsigned Abc_TtCanonicizeHie( Abc_TtMan_t * p, word * pTruthInit, int nVars, cha
 {
     int fNaive = 1;
     int pStore[17];
-    static word pTruth[1024];
+    static ABC_THREAD_LOCAL word pTruth[1024];
     unsigned uCanonPhase = 0;
     int nOnes, nWords = Abc_TtWordNum( nVars );
     int i, k, truthId;
@@ -30,8 +30,8 @@ ABC_NAMESPACE_IMPL_START
 extern Fxu_Matrix * Fxu_CreateMatrix( Fxu_Data_t * pData );
 extern void         Fxu_CreateCovers( Fxu_Matrix * p, Fxu_Data_t * pData );
 
-static int s_MemoryTotal;
-static int s_MemoryPeak;
+static ABC_THREAD_LOCAL int s_MemoryTotal;
+static ABC_THREAD_LOCAL int s_MemoryPeak;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -122,7 +122,7 @@ int Nwk_ManCompareAndSaveBest( Nwk_Man_t * pNtk, void * pNtl )
 {
 //    extern void Ntl_WriteBlifLogic( Nwk_Man_t * pNtk, void * pNtl, char * pFileName );
     extern void Nwk_ManDumpBlif( Nwk_Man_t * pNtk, char * pFileName, Vec_Ptr_t * vPiNames, Vec_Ptr_t * vPoNames );
-    static struct ParStruct {
+    static ABC_THREAD_LOCAL struct ParStruct {
         char * pName;  // name of the best saved network
         int    Depth;  // depth of the best saved network
         int    Flops;  // flops in the best saved network 
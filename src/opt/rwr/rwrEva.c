@@ -514,7 +514,7 @@ void Rwr_ScoresClean( Rwr_Man_t * p )
     }
 }
 
-static int Gains[222];
+static ABC_THREAD_LOCAL int Gains[222];
 
 /**Function*************************************************************
 
@@ -46,8 +46,8 @@ struct Rwr_Man5_t_
     stmm_table *       tTableNPN;        // the NPN canonical forms
 };
 
-static Rwr_Man4_t * s_pManRwrExp4 = NULL;
-static Rwr_Man5_t * s_pManRwrExp5 = NULL;
+static ABC_THREAD_LOCAL Rwr_Man4_t * s_pManRwrExp4 = NULL;
+static ABC_THREAD_LOCAL Rwr_Man5_t * s_pManRwrExp5 = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -0,0 +1,463 @@
+/**CFile****************************************************************
+
+  FileName    [sfmPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based optimization using internal don't-cares.]
+
+  Synopsis    [Resubstitution in non-overlapping windows using several threads.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: sfmPar.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "sfmInt.h"
+#include "misc/util/utilPool.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The nodes are processed in batches. For each node of the batch, the window
+// is computed, and two sets are recorded: the footprint (the internal nodes
+// of the window, which include the complete TFI of the roots) and the nodes
+// that may be changed by resynthesis (the pivot, its TFO in the window, and
+// its MFFC). A node is selected if none of its changed nodes belongs to the
+// footprints of the nodes selected before it in the batch, and its footprint
+// does not contain their changed nodes; the other nodes are postponed till
+// the next batch. The selected nodes are resynthesized by the threads, each
+// working with its own copy of the window data and the SAT solver, while the
+// network is not changed. Finally, the changes are performed in the order of
+// the nodes. The result of resynthesis depends only on the nodes of the
+// footprint, which are not changed by the other selected nodes, so all the
+// changes remain valid when performed together. The batches depend only on
+// the network, so the result does not depend on the number of threads.
+
+#define SFM_PAR_BATCH_MIN   64  // the smallest batch
+#define SFM_PAR_BATCH_MAX 4096  // the largest batch
+
+typedef struct Sfm_Par_Thr_t_ Sfm_Par_Thr_t;
+struct Sfm_Par_Thr_t_
+{
+    Sfm_Ntk_t *       p;           // the thread's copy of the manager
+    int               iThread;     // the thread number
+    int               nThreads;    // the number of threads
+    int               fResub;      // performs resubstitution (rather than computing windows)
+    Vec_Int_t *       vBatch;      // the nodes of the batch
+    Vec_Int_t *       vStatus;     // the status of each node of the batch
+    Vec_Wec_t *       vWins;       // the footprints of the windows
+    Vec_Wec_t *       vChanges;    // the nodes changed in the windows
+    Vec_Int_t *       vFanins;     // the fanins to be replaced
+    Vec_Int_t *       vFaninsNew;  // the new fanins
+    Vec_Wrd_t *       vTruths;     // the new functions
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the copy of the manager used by one thread.]
+
+  Description [The copy shares the network and keeps the traversal IDs,
+  the SAT variable maps, the window and the SAT solver of its own.
+  The statistics of the copy are added to the manager when it is stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sfm_Ntk_t * Sfm_NtkWorkerStart( Sfm_Ntk_t * p )
+{
+    Sfm_Ntk_t * pNew = ABC_CALLOC( Sfm_Ntk_t, 1 );
+    // the parameters are modified when the window is computed
+    pNew->pPars     = ABC_ALLOC( Sfm_Par_t, 1 );
+    memcpy( pNew->pPars, p->pPars, sizeof(Sfm_Par_t) );
+    pNew->pPars->fVeryVerbose = 0;
+    // the network is shared
+    pNew->nPis      = p->nPis;
+    pNew->nPos      = p->nPos;
+    pNew->nNodes    = p->nNodes;
+    pNew->nObjs     = p->nObjs;
+    pNew->vFixed    = p->vFixed;
+    pNew->vEmpty    = p->vEmpty;
+    pNew->vTruths   = p->vTruths;
+    pNew->vFanins   = p->vFanins;
+    pNew->vFanouts  = p->vFanouts;
+    pNew->vLevels   = p->vLevels;
+    pNew->vLevelsR  = p->vLevelsR;
+    pNew->vCnfs     = p->vCnfs;
+    // the rest is private
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    Sfm_NtkPrepare( pNew );
+    pNew->nLevelMax = p->nLevelMax;
+    pNew->fDelayUpdate = 1;
+    return pNew;
+}
+void Sfm_NtkWorkerStop( Sfm_Ntk_t * p, Sfm_Ntk_t * pNew )
+{
+    p->nTryRemoves += pNew->nTryRemoves;
+    p->nTryResubs  += pNew->nTryResubs;
+    p->nRemoves    += pNew->nRemoves;
+    p->nResubs     += pNew->nResubs;
+    p->nNodesTried += pNew->nNodesTried;
+    p->nTotalDivs  += pNew->nTotalDivs;
+    p->nSatCalls   += pNew->nSatCalls;
+    p->nTimeOuts   += pNew->nTimeOuts;
+    p->nMaxDivs    += pNew->nMaxDivs;
+    p->timeWin     += pNew->timeWin;
+    p->timeDiv     += pNew->timeDiv;
+    p->timeCnf     += pNew->timeCnf;
+    p->timeSat     += pNew->timeSat;
+    ABC_FREE( pNew->vCounts.pArray );
+    ABC_FREE( pNew->vTravIds.pArray );
+    ABC_FREE( pNew->vTravIds2.pArray );
+    ABC_FREE( pNew->vId2Var.pArray );
+    ABC_FREE( pNew->vVar2Id.pArray );
+    Vec_IntFree( pNew->vNodes );
+    Vec_IntFree( pNew->vDivs );
+    Vec_IntFree( pNew->vRoots );
+    Vec_IntFree( pNew->vTfo );
+    Vec_WrdFree( pNew->vDivCexes );
+    Vec_IntFree( pNew->vOrder );
+    Vec_IntFree( pNew->vDivVars );
+    Vec_IntFree( pNew->vDivIds );
+    Vec_IntFree( pNew->vLits );
+    Vec_IntFree( pNew->vValues );
+    Vec_WecFree( pNew->vClauses );
+    Vec_IntFree( pNew->vFaninMap );
+    sat_solver_delete( pNew->pSat );
+    ABC_FREE( pNew->pPars );
+    ABC_FREE( pNew );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the share of the batch assigned to the thread.]
+
+  Description [When computing windows, records the footprint of each window
+  (the internal nodes it contains) or marks the node as failed. Otherwise,
+  performs resubstitution of the selected nodes and records the changes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkWorkerTask( void * pArg )
+{
+    Sfm_Par_Thr_t * pThr = (Sfm_Par_Thr_t *)pArg;
+    Sfm_Ntk_t * p = pThr->p;
+    Vec_Int_t * vWin;
+    int i, k, iNode, iObj, nMaxDivs, nTotalDivs;
+    abctime clk = Abc_Clock();
+    Vec_IntForEachEntry( pThr->vBatch, iNode, i )
+    {
+        if ( i % pThr->nThreads != pThr->iThread )
+            continue;
+        if ( pThr->fResub )
+        {
+            if ( Vec_IntEntry(pThr->vStatus, i) != 2 )
+                continue;
+            if ( !Sfm_NodeResub(p, iNode) )
+                continue;
+            Vec_IntWriteEntry( pThr->vStatus, i, 3 );
+            Vec_IntWriteEntry( pThr->vFanins, i, p->iUpdFanin );
+            Vec_IntWriteEntry( pThr->vFaninsNew, i, p->iUpdFaninNew );
+            Vec_WrdWriteEntry( pThr->vTruths, i, p->uUpdTruth );
+            continue;
+        }
+        // the window is computed again before resubstitution, so it is not counted here
+        nMaxDivs   = p->nMaxDivs;
+        nTotalDivs = p->nTotalDivs;
+        vWin = Vec_WecEntry( pThr->vWins, i );
+        Vec_IntClear( vWin );
+        if ( Sfm_NtkCreateWindow(p, iNode, 0) )
+        {
+            Vec_IntForEachEntry( p->vOrder, iObj, k )
+                if ( !Sfm_ObjIsPi(p, iObj) )
+                    Vec_IntPush( vWin, iObj );
+            Sfm_NtkCollectChanged( p, Vec_WecEntry(pThr->vChanges, i) );
+            Vec_IntWriteEntry( pThr->vStatus, i, 1 );
+        }
+        else
+        {
+            p->nNodesTried++;
+            Vec_IntWriteEntry( pThr->vStatus, i, 0 );
+        }
+        p->nMaxDivs   = nMaxDivs;
+        p->nTotalDivs = nTotalDivs;
+    }
+    p->timeTotal += Abc_Clock() - clk;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one pass over the batch using the threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkRunWorkers( Util_Pool_t * pPool, Sfm_Par_Thr_t * pThrs, int nThreads, int fResub )
+{
+    Util_Task_t ** ppTasks = ABC_CALLOC( Util_Task_t *, nThreads );
+    int i;
+    for ( i = 0; i < nThreads; i++ )
+        pThrs[i].fResub = fResub;
+    // the calling thread processes the first share
+    for ( i = 1; i < nThreads; i++ )
+        ppTasks[i] = Util_PoolSubmit( pPool, Sfm_NtkWorkerTask, (void *)(pThrs + i) );
+    Sfm_NtkWorkerTask( pThrs );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        Util_TaskWait( ppTasks[i] );
+        Util_TaskFree( ppTasks[i] );
+    }
+    ABC_FREE( ppTasks );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node should be tried.]
+
+  Description [Uses the same criteria as the sequential procedure.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NtkNodeIsCand( Sfm_Ntk_t * p, int iNode )
+{
+    if ( Sfm_ObjIsFixed( p, iNode ) )
+        return 0;
+    if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, iNode) > p->pPars->nDepthMax )
+        return 0;
+    if ( Sfm_ObjFaninNum(p, iNode) < 2 || Sfm_ObjFaninNum(p, iNode) > 6 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if one of the objects has the mark.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NtkHasMarks( Vec_Int_t * vObjs, Vec_Int_t * vMarks, int Mark )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( vObjs, iObj, i )
+        if ( Vec_IntEntry(vMarks, iObj) == Mark )
+            return 1;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the new fanin keeps the node within the level limit.]
+
+  Description [The divisors are selected using the levels before the changes
+  of the batch, which may increase the levels of the new fanin or of the 
+  fanouts of the node, so the limit used when adding the divisors is checked 
+  again using the current levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NtkCheckLevel( Sfm_Ntk_t * p, int iNode, int iFaninNew )
+{
+    if ( iFaninNew == -1 )
+        return 1;
+    return Sfm_ObjLevel(p, iFaninNew) + Sfm_ObjLevelR(p, iNode) <= p->nLevelMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution in non-overlapping windows.]
+
+  Description [Returns the number of nodes changed. Each node is tried
+  until it cannot be improved, as in the sequential procedure.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p )
+{
+    Util_Pool_t * pPool = Util_PoolGlobal( p->pPars->nProcs - 1 );
+    Sfm_Par_Thr_t * pThrs = ABC_CALLOC( Sfm_Par_Thr_t, p->pPars->nProcs );
+    Vec_Int_t * vBatch     = Vec_IntAlloc( SFM_PAR_BATCH_MAX );
+    Vec_Int_t * vNext      = Vec_IntAlloc( SFM_PAR_BATCH_MAX );
+    Vec_Int_t * vStatus    = Vec_IntAlloc( SFM_PAR_BATCH_MAX );
+    Vec_Int_t * vFanins    = Vec_IntAlloc( SFM_PAR_BATCH_MAX );
+    Vec_Int_t * vFaninsNew = Vec_IntAlloc( SFM_PAR_BATCH_MAX );
+    Vec_Wrd_t * vTruths    = Vec_WrdAlloc( SFM_PAR_BATCH_MAX );
+    Vec_Wec_t * vWins      = Vec_WecStart( SFM_PAR_BATCH_MAX );
+    Vec_Wec_t * vChanges   = Vec_WecStart( SFM_PAR_BATCH_MAX );
+    Vec_Int_t * vMarksWin  = Vec_IntStart( p->nObjs );
+    Vec_Int_t * vMarksChg  = Vec_IntStart( p->nObjs );
+    Vec_Str_t * vChanged   = Vec_StrStart( p->nObjs );
+    Vec_Int_t * vWin, * vChg;
+    int i, k, iNode, iObj, f, nSelected, nBatches = 0, nRejected = 0, Counter = 0, fStop = 0;
+    int nBatchSize = SFM_PAR_BATCH_MIN, nThreads = p->pPars->nProcs;
+    int nSegs = SFM_PAR_BATCH_MIN, nSegsLeft = 0, iSeg = 0;
+    int * pNext = ABC_ALLOC( int, 2 * nSegs ); // the next new node and the limit of each segment
+    // the nodes are divided into segments, which are sampled in turn,
+    // because the windows of the consecutive nodes tend to overlap
+    for ( i = 0; i < nSegs; i++ )
+    {
+        pNext[i]         = p->nPis + (int)((word)i * (p->nObjs - p->nPis - p->nPos) / nSegs);
+        pNext[nSegs + i] = p->nPis + (int)((word)(i + 1) * (p->nObjs - p->nPis - p->nPos) / nSegs);
+        nSegsLeft += (pNext[i] < pNext[nSegs + i]);
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pThrs[i].p          = Sfm_NtkWorkerStart( p );
+        pThrs[i].iThread    = i;
+        pThrs[i].nThreads   = nThreads;
+        pThrs[i].vBatch     = vBatch;
+        pThrs[i].vStatus    = vStatus;
+        pThrs[i].vWins      = vWins;
+        pThrs[i].vChanges   = vChanges;
+        pThrs[i].vFanins    = vFanins;
+        pThrs[i].vFaninsNew = vFaninsNew;
+        pThrs[i].vTruths    = vTruths;
+    }
+    while ( !fStop )
+    {
+        // collect the postponed nodes followed by the new ones
+        Vec_IntClear( vBatch );
+        Vec_IntForEachEntry( vNext, iNode, i )
+            if ( Sfm_NtkNodeIsCand(p, iNode) )
+                Vec_IntPush( vBatch, iNode );
+        Vec_IntClear( vNext );
+        for ( ; Vec_IntSize(vBatch) < nBatchSize && nSegsLeft > 0; iSeg = (iSeg + 1) % nSegs )
+        {
+            if ( pNext[iSeg] == pNext[nSegs + iSeg] )
+                continue;
+            while ( pNext[iSeg] < pNext[nSegs + iSeg] && !Sfm_NtkNodeIsCand(p, pNext[iSeg]) )
+                pNext[iSeg]++;
+            if ( pNext[iSeg] < pNext[nSegs + iSeg] )
+                Vec_IntPush( vBatch, pNext[iSeg]++ );
+            if ( pNext[iSeg] == pNext[nSegs + iSeg] )
+                nSegsLeft--;
+        }
+        if ( Vec_IntSize(vBatch) == 0 )
+            break;
+        Vec_IntFill( vStatus, Vec_IntSize(vBatch), 0 );
+        Vec_IntFill( vFanins, Vec_IntSize(vBatch), -1 );
+        Vec_IntFill( vFaninsNew, Vec_IntSize(vBatch), -1 );
+        Vec_WrdFill( vTruths, Vec_IntSize(vBatch), 0 );
+        // compute the windows
+        Sfm_NtkRunWorkers( pPool, pThrs, nThreads, 0 );
+        // select the windows that do not overlap the preceding ones
+        nBatches++;
+        nSelected = 0;
+        Vec_IntForEachEntry( vBatch, iNode, i )
+        {
+            if ( Vec_IntEntry(vStatus, i) == 0 )
+                continue;
+            vWin = Vec_WecEntry( vWins, i );
+            vChg = Vec_WecEntry( vChanges, i );
+            if ( Sfm_NtkHasMarks(vWin, vMarksChg, nBatches) || Sfm_NtkHasMarks(vChg, vMarksWin, nBatches) )
+            {
+                Vec_IntPush( vNext, iNode );
+                continue;
+            }
+            Vec_IntForEachEntry( vWin, iObj, k )
+                Vec_IntWriteEntry( vMarksWin, iObj, nBatches );
+            Vec_IntForEachEntry( vChg, iObj, k )
+                Vec_IntWriteEntry( vMarksChg, iObj, nBatches );
+            Vec_IntWriteEntry( vStatus, i, 2 );
+            nSelected++;
+        }
+        // perform resubstitution in the selected windows
+        Sfm_NtkRunWorkers( pPool, pThrs, nThreads, 1 );
+        // update the network in the order of the nodes
+        Vec_IntForEachEntry( vBatch, iNode, i )
+        {
+            if ( Vec_IntEntry(vStatus, i) != 3 )
+                continue;
+            // the node is tried again if the preceding changes made it too deep
+            if ( !Sfm_NtkCheckLevel(p, iNode, Vec_IntEntry(vFaninsNew, i)) )
+            {
+                Vec_IntPush( vNext, iNode );
+                nRejected++;
+                continue;
+            }
+            f = Vec_IntFind( Sfm_ObjFiArray(p, iNode), Vec_IntEntry(vFanins, i) );
+            assert( f >= 0 );
+            Sfm_NtkUpdate( p, iNode, f, Vec_IntEntry(vFaninsNew, i), Vec_WrdEntry(vTruths, i) );
+            // the node is tried again in the next batch
+            Vec_IntPush( vNext, iNode );
+            if ( Vec_StrEntry(vChanged, iNode) )
+                continue;
+            Vec_StrWriteEntry( vChanged, iNode, 1 );
+            if ( p->pPars->nNodesMax && ++Counter >= p->pPars->nNodesMax )
+            {
+                fStop = 1;
+                break;
+            }
+        }
+        // grow the batch if most windows did not overlap
+        nBatchSize = Abc_MinInt( SFM_PAR_BATCH_MAX, Abc_MaxInt( SFM_PAR_BATCH_MIN, 2 * nSelected ) );
+    }
+    if ( !p->pPars->nNodesMax )
+        Counter = Vec_StrSum( vChanged );
+    if ( p->pPars->fVerbose )
+        printf( "Processed %d batches of windows using %d threads. Rejected %d changes exceeding the level limit.\n", nBatches, nThreads, nRejected );
+    // the CPU time of the other threads is added to the total runtime
+    for ( i = 1; i < nThreads; i++ )
+        p->timeTotal -= pThrs[i].p->timeTotal;
+    for ( i = 0; i < nThreads; i++ )
+        Sfm_NtkWorkerStop( p, pThrs[i].p );
+    ABC_FREE( pThrs );
+    ABC_FREE( pNext );
+    Vec_IntFree( vBatch );
+    Vec_IntFree( vNext );
+    Vec_IntFree( vStatus );
+    Vec_IntFree( vFanins );
+    Vec_IntFree( vFaninsNew );
+    Vec_WrdFree( vTruths );
+    Vec_WecFree( vWins );
+    Vec_WecFree( vChanges );
+    Vec_IntFree( vMarksWin );
+    Vec_IntFree( vMarksChg );
+    Vec_StrFree( vChanged );
+    return Counter;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
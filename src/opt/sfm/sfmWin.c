@@ -465,6 +465,44 @@ int Sfm_NtkCreateWindow( Sfm_Ntk_t * p, int iNode, int fVerbose )
     printf( "\n" );
     return 1;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the nodes changed by resynthesis in the window.]
+
+  Description [Resynthesis of the pivot changes the fanins of the pivot,
+  may change the functions of its TFO up to the roots, and may remove
+  the nodes of its MFFC. The window should be computed already.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkCollectChanged( Sfm_Ntk_t * p, Vec_Int_t * vChanged )
+{
+    int i, k, iNode, iFanout;
+    Vec_IntClear( vChanged );
+    Vec_IntPush( vChanged, p->iPivotNode );
+    Vec_IntAppend( vChanged, p->vTfo );
+    // the TFI is in a topological order ending with the pivot
+    assert( Vec_IntEntryLast(p->vNodes) == p->iPivotNode );
+    Sfm_NtkIncrementTravId2( p );
+    Sfm_ObjSetTravIdCurrent2( p, p->iPivotNode );
+    for ( i = Vec_IntSize(p->vNodes) - 2; i >= 0; i-- )
+    {
+        iNode = Vec_IntEntry( p->vNodes, i );
+        if ( Sfm_ObjIsPi(p, iNode) || Sfm_ObjIsFixed(p, iNode) || Sfm_ObjFanoutNum(p, iNode) == 0 )
+            continue;
+        Sfm_ObjForEachFanout( p, iNode, iFanout, k )
+            if ( !Sfm_ObjIsTravIdCurrent2(p, iFanout) )
+                break;
+        if ( k < Sfm_ObjFanoutNum(p, iNode) )
+            continue;
+        Sfm_ObjSetTravIdCurrent2( p, iNode );
+        Vec_IntPush( vChanged, iNode );
+    }
+}
 void Sfm_NtkWindowTest( Sfm_Ntk_t * p, int iNode )
 {
     int i;
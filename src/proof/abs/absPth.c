@@ -21,6 +21,7 @@
 #include "abs.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "base/main/main.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -52,6 +53,7 @@ int  Gia_GlaProveCheck( int fVerbose )                                     { ret
 typedef struct Abs_ThData_t_
 {
     Aig_Man_t * pAig;
+    Abc_Frame_t * pFrame;  // the frame of the thread starting the prover
     int         fVerbose;
     int         RunId;
 } Abs_ThData_t;
@@ -97,6 +99,8 @@ void * Abs_ProverThread( void * pArg )
     Abs_ThData_t * pThData = (Abs_ThData_t *)pArg;
     Pdr_Par_t Pars, * pPars = &Pars;
     int RetValue, status;
+    // the frame is per-thread; PDR records the invariant in the caller's frame
+    Abc_FrameSetGlobalFrame( pThData->pFrame );
     // call PDR
     Pdr_ManSetDefaultParams( pPars );
     pPars->fSilent   = 1;
@@ -167,6 +171,7 @@ void Gia_GlaProveAbsracted( Gia_Man_t * pGia, int fSimpProver, int fVerbose )
     // collect thread data
     pThData = ABC_CALLOC( Abs_ThData_t, 1 );
     pThData->pAig = pAig;
+    pThData->pFrame = Abc_FrameReadGlobalFrame();
     pThData->fVerbose = fVerbose;
     status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
     pThData->RunId = ++g_nRunIds;
@@ -160,8 +160,8 @@ unsigned s_Classes4c[768] = {
 ***********************************************************************/
 unsigned Extra_TruthCanonNPN2( unsigned uTruth, int nVars, Vec_Int_t * vRes )
 {
-    static int nVarsOld, nPerms;
-    static char ** pPerms = NULL;
+    static ABC_THREAD_LOCAL int nVarsOld, nPerms;
+    static ABC_THREAD_LOCAL char ** pPerms = NULL;
 
     unsigned uTruthMin, uTruthC, uPhase, uPerm;
     int nMints, k, i;
@@ -312,6 +312,25 @@ int Cec_ManVerifyNaive( Gia_Man_t * p, Cec_ParCec_t * pPars )
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the runtime limit left after the time spent.]
+
+  Description [Returns 0 if there is no limit. The wall-clock time is 
+  used because the parallel sweeper runs on other threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_ManTimeLeft( int TimeLimit, time_t timeStart )
+{
+    if ( TimeLimit == 0 )
+        return 0;
+    return Abc_MaxInt( 1, TimeLimit - (int)(time(NULL) - timeStart) );
+}
+
 /**Function*************************************************************
 
   Synopsis    [New CEC engine.]
@@ -331,6 +350,7 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     int RetValue;
     abctime clk = Abc_Clock();
     abctime clkTotal = Abc_Clock();
+    time_t timeStart = time(NULL);
     // consider special cases:
     // 1) (SAT) a pair of POs have different value under all-0 pattern
     // 2) (SAT) a pair of POs has different PI/Const drivers
@@ -351,9 +371,29 @@ int Cec_ManVerify( Gia_Man_t * pInit, Cec_ParCec_t * pPars )
     }
     // sweep for equivalences
     Cec_ManFraSetDefaultParams( pParsFra );
+    if ( pPars->nProcs > 1 )
+    {
+        // merge the equivalences proved by the parallel sweeper before running the main engine
+        extern Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars );
+        pParsFra->nBTLimit     = pPars->nBTLimit;
+        pParsFra->nProcs       = pPars->nProcs;
+        pParsFra->fVerbose     = pPars->fVerbose;
+        pParsFra->TimeLimit    = Cec_ManTimeLeft( pPars->TimeLimit, timeStart );
+        p = Cec3_ManSimulateTest( pNew = p, pParsFra );
+        Gia_ManStop( pNew );
+        if ( pPars->TimeLimit && time(NULL) - timeStart >= pPars->TimeLimit )
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Timeout (%d sec) is reached.\n", pPars->TimeLimit );
+            Gia_ManStop( p );
+            return -1;
+        }
+    }
+    // let the sweeper reuse the patterns of the user's AIG
+    Gia_ManPoolShare( p, pInit );
     pParsFra->nItersMax    = 1000;
     pParsFra->nBTLimit     = pPars->nBTLimit;
-    pParsFra->TimeLimit    = pPars->TimeLimit;
+    pParsFra->TimeLimit    = Cec_ManTimeLeft( pPars->TimeLimit, timeStart );
     pParsFra->fVerbose     = pPars->fVerbose;
     pParsFra->fCheckMiter  = 1;
     pParsFra->fDualOut     = 1;
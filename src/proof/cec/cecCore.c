@@ -132,6 +132,7 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->nBTLimit       =     100;  // conflict limit at a node
     p->nLevelMax      =       0;  // restriction on the level of nodes to be swept
     p->nDepthMax      =       1;  // the depth in terms of steps of speculative reduction
+    p->nProcs         =       1;  // the number of threads used for SAT sweeping
     p->fRewriting     =       0;  // enables AIG rewriting
     p->fCheckMiter    =       0;  // the circuit is the miter
 //    p->fFirstStop     =       0;  // stop on the first sat output
@@ -160,6 +161,7 @@ void Cec_ManCecSetDefaultParams( Cec_ParCec_t * p )
     memset( p, 0, sizeof(Cec_ParCec_t) );
     p->nBTLimit       =    1000;  // conflict limit at a node
     p->TimeLimit      =       0;  // the runtime limit in seconds
+    p->nProcs         =       1;  // the number of threads used for SAT sweeping
 //    p->fFirstStop     =       0;  // stop on the first sat output
     p->fUseSmartCnf   =       0;  // use smart CNF computation
     p->fRewriting     =       0;  // enables AIG rewriting
@@ -391,6 +393,16 @@ clk = Abc_Clock();
             goto finalize;
         }
     }
+    // refine classes using the patterns found earlier
+    if ( pAig->pPool && Gia_PoolCiNum(pAig->pPool) == Gia_ManCiNum(p->pAig) )
+    {
+        if ( Cec_ManFraClassesPool( p, pSim, pAig->pPool ) )
+        {
+            Gia_ManStop( p->pAig );
+            p->pAig = NULL;
+            goto finalize;
+        }
+    }
 p->timeSim += Abc_Clock() - clk;
     // perform solving
     for ( i = 1; i <= pPars->nItersMax; i++ )
@@ -438,6 +450,9 @@ clk = Abc_Clock();
         else
             Cec_ManSatSolve( pPat, pSrm, pParsSat, p->pAig->vIdsOrig, p->vXorNodes, pAig->vIdsEquiv ); 
 p->timeSat += Abc_Clock() - clk;
+        // share the patterns with the other engines
+        if ( Gia_ManCiNum(pAig) == Gia_ManCiNum(pSrm) )
+            Cec_ManPatSavePool( pPat, Gia_ManPool(pAig) );
         if ( Cec_ManFraClassesUpdate( p, pSim, pPat, pSrm ) )
         {
             Gia_ManStop( pSrm );
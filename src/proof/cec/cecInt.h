@@ -192,6 +192,7 @@ extern void                 Cec_ManFraStop( Cec_ManFra_t * p );
 extern void                 Cec_ManPatSavePattern( Cec_ManPat_t *  pPat, Cec_ManSat_t *  p, Gia_Obj_t * pObj );
 extern void                 Cec_ManPatSavePatternCSat( Cec_ManPat_t * pMan, Vec_Int_t * vPat );
 extern Vec_Ptr_t *          Cec_ManPatCollectPatterns( Cec_ManPat_t *  pMan, int nInputs, int nWords );
+extern int                  Cec_ManPatSavePool( Cec_ManPat_t * pMan, Gia_Pool_t * pPool );
 extern Vec_Ptr_t *          Cec_ManPatPackPatterns( Vec_Int_t * vCexStore, int nInputs, int nRegs, int nWordsInit );
 /*=== cecSeq.c ============================================================*/
 extern int                  Cec_ManSeqResimulate( Cec_ManSim_t * p, Vec_Ptr_t * vInfo );
@@ -212,6 +213,7 @@ extern Vec_Int_t *          Cec_ManSatReadCex( Cec_ManSat_t * p );
 /*=== ceFraeep.c ============================================================*/
 extern Gia_Man_t *          Cec_ManFraSpecReduction( Cec_ManFra_t * p );
 extern int                  Cec_ManFraClassesUpdate( Cec_ManFra_t * p, Cec_ManSim_t * pSim, Cec_ManPat_t * pPat, Gia_Man_t * pNew );
+extern int                  Cec_ManFraClassesPool( Cec_ManFra_t * p, Cec_ManSim_t * pSim, Gia_Pool_t * pPool );
 
 
 
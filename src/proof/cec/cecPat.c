@@ -498,6 +498,31 @@ Vec_Ptr_t * Cec_ManPatCollectPatterns( Cec_ManPat_t *  pMan, int nInputs, int nW
     return vInfo;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the recent patterns to the shared pool.]
+
+  Description [Returns the number of patterns not yet in the pool.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManPatSavePool( Cec_ManPat_t * pMan, Gia_Pool_t * pPool )
+{
+    Vec_Int_t * vPat = pMan->vPattern1;
+    int iStartOld = pMan->iStart;
+    int nAdded = 0;
+    while ( pMan->iStart < Vec_StrSize(pMan->vStorage) )
+    {
+        Cec_ManPatRestore( pMan, vPat );
+        nAdded += Gia_PoolAddLits( pPool, Vec_IntArray(vPat), Vec_IntSize(vPat) );
+    }
+    pMan->iStart = iStartOld;
+    return nAdded;
+}
+
 
 /**Function*************************************************************
 
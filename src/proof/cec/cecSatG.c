@@ -20,9 +20,22 @@
 
 #include "aig/gia/gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
+#include "misc/util/utilPool.h"
 #include "sat/glucose/AbcGlucose.h"
 #include "cec.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -37,6 +50,8 @@ struct Cec3_Par_t_
     int              nSimRounds;    // simulation rounds
     int              nItersMax;     // max number of iterations
     int              nConfLimit;    // SAT solver conflict limit
+    int              nProcs;        // the number of threads
+    int              nTimeLimit;    // the runtime limit in seconds
     int              fIsMiter;      // this is a miter
     int              fUseCones;     // use logic cones
     int              fVeryVerbose;  // verbose stats
@@ -59,6 +74,8 @@ struct Cec3_Man_t_
     Vec_Int_t *      vSatVars;       // nodes
     Vec_Int_t *      vObjSatPairs;   // nodes
     Vec_Int_t *      vCexTriples;    // nodes
+    Vec_Ptr_t *      vWorkers;       // SAT managers of the worker threads
+    time_t           nTimeToStop;    // wall-clock runtime limit (0 if there is no limit)
     // statistics
     int              nPatterns;
     int              nSatSat;
@@ -67,12 +84,38 @@ struct Cec3_Man_t_
     abctime          timeSatSat;
     abctime          timeSatUnsat;
     abctime          timeSatUndec;
+    abctime          timeSatPar;
     abctime          timeSim;
     abctime          timeRefine;
     abctime          timeExtra;
     abctime          timeStart;
 };
 
+// status of the candidates left unsolved because of the timeout
+#define CEC3_UNSOLVED 2
+
+// batch of candidate pairs solved by the worker threads
+typedef struct Cec3_Bat_t_ Cec3_Bat_t;
+struct Cec3_Bat_t_
+{
+    Vec_Int_t *      vCands;         // candidate nodes of the user's AIG
+    Vec_Int_t *      vLits;          // their literals in the internal AIG
+    Vec_Int_t *      vStatus;        // SAT solver status of each candidate
+    Vec_Wec_t *      vModels;        // (CI ID, value) pairs of the satisfiable candidates
+    int              iNext;          // the next candidate to be solved
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;          // protects iNext
+#endif
+};
+
+// data of one worker thread
+typedef struct Cec3_Thr_t_ Cec3_Thr_t;
+struct Cec3_Thr_t_
+{
+    Cec3_Man_t *     pMan;           // SAT manager of this thread
+    Cec3_Bat_t *     pBat;           // the current batch
+};
+
 static inline int    Cec3_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )             { return Gia_ObjCopyArray(p, Gia_ObjId(p, pObj));                                                     }
 static inline int    Cec3_ObjSetSatId( Gia_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec3_ObjSatId(p, pObj) == -1); Gia_ObjSetCopyArray(p, Gia_ObjId(p, pObj), Num); return Num;  }
 static inline void   Cec3_ObjCleanSatId( Gia_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec3_ObjSatId(p, pObj) != -1); Gia_ObjSetCopyArray(p, Gia_ObjId(p, pObj), -1);               }
@@ -102,6 +145,8 @@ void Cec3_SetDefaultParams( Cec3_Par_t * p )
     p->nSimRounds     =       4;    // simulation rounds
     p->nItersMax      =      10;    // max number of iterations
     p->nConfLimit     =    1000;    // conflict limit at a node
+    p->nProcs         =       1;    // the number of threads
+    p->nTimeLimit     =       0;    // the runtime limit in seconds
     p->fIsMiter       =       0;    // this is a miter
     p->fUseCones      =       0;    // use logic cones
     p->fVeryVerbose   =       0;    // verbose stats
@@ -384,8 +429,11 @@ static inline void Cec3_ObjSimRo( Gia_Man_t * p, int iObj )
     int w;
     word * pSimRo = Cec3_ObjSim( p, iObj );
     word * pSimRi = Cec3_ObjSim( p, Gia_ObjRoToRiId(p, iObj) );
-    for ( w = 0; w < p->nSimWords; w++ )
-        pSimRo[w] = pSimRi[w];
+    if ( p->nSimWords >= ABC_SIMD_WORDS_MIN )
+        Abc_SimdDup( pSimRo, pSimRi, p->nSimWords, 0 );
+    else
+        for ( w = 0; w < p->nSimWords; w++ )
+            pSimRo[w] = pSimRi[w];
 }
 static inline void Cec3_ObjSimCo( Gia_Man_t * p, int iObj )
 {
@@ -393,7 +441,9 @@ static inline void Cec3_ObjSimCo( Gia_Man_t * p, int iObj )
     Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
     word * pSimCo  = Cec3_ObjSim( p, iObj );
     word * pSimDri = Cec3_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) )
+    if ( p->nSimWords >= ABC_SIMD_WORDS_MIN )
+        Abc_SimdDup( pSimCo, pSimDri, p->nSimWords, Gia_ObjFaninC0(pObj) );
+    else if ( Gia_ObjFaninC0(pObj) )
         for ( w = 0; w < p->nSimWords; w++ )
             pSimCo[w] = ~pSimDri[w];
     else
@@ -407,7 +457,9 @@ static inline void Cec3_ObjSimAnd( Gia_Man_t * p, int iObj )
     word * pSim  = Cec3_ObjSim( p, iObj );
     word * pSim0 = Cec3_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec3_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
+    if ( p->nSimWords >= ABC_SIMD_WORDS_MIN )
+        Abc_SimdAnd( pSim, pSim0, pSim1, p->nSimWords, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj) );
+    else if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
         for ( w = 0; w < p->nSimWords; w++ )
             pSim[w] = ~pSim0[w] & ~pSim1[w];
     else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
@@ -425,6 +477,8 @@ static inline int Cec3_ObjSimEqual( Gia_Man_t * p, int iObj0, int iObj1 )
     int w;
     word * pSim0 = Cec3_ObjSim( p, iObj0 );
     word * pSim1 = Cec3_ObjSim( p, iObj1 );
+    if ( p->nSimWords >= ABC_SIMD_WORDS_MIN )
+        return Abc_SimdEqual( pSim0, pSim1, p->nSimWords, (pSim0[0] & 1) != (pSim1[0] & 1) );
     if ( (pSim0[0] & 1) == (pSim1[0] & 1) )
     {
         for ( w = 0; w < p->nSimWords; w++ )
@@ -658,6 +712,51 @@ void Cec3_ManCreateClasses( Gia_Man_t * p, Cec3_Man_t * pMan )
   SeeAlso     []
 
 ***********************************************************************/
+Cec3_Man_t * Cec3_ManCreateWorker( Cec3_Man_t * pBoss )
+{
+    Cec3_Man_t * p  = ABC_CALLOC( Cec3_Man_t, 1 );
+    p->pPars        = pBoss->pPars;
+    p->pAig         = pBoss->pAig;
+    p->nTimeToStop  = pBoss->nTimeToStop;
+    // private header of the internal AIG, which keeps the SAT variables 
+    // and the traversal IDs of this thread (see Cec3_ManSyncWorker)
+    p->pNew         = ABC_CALLOC( Gia_Man_t, 1 );
+    p->pSat         = bmcg_sat_solver_start();
+    p->vFrontier    = Vec_PtrAlloc( 1000 );
+    p->vFanins      = Vec_PtrAlloc( 100 );
+    p->vNodesNew    = Vec_IntAlloc( 100 );
+    p->vSatVars     = Vec_IntAlloc( 100 );
+    p->vObjSatPairs = Vec_IntAlloc( 100 );
+    return p;
+}
+void Cec3_ManSyncWorker( Cec3_Man_t * p, Gia_Man_t * pNew )
+{
+    // the objects of the internal AIG are shared (they do not change while the workers run)
+    Gia_Man_t * pPriv   = p->pNew;
+    Vec_Int_t vCopies   = pPriv->vCopies;
+    int * pTravIds      = pPriv->pTravIds;
+    int nTravIds        = pPriv->nTravIds;
+    int nTravIdsAlloc   = pPriv->nTravIdsAlloc;
+    *pPriv = *pNew;
+    pPriv->vCopies       = vCopies;
+    pPriv->pTravIds      = pTravIds;
+    pPriv->nTravIds      = nTravIds;
+    pPriv->nTravIdsAlloc = nTravIdsAlloc;
+    Vec_IntFillExtra( &pPriv->vCopies, Gia_ManObjNum(pNew), -1 );
+}
+void Cec3_ManDestroyWorker( Cec3_Man_t * p )
+{
+    Vec_IntErase( &p->pNew->vCopies );
+    ABC_FREE( p->pNew->pTravIds );
+    ABC_FREE( p->pNew );
+    bmcg_sat_solver_stop( p->pSat );
+    Vec_PtrFreeP( &p->vFrontier );
+    Vec_PtrFreeP( &p->vFanins );
+    Vec_IntFreeP( &p->vNodesNew );
+    Vec_IntFreeP( &p->vSatVars );
+    Vec_IntFreeP( &p->vObjSatPairs );
+    ABC_FREE( p );
+}
 Cec3_Man_t * Cec3_ManCreate( Gia_Man_t * pAig, Cec3_Par_t * pPars )
 {
     Cec3_Man_t * p;
@@ -667,6 +766,7 @@ Cec3_Man_t * Cec3_ManCreate( Gia_Man_t * pAig, Cec3_Par_t * pPars )
     p = ABC_CALLOC( Cec3_Man_t, 1 );
     memset( p, 0, sizeof(Cec3_Man_t) );
     p->timeStart    = Abc_Clock();
+    p->nTimeToStop  = pPars->nTimeLimit ? time(NULL) + pPars->nTimeLimit : 0; // the CPU time of the main thread does not include the workers
     p->pPars        = pPars;
     p->pAig         = pAig;
     // create new manager
@@ -686,6 +786,12 @@ Cec3_Man_t * Cec3_ManCreate( Gia_Man_t * pAig, Cec3_Par_t * pPars )
     p->vSatVars     = Vec_IntAlloc( 100 );
     p->vObjSatPairs = Vec_IntAlloc( 100 );
     p->vCexTriples  = Vec_IntAlloc( 100 );
+    if ( pPars->nProcs > 1 )
+    {
+        p->vWorkers = Vec_PtrAlloc( pPars->nProcs );
+        for ( i = 0; i < pPars->nProcs; i++ )
+            Vec_PtrPush( p->vWorkers, Cec3_ManCreateWorker(p) );
+    }
     //Pars.conf_limit = pPars->nConfLimit;
     //satoko_configure(p->pSat, &Pars);
     // remember pointer to the solver in the AIG manager
@@ -697,13 +803,22 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
     if ( p->pPars->fVerbose ) 
     {
         abctime timeTotal = Abc_Clock() - p->timeStart;
-        abctime timeSat   = p->timeSatSat + p->timeSatUnsat + p->timeSatUndec;
+        if ( p->vWorkers ) // CPU time of the worker threads
+        {
+            Cec3_Man_t * pWorker; int i;
+            Vec_PtrForEachEntry( Cec3_Man_t *, p->vWorkers, pWorker, i )
+                p->timeSatPar += pWorker->timeSatPar;
+            timeTotal += p->timeSatPar;
+        }
+        abctime timeSat   = p->timeSatSat + p->timeSatUnsat + p->timeSatUndec + p->timeSatPar;
         abctime timeOther = timeTotal - timeSat - p->timeSim - p->timeRefine - p->timeExtra;
 //        Abc_Print( 1, "%d\n", p->Num );
         ABC_PRTP( "SAT solving", timeSat,          timeTotal );
         ABC_PRTP( "  sat      ", p->timeSatSat,    timeTotal );
         ABC_PRTP( "  unsat    ", p->timeSatUnsat,  timeTotal );
         ABC_PRTP( "  fail     ", p->timeSatUndec,  timeTotal );
+        if ( p->vWorkers )
+        ABC_PRTP( "  parallel ", p->timeSatPar,    timeTotal );
         ABC_PRTP( "Simulation ", p->timeSim,       timeTotal );
         ABC_PRTP( "Refinement ", p->timeRefine,    timeTotal );
         ABC_PRTP( "Rollback   ", p->timeExtra,     timeTotal );
@@ -723,6 +838,13 @@ void Cec3_ManDestroy( Cec3_Man_t * p )
     Vec_IntFreeP( &p->vSatVars );
     Vec_IntFreeP( &p->vObjSatPairs );
     Vec_IntFreeP( &p->vCexTriples );
+    if ( p->vWorkers )
+    {
+        Cec3_Man_t * pWorker; int i;
+        Vec_PtrForEachEntry( Cec3_Man_t *, p->vWorkers, pWorker, i )
+            Cec3_ManDestroyWorker( pWorker );
+        Vec_PtrFree( p->vWorkers );
+    }
     ABC_FREE( p );
 }
 
@@ -858,6 +980,20 @@ int Cec3_ManSolveTwo( Cec3_Man_t * p, int iObj0, int iObj1, int fPhase )
     return status;
 }
 
+int Cec3_ManDupNode( Cec3_Man_t * pMan, Gia_Obj_t * pObj )
+{
+    Gia_Obj_t * pObjNew;
+    int iLit = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    if ( Vec_IntSize(&pMan->pNew->vCopies) == Abc_Lit2Var(iLit) )
+    {
+        pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(iLit) );
+        pObjNew->fMark0 = Gia_ObjIsMuxType( pObjNew );
+        Gia_ObjSetPhase( pMan->pNew, pObjNew );
+        Vec_IntPush( &pMan->pNew->vCopies, -1 );
+    }
+    assert( Vec_IntSize(&pMan->pNew->vCopies) == Gia_ManObjNum(pMan->pNew) );
+    return iLit;
+}
 int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
 {
     abctime clk = Abc_Clock();
@@ -902,6 +1038,224 @@ int Cec3_ManSweepNode( Cec3_Man_t * p, int iObj )
 //    satoko_stats(p->pSat)->n_conflicts = 0;
     return RetValue;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping.]
+
+  Description [Candidate pairs whose fanins are already swept are collected 
+  in one pass over the nodes that are not yet swept and solved by the 
+  worker threads, each of which 
+  uses its own SAT solver and a private copy of the SAT variable map of the 
+  internal AIG. The internal AIG is not modified while the threads run. 
+  The results are applied in the order of candidates, so that the resulting 
+  AIG and the counter-example patterns do not depend on the thread timing 
+  (unless the logic cones are used, in which case the solvers are reused 
+  by the threads).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec3_ManBatchNext( Cec3_Bat_t * pBat )
+{
+    int k;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &pBat->Mutex );
+#endif
+    k = pBat->iNext++;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &pBat->Mutex );
+#endif
+    return k;
+}
+int Cec3_ManTimeOut( Cec3_Man_t * p )
+{
+    return p->nTimeToStop && time(NULL) >= p->nTimeToStop;
+}
+void Cec3_ManSolveCand( Cec3_Man_t * p, Cec3_Bat_t * pBat, int k )
+{
+    abctime clk = Abc_Clock();
+    int iObj = Vec_IntEntry( pBat->vCands, k );
+    int iLit = Vec_IntEntry( pBat->vLits, k );
+    Gia_Obj_t * pObj  = Gia_ManObj( p->pAig, iObj );
+    Gia_Obj_t * pRepr = Gia_ObjReprObj( p->pAig, iObj );
+    int fCompl = Abc_LitIsCompl(iLit) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
+    int i, IdAig, IdSat, status = Cec3_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(iLit), fCompl );
+    Vec_IntWriteEntry( pBat->vStatus, k, status );
+    if ( status == GLUCOSE_SAT )
+    {
+        Vec_Int_t * vModel = Vec_WecEntry( pBat->vModels, k );
+        Vec_IntForEachEntryDouble( p->vObjSatPairs, IdAig, IdSat, i )
+            Vec_IntPushTwo( vModel, IdAig, bmcg_sat_solver_read_cex_varvalue(p->pSat, IdSat) );
+    }
+    if ( !p->pPars->fUseCones )
+        bmcg_sat_solver_reset( p->pSat );
+    p->timeSatPar += Abc_Clock() - clk;
+}
+int Cec3_ManWorkerTask( void * pArg )
+{
+    Cec3_Thr_t * pThData = (Cec3_Thr_t *)pArg;
+    int k;
+    while ( (k = Cec3_ManBatchNext(pThData->pBat)) < Vec_IntSize(pThData->pBat->vCands) )
+    {
+        if ( Cec3_ManTimeOut(pThData->pMan) ) // the remaining candidates stay undecided
+            break;
+        Cec3_ManSolveCand( pThData->pMan, pThData->pBat, k );
+    }
+    return 0;
+}
+void Cec3_ManSolveBatch( Cec3_Man_t * p, Cec3_Bat_t * pBat )
+{
+    Cec3_Thr_t * pThData;
+    Cec3_Man_t * pWorker;
+    int i, nThreads = Abc_MinInt( Vec_PtrSize(p->vWorkers), Vec_IntSize(pBat->vCands) );
+    Vec_IntFill( pBat->vStatus, Vec_IntSize(pBat->vCands), CEC3_UNSOLVED );
+    Vec_WecClear( pBat->vModels );
+    Vec_WecInit( pBat->vModels, Vec_IntSize(pBat->vCands) );
+    pBat->iNext = 0;
+    pThData = ABC_ALLOC( Cec3_Thr_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pWorker = (Cec3_Man_t *)Vec_PtrEntry( p->vWorkers, i );
+        Cec3_ManSyncWorker( pWorker, p->pNew );
+        pThData[i].pMan = pWorker;
+        pThData[i].pBat = pBat;
+    }
+    if ( nThreads > 1 )
+    {
+        // the workers of the global pool are reused across the batches
+        Util_Pool_t * pPool = Util_PoolGlobal( nThreads );
+        Util_Task_t ** ppTasks = ABC_ALLOC( Util_Task_t *, nThreads );
+        for ( i = 0; i < nThreads; i++ )
+            ppTasks[i] = Util_PoolSubmit( pPool, Cec3_ManWorkerTask, (void *)(pThData + i) );
+        for ( i = 0; i < nThreads; i++ )
+        {
+            Util_TaskWait( ppTasks[i] );
+            Util_TaskFree( ppTasks[i] );
+        }
+        ABC_FREE( ppTasks );
+    }
+    else if ( nThreads > 0 )
+        Cec3_ManWorkerTask( (void *)pThData );
+    ABC_FREE( pThData );
+}
+int Cec3_ManSweepPar( Gia_Man_t * p, Cec3_Man_t * pMan )
+{
+    Cec3_Bat_t Bat, * pBat = &Bat;
+    Vec_Bit_t * vDead = Vec_BitStart( Gia_ManObjNum(p) ); // disproved nodes and their fanouts
+    Vec_Int_t * vPend = Vec_IntAlloc( Gia_ManAndNum(p) );  // nodes that are not swept, in topological order
+    Gia_Obj_t * pObj, * pRepr; 
+    int i, k, j, iObj, iLit, status, IdAig, Value, fDisproved = 0;
+    memset( pBat, 0, sizeof(Cec3_Bat_t) );
+    pBat->vCands  = Vec_IntAlloc( 1000 );
+    pBat->vLits   = Vec_IntAlloc( 1000 );
+    pBat->vStatus = Vec_IntAlloc( 1000 );
+    pBat->vModels = Vec_WecAlloc( 1000 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &pBat->Mutex, NULL );
+#endif
+    Gia_ManForEachAnd( p, pObj, i )
+        if ( !~pObj->Value && !Gia_ObjFailed(p, i) )
+            Vec_IntPush( vPend, i );
+    while ( 1 )
+    {
+        // collect the candidates whose fanins and representatives are swept
+        Vec_IntClear( pBat->vCands );
+        Vec_IntClear( pBat->vLits );
+        j = 0;
+        Vec_IntForEachEntry( vPend, i, k )
+        {
+            pObj = Gia_ManObj( p, i );
+            if ( ~pObj->Value || Gia_ObjFailed(p, i) || Vec_BitEntry(vDead, i) ) // drop swept, failed and disproved nodes
+                continue;
+            if ( !~Gia_ObjFanin0(pObj)->Value || !~Gia_ObjFanin1(pObj)->Value ) // skip fanouts of non-swept nodes
+            {
+                if ( Vec_BitEntry(vDead, Gia_ObjFaninId0(pObj, i)) || Vec_BitEntry(vDead, Gia_ObjFaninId1(pObj, i)) )
+                    Vec_BitWriteEntry( vDead, i, 1 );
+                else
+                    Vec_IntWriteEntry( vPend, j++, i );
+                continue;
+            }
+            assert( !Gia_ObjProved(p, i) && !Gia_ObjFailed(p, i) );
+            iLit  = Cec3_ManDupNode( pMan, pObj );
+            pRepr = Gia_ObjReprObj( p, i );
+            if ( pRepr != NULL && !~pRepr->Value && !Vec_BitEntry(vDead, Gia_ObjId(p, pRepr)) ) // wait for the representative
+            {
+                Vec_IntWriteEntry( vPend, j++, i );
+                continue;
+            }
+            pObj->Value = iLit;
+            if ( pRepr == NULL || !~pRepr->Value )
+                continue;
+            if ( Abc_Lit2Var(pObj->Value) == Abc_Lit2Var(pRepr->Value) )
+            {
+                assert( (pObj->Value ^ pRepr->Value) == (pObj->fPhase ^ pRepr->fPhase) );
+                Gia_ObjSetProved( p, i );
+                continue;
+            }
+            // the fanouts of the candidate are not swept until it is solved
+            pObj->Value = ~0;
+            Vec_IntPush( pBat->vCands, i );
+            Vec_IntPush( pBat->vLits, iLit );
+        }
+        Vec_IntShrink( vPend, j );
+        if ( Vec_IntSize(pBat->vCands) == 0 )
+            break;
+        // solve the candidates in parallel
+        Cec3_ManSolveBatch( pMan, pBat );
+        // apply the results
+        Vec_IntForEachEntry( pBat->vCands, iObj, k )
+        {
+            pObj   = Gia_ManObj( p, iObj );
+            pRepr  = Gia_ObjReprObj( p, iObj );
+            status = Vec_IntEntry( pBat->vStatus, k );
+            if ( status == GLUCOSE_SAT )
+            {
+                pMan->nSatSat++;
+                pMan->nPatterns++;
+                p->iPatsPi = (p->iPatsPi == 64 * p->nSimWords - 1) ? 1 : p->iPatsPi + 1;
+                assert( p->iPatsPi > 0 && p->iPatsPi < 64 * p->nSimWords );
+                Vec_IntForEachEntryDouble( Vec_WecEntry(pBat->vModels, k), IdAig, Value, i )
+                    Cec3_ObjSimSetInputBit( p, IdAig, Value );
+                Vec_IntPushThree( pMan->vCexTriples, Gia_ObjId(p, pRepr), iObj, Abc_Var2Lit(p->iPatsPi, pObj->fPhase ^ pRepr->fPhase) );
+                Vec_BitWriteEntry( vDead, iObj, 1 );
+                fDisproved = 1;
+            }
+            else if ( status == GLUCOSE_UNSAT )
+            {
+                pMan->nSatUnsat++;
+                Gia_ObjSetProved( p, iObj );
+                pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            }
+            else if ( status == GLUCOSE_UNDEC )
+            {
+                pMan->nSatUndec++;
+                Gia_ObjSetFailed( p, iObj );
+                pObj->Value = Vec_IntEntry( pBat->vLits, k );
+            }
+            else // leave the node unmerged, as the sequential sweep does after the timeout
+            {
+                assert( status == CEC3_UNSOLVED );
+                pObj->Value = Vec_IntEntry( pBat->vLits, k );
+            }
+        }
+        if ( Cec3_ManTimeOut(pMan) )
+            break;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &pBat->Mutex );
+#endif
+    Vec_IntFree( pBat->vCands );
+    Vec_IntFree( pBat->vLits );
+    Vec_IntFree( pBat->vStatus );
+    Vec_WecFree( pBat->vModels );
+    Vec_IntFree( vPend );
+    Vec_BitFree( vDead );
+    return fDisproved;
+}
+
 void Cec3_ManPrintStats( Gia_Man_t * p, Cec3_Par_t * pPars, Cec3_Man_t * pMan )
 {
     if ( !pPars->fVerbose )
@@ -914,7 +1268,7 @@ void Cec3_ManPrintStats( Gia_Man_t * p, Cec3_Par_t * pPars, Cec3_Man_t * pMan )
 int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppNew )
 {
     Cec3_Man_t * pMan = Cec3_ManCreate( p, pPars ); 
-    Gia_Obj_t * pObj, * pRepr, * pObjNew; 
+    Gia_Obj_t * pObj, * pRepr; 
     int i, Iter, fDisproved = 1;
 
     // check if any output trivially fails under all-0 pattern
@@ -956,7 +1310,9 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
         pMan->nPatterns = 0;
         Cec3_ManSimulateCis( p );
         Vec_IntClear( pMan->vCexTriples );
-        Gia_ManForEachAnd( p, pObj, i )
+        if ( pMan->vWorkers )
+            fDisproved = Cec3_ManSweepPar( p, pMan );
+        else Gia_ManForEachAnd( p, pObj, i )
         {
             if ( ~pObj->Value || Gia_ObjFailed(p, i) ) // skip swept nodes and failed nodes
                 continue;
@@ -964,15 +1320,7 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
                 continue;
             assert( !Gia_ObjProved(p, i) && !Gia_ObjFailed(p, i) );
             // duplicate the node
-            pObj->Value = Gia_ManHashAnd( pMan->pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
-            if ( Vec_IntSize(&pMan->pNew->vCopies) == Abc_Lit2Var(pObj->Value) )
-            {
-                pObjNew = Gia_ManObj( pMan->pNew, Abc_Lit2Var(pObj->Value) );
-                pObjNew->fMark0 = Gia_ObjIsMuxType( pObjNew );
-                Gia_ObjSetPhase( pMan->pNew, pObjNew );
-                Vec_IntPush( &pMan->pNew->vCopies, -1 );
-            }
-            assert( Vec_IntSize(&pMan->pNew->vCopies) == Gia_ManObjNum(pMan->pNew) );
+            pObj->Value = Cec3_ManDupNode( pMan, pObj );
             pRepr = Gia_ObjReprObj( p, i );
             if ( pRepr == NULL || !~pRepr->Value )
                 continue;
@@ -982,6 +1330,8 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
                 Gia_ObjSetProved( p, i );
                 continue;
             }
+            if ( Cec3_ManTimeOut(pMan) ) // leave the remaining nodes unmerged
+                break;
             if ( Cec3_ManSweepNode(pMan, i) )
             {
                 if ( Gia_ObjProved(p, i) )
@@ -1001,6 +1351,12 @@ int Cec3_ManPerformSweeping( Gia_Man_t * p, Cec3_Par_t * pPars, Gia_Man_t ** ppN
                 break;
         }
         Cec3_ManPrintStats( p, pPars, pMan );
+        if ( Cec3_ManTimeOut(pMan) )
+        {
+            if ( pPars->fVerbose )
+                printf( "Timeout (%d sec) is reached.\n", pPars->nTimeLimit );
+            break;
+        }
     }
     // finish the AIG, if it is not finished
     if ( ppNew )
@@ -1031,6 +1387,8 @@ Gia_Man_t * Cec3_ManSimulateTest( Gia_Man_t * p, Cec_ParFra_t * pPars0 )
 //    pPars->nItersMax  = pPars0->nItersMax;  // max number of iterations
     pPars->nConfLimit = pPars0->nBTLimit;   // conflict limit at a node
     pPars->fUseCones  = pPars0->fUseCones;
+    pPars->nProcs     = pPars0->nProcs;
+    pPars->nTimeLimit = pPars0->TimeLimit;  // runtime limit
     pPars->fVerbose   = pPars0->fVerbose;
 //    Gia_ManComputeGiaEquivs( p, 100000, 0 );
 //    Gia_ManEquivPrintClasses( p, 1, 0 );
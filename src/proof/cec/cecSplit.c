@@ -24,18 +24,8 @@
 #include "sat/cnf/cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilPool.h"
 //#include "bdd/cudd/cuddInt.h"
-
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-#include "../lib/pthread.h"
-#else
-#include <pthread.h>
-#include <unistd.h>
-#endif
-
-#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -46,7 +36,7 @@ ABC_NAMESPACE_IMPL_START
 
 #ifndef ABC_USE_PTHREADS
 
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nConfLimit, int nIterMax, int LookAhead, int fCubes, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
 
@@ -537,48 +527,33 @@ int Cec_GiaSplitTest2( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, in
   SeeAlso     []
 
 ***********************************************************************/
-#define PAR_THR_MAX 100
 typedef struct Par_ThData_t_
 {
     Gia_Man_t * p;
     Cnf_Dat_t * pCnf;
     int         iThread;
     int         nTimeOut;
-    int         fWorking;
     int         Result;
     int         nVars;
     int         nConfs;
 } Par_ThData_t;
-void * Cec_GiaSplitWorkerThread( void * pArg )
+int Cec_GiaSplitWorkerTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->p == NULL )
-        {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-        pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
-        pThData->fWorking = 0;
-    }
-	assert( 0 );
-	return NULL;
+    pThData->Result = Cnf_GiaSolveOne( pThData->p, pThData->pCnf, pThData->nTimeOut, &pThData->nVars, &pThData->nConfs );
+    return pThData->Result;
 }
 int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
 {
     abctime clkTotal = Abc_Clock();
-    Par_ThData_t ThData[PAR_THR_MAX];
-	pthread_t WorkerThread[PAR_THR_MAX];
+    Util_Pool_t * pPool;
+    Util_Task_t ** ppTasks;
+    Par_ThData_t * ThData;
     Vec_Ptr_t * vStack;
     Cnf_Dat_t * pCnf;
     double Progress = 0;
     int i, status, nSatVars, nSatConfs;
-    int nIter = 0, RetValue = -1, fWorkToDo = 1;
+    int nIter = 0, RetValue = -1;
     Abc_CexFreeP( &p->pCexComb );
     if ( fVerbose )
         printf( "Solving CEC problem by cofactoring with the following parameters:\n" );
@@ -589,7 +564,7 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
         return Cec_GiaSplitTest2( p, nProcs, nTimeOut, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
     // subtract manager thread
     nProcs--;
-    assert( nProcs >= 1 && nProcs <= PAR_THR_MAX );
+    assert( nProcs >= 1 );
     // check the problem
     pCnf = Cec_GiaDeriveGiaRemapped( p );
     status = Cnf_GiaSolveOne( p, pCnf, nTimeOut, &nSatVars, &nSatConfs );
@@ -612,114 +587,110 @@ int Cec_GiaSplitTestInt( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax,
     // create local copy
     vStack = Vec_PtrAlloc( 1000 );
     Vec_PtrPush( vStack, Gia_ManDup(p) );
-    // start threads
+    // prepare the tasks
+    pPool   = Util_PoolGlobal( nProcs );
+    ppTasks = ABC_CALLOC( Util_Task_t *, nProcs );
+    ThData  = ABC_CALLOC( Par_ThData_t, nProcs );
     for ( i = 0; i < nProcs; i++ )
     {
         ThData[i].p        = NULL;
         ThData[i].pCnf     = NULL;
         ThData[i].iThread  = i;
         ThData[i].nTimeOut = nTimeOut;
-        ThData[i].fWorking = 0;
         ThData[i].Result   = -1;
         ThData[i].nVars    = -1;
         ThData[i].nConfs   = -1;
-        status = pthread_create( WorkerThread + i, NULL,Cec_GiaSplitWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
-    // look at the threads
-    while ( fWorkToDo )
+    // solve the cofactors
+    while ( 1 )
     {
-        fWorkToDo = (int)(Vec_PtrSize(vStack) > 0);
-        for ( i = 0; i < nProcs; i++ )
+        // give the idle slots new cofactors
+        for ( i = 0; i < nProcs && Vec_PtrSize(vStack) > 0; i++ )
         {
-            // check if this thread is working
-            if ( ThData[i].fWorking )
-            {
-                fWorkToDo = 1;
+            if ( ppTasks[i] != NULL )
                 continue;
+            assert( ThData[i].p == NULL );
+            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
+            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
+            ppTasks[i] = Util_PoolSubmit( pPool, Cec_GiaSplitWorkerTask, ThData + i );
+        }
+        // wait for one of them to be solved
+        i = Util_TaskWaitAny( ppTasks, nProcs );
+        if ( i == -1 ) // all cofactors are UNSAT
+        {
+            RetValue = 1;
+            break;
+        }
+        Util_TaskFree( ppTasks[i] );
+        ppTasks[i] = NULL;
+        {
+            Gia_Man_t * pLast = ThData[i].p;
+            int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
+            if ( pLast->vCofVars == NULL )
+                pLast->vCofVars = Vec_IntAlloc( 100 );
+            if ( fVerbose )
+                Cec_GiaSplitPrint( i+1, Depth, ThData[i].nVars, ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
+            if ( ThData[i].Result == 0 ) // SAT
+            {
+                p->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
+                RetValue = 0;
+                goto finish;
             }
-            // check if this thread has recently finished
-            if ( ThData[i].p != NULL )
+            if ( ThData[i].Result == -1 ) // UNDEC
             {
-                Gia_Man_t * pLast = ThData[i].p;
-                int Depth = pLast->vCofVars ? Vec_IntSize(pLast->vCofVars) : 0;
-                if ( pLast->vCofVars == NULL )
-                    pLast->vCofVars = Vec_IntAlloc( 100 );
-                if ( fVerbose )
-                    Cec_GiaSplitPrint( i+1, Depth, ThData[i].nVars, ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
-                if ( ThData[i].Result == 0 ) // SAT
+                // determine cofactoring variable
+                int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
+                // cofactor
+                Gia_Man_t * pPart = Gia_ManDupCofactorVar( pLast, iVar, 0 );
+                pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
+                Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
+                Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
+                Vec_PtrPush( vStack, pPart );
+                // print results
+                if ( fVeryVerbose )
                 {
-                    p->pCexComb = pLast->pCexComb;  pLast->pCexComb = NULL;
-                    RetValue = 0;
-                    goto finish;
+//                    Cec_GiaSplitPrintRefs( pLast );
+                    printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
+                        iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
+//                    Cec_GiaSplitPrintRefs( pPart );
                 }
-                if ( ThData[i].Result == -1 ) // UNDEC
-                {
-                    // determine cofactoring variable
-                    int nFanouts, Cost, iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
-                    // cofactor
-                    Gia_Man_t * pPart = Gia_ManDupCofactorVar( pLast, iVar, 0 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // print results
-                    if ( fVeryVerbose )
-                    {
-//                        Cec_GiaSplitPrintRefs( pLast );
-                        printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
-                            iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
-//                        Cec_GiaSplitPrintRefs( pPart );
-                    }
-                    // cofactor
-                    pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
-                    pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
-                    Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
-                    Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 1) );
-                    Vec_PtrPush( vStack, pPart );
-                    // keep working
-                    fWorkToDo = 1;
-                    nIter++;
-                }
-                else
-                    Progress += 1.0 / pow(2, Depth);
-                Gia_ManStopP( &ThData[i].p );
-                if ( ThData[i].pCnf == NULL )
-                    continue;
-                Cnf_DataFree( ThData[i].pCnf );
-                ThData[i].pCnf = NULL;
+                // cofactor
+                pPart = Gia_ManDupCofactorVar( pLast, iVar, 1 );
+                pPart->vCofVars = Vec_IntAlloc( Vec_IntSize(pLast->vCofVars) + 1 );
+                Vec_IntAppend( pPart->vCofVars, pLast->vCofVars );
+                Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, 0) );
+                Vec_PtrPush( vStack, pPart );
+                nIter++;
             }
-            if ( Vec_PtrSize(vStack) == 0 )
-                continue;
-            // start a new thread
-            assert( ThData[i].p == NULL );
-            ThData[i].p = (Gia_Man_t*)Vec_PtrPop( vStack );
-            ThData[i].pCnf = Cec_GiaDeriveGiaRemapped( ThData[i].p );
-            ThData[i].fWorking = 1;
+            else
+                Progress += 1.0 / pow(2, Depth);
+            Gia_ManStopP( &ThData[i].p );
+            if ( ThData[i].pCnf )
+                Cnf_DataFree( ThData[i].pCnf );
+            ThData[i].pCnf = NULL;
         }
         if ( nIterMax && nIter >= nIterMax )
             break;
     }
-    if ( !fWorkToDo )
-        RetValue = 1;
 finish:
-    // wait till threads finish
-    for ( i = 0; i < nProcs; i++ )
-        if ( ThData[i].fWorking )
-            i = 0;
-    // stop threads
+    // wait till the running tasks finish; the queued ones are not started
     for ( i = 0; i < nProcs; i++ )
     {
-        assert( !ThData[i].fWorking );
+        if ( ppTasks[i] )
+        {
+            Util_TaskCancel( ppTasks[i] );
+            Util_TaskWait( ppTasks[i] );
+            Util_TaskFree( ppTasks[i] );
+        }
         // cleanup
         Gia_ManStopP( &ThData[i].p );
         if ( ThData[i].pCnf == NULL )
             continue;
         Cnf_DataFree( ThData[i].pCnf );
         ThData[i].pCnf = NULL;
-        // stop
-        ThData[i].p = NULL;
-        ThData[i].fWorking = 1;
     }
+    ABC_FREE( ppTasks );
+    ABC_FREE( ThData );
     // finish
     Cec_GiaSplitClean( vStack );
 	if ( !fSilent )
@@ -737,7 +708,322 @@ finish:
 	}
     return RetValue;
 }
-int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+/**Function*************************************************************
+
+  Synopsis    [Look-ahead splitter producing the initial cubes.]
+
+  Description [Repeatedly cofactors the largest remaining cofactor of 
+  the miter until there are nCubesMax of them. Returns the cubes as 
+  arrays of literals over the primary inputs (a complemented literal 
+  means the input is 0). Trivially UNSAT cofactors are dropped and 
+  added to the progress.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Cec_GiaSplitCncCubes( Gia_Man_t * p, int nCubesMax, int LookAhead, double * pProgress, int fVeryVerbose )
+{
+    Vec_Ptr_t * vGias, * vCubes;
+    Gia_Man_t * pLast, * pPart;
+    int i, iBest, iVar, Value, nFanouts, Cost;
+    vGias = Vec_PtrAlloc( 2 * nCubesMax );
+    pLast = Gia_ManDup( p );
+    pLast->vCofVars = Vec_IntAlloc( 16 );
+    Vec_PtrPush( vGias, pLast );
+    while ( Vec_PtrSize(vGias) > 0 && Vec_PtrSize(vGias) < nCubesMax )
+    {
+        // find the largest cofactor
+        iBest = 0;
+        Vec_PtrForEachEntry( Gia_Man_t *, vGias, pLast, i )
+            if ( Gia_ManAndNum(pLast) > Gia_ManAndNum((Gia_Man_t *)Vec_PtrEntry(vGias, iBest)) )
+                iBest = i;
+        pLast = (Gia_Man_t *)Vec_PtrEntry( vGias, iBest );
+        if ( Gia_ManAndNum(pLast) == 0 )
+            break;
+        // split it into two
+        iVar = Gia_SplitCofVar( pLast, LookAhead, &nFanouts, &Cost );
+        Vec_PtrRemove( vGias, pLast );
+        for ( Value = 0; Value < 2; Value++ )
+        {
+            pPart = Gia_ManDupCofactorVar( pLast, iVar, Value );
+            pPart->vCofVars = Vec_IntDup( pLast->vCofVars );
+            Vec_IntPush( pPart->vCofVars, Abc_Var2Lit(iVar, !Value) );
+            if ( fVeryVerbose )
+                printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.  AndAfter = %6d.\n", 
+                    iVar, nFanouts, Cost, Gia_ManAndNum(pLast), Gia_ManAndNum(pPart) );
+            if ( Gia_ObjFaninLit0p(pPart, Gia_ManPo(pPart, 0)) == 0 )
+            {
+                *pProgress += 1.0 / pow(2, Vec_IntSize(pPart->vCofVars));
+                Gia_ManStop( pPart );
+                continue;
+            }
+            Vec_PtrPush( vGias, pPart );
+        }
+        Gia_ManStop( pLast );
+    }
+    // collect the cubes
+    vCubes = Vec_PtrAlloc( Vec_PtrSize(vGias) );
+    Vec_PtrForEachEntry( Gia_Man_t *, vGias, pLast, i )
+    {
+        Vec_PtrPush( vCubes, pLast->vCofVars );
+        pLast->vCofVars = NULL;
+        Gia_ManStop( pLast );
+    }
+    Vec_PtrFree( vGias );
+    return vCubes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cofactors the miter by the cube.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec_GiaSplitCofactorCube( Gia_Man_t * p, Vec_Int_t * vCube )
+{
+    Gia_Man_t * pNew = Gia_ManDup( p ), * pTemp;
+    int i, iLit;
+    Vec_IntForEachEntry( vCube, iLit, i )
+    {
+        pNew = Gia_ManDupCofactorVar( pTemp = pNew, Abc_Lit2Var(iLit), !Abc_LitIsCompl(iLit) );
+        Gia_ManStop( pTemp );
+    }
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Cube-and-conquer.]
+
+  Description [Each worker keeps an incremental SAT solver for the miter, 
+  whose CNF is derived once, and solves the cubes under assumptions, 
+  so that the learned clauses are reused across the cubes. The cube that 
+  cannot be solved within the resource limits is split by the worker 
+  that tried it, using the look-ahead on its own copy of the miter, 
+  and the two halves go back to the queue.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Cec_CncData_t_
+{
+    Gia_Man_t *  p;          // the miter (shared, read-only)
+    Gia_Man_t *  pCopy;      // the copy of the miter used for splitting
+    Cnf_Dat_t *  pCnf;       // the CNF of the miter (shared, read-only)
+    sat_solver * pSat;       // the incremental solver of this worker
+    Vec_Int_t *  vCube;      // the cube being solved
+    Vec_Int_t *  vLits;      // the assumptions
+    int          nTimeOut;   // the runtime limit per cube
+    int          nConfLimit; // the conflict limit per cube
+    int          LookAhead;  // the look-ahead used for splitting
+    int          Result;     // 1 = UNSAT, 0 = SAT, -1 = UNDEC
+    int          fCoreEmpty; // UNSAT does not depend on the cube
+    int          iVar;       // the splitting variable of an undecided cube
+    int          nConfs;     // the conflicts spent on the cube
+    Abc_Cex_t *  pCex;       // the counter-example
+} Cec_CncData_t;
+static int Cec_GiaSplitCncStop( int RunId )
+{
+    return Util_TaskIsCancelled( Util_TaskCurrent() );
+}
+int Cec_GiaSplitCncTask( void * pArg )
+{
+    Cec_CncData_t * pData = (Cec_CncData_t *)pArg;
+    Gia_Man_t * pCof;
+    int i, iLit, iSatVar, status, nConfsOld, nFanouts, Cost, * pFinal;
+    Vec_IntClear( pData->vLits );
+    Vec_IntForEachEntry( pData->vCube, iLit, i )
+    {
+        iSatVar = pData->pCnf->pVarNums[Gia_ObjId(pData->p, Gia_ManPi(pData->p, Abc_Lit2Var(iLit)))];
+        Vec_IntPush( pData->vLits, Abc_Var2Lit(iSatVar, Abc_LitIsCompl(iLit)) );
+    }
+    sat_solver_set_runtime_limit( pData->pSat, pData->nTimeOut ? pData->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0 );
+    nConfsOld = sat_solver_nconflicts( pData->pSat );
+    status = sat_solver_solve( pData->pSat, Vec_IntArray(pData->vLits), Vec_IntLimit(pData->vLits), (ABC_INT64_T)pData->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    pData->nConfs = sat_solver_nconflicts( pData->pSat ) - nConfsOld;
+    pData->iVar = -1;
+    pData->fCoreEmpty = 0;
+    if ( status == l_False )
+    {
+        pData->fCoreEmpty = (sat_solver_final( pData->pSat, &pFinal ) == 0);
+        return (pData->Result = 1);
+    }
+    if ( status == l_True )
+    {
+        pData->pCex = Cec_SplitDeriveModel( pData->p, pData->pCnf, pData->pSat );
+        return (pData->Result = 0);
+    }
+    pData->Result = -1;
+    if ( Util_TaskIsCancelled( Util_TaskCurrent() ) )
+        return pData->Result;
+    // find the splitting variable
+    pCof = Cec_GiaSplitCofactorCube( pData->pCopy, pData->vCube );
+    if ( Gia_ObjFaninLit0p(pCof, Gia_ManPo(pCof, 0)) == 0 )
+        pData->Result = 1;
+    else if ( Gia_ManAndNum(pCof) > 0 )
+    {
+        pData->iVar = Gia_SplitCofVar( pCof, pData->LookAhead, &nFanouts, &Cost );
+        if ( Gia_ObjRefNum(pCof, Gia_ManPi(pCof, pData->iVar)) == 0 )
+            pData->iVar = -1;
+    }
+    Gia_ManStop( pCof );
+    return pData->Result;
+}
+int Cec_GiaSplitCnc( Gia_Man_t * p, int nProcs, int nTimeOut, int nConfLimit, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent )
+{
+    abctime clkTotal = Abc_Clock();
+    Util_Pool_t * pPool;
+    Util_Task_t ** ppTasks;
+    Cec_CncData_t * ThData;
+    Vec_Ptr_t * vCubes;
+    Vec_Int_t * vCube;
+    Cnf_Dat_t * pCnf;
+    sat_solver * pSat;
+    double Progress = 0;
+    int i, iVar, nSlots = Abc_MaxInt( 1, nProcs - 1 );
+    int nIter = 0, nCubes = 0, RetValue = -1;
+    Abc_CexFreeP( &p->pCexComb );
+    if ( fVerbose )
+        printf( "Solving CEC problem by cube-and-conquer with the following parameters:\n" );
+    if ( fVerbose )
+        printf( "Processes = %d   TimeOut = %d sec   ConfLimit = %d   MaxIter = %d   LookAhead = %d   Verbose = %d.\n", nProcs, nTimeOut, nConfLimit, nIterMax, LookAhead, fVerbose );
+    fflush( stdout );
+    // derive the CNF once and check that it is not trivially UNSAT
+    pCnf = Cec_GiaDeriveGiaRemapped( p );
+    pSat = Cec_GiaDeriveSolver( p, pCnf, 0 );
+    if ( pSat == NULL )
+    {
+        Cnf_DataFree( pCnf );
+        if ( !fSilent )
+            printf( "The problem is UNSAT without cofactoring.\n" );
+        return 1;
+    }
+    // produce the initial cubes
+    vCubes = Cec_GiaSplitCncCubes( p, nSlots > 1 ? 2 * nSlots : 1, LookAhead, &Progress, fVeryVerbose );
+    if ( fVerbose )
+        printf( "The look-ahead splitter produced %d cubes.\n", Vec_PtrSize(vCubes) );
+    // prepare the workers
+    pPool   = Util_PoolGlobal( nSlots );
+    ppTasks = ABC_CALLOC( Util_Task_t *, nSlots );
+    ThData  = ABC_CALLOC( Cec_CncData_t, nSlots );
+    for ( i = 0; i < nSlots; i++ )
+    {
+        ThData[i].p          = p;
+        ThData[i].pCopy      = Gia_ManDup( p );
+        ThData[i].pCnf       = pCnf;
+        ThData[i].pSat       = i ? Cec_GiaDeriveSolver( p, pCnf, 0 ) : pSat;
+        ThData[i].vLits      = Vec_IntAlloc( 100 );
+        ThData[i].nTimeOut   = nTimeOut;
+        ThData[i].nConfLimit = nConfLimit;
+        ThData[i].LookAhead  = LookAhead;
+        sat_solver_set_stop_func( ThData[i].pSat, Cec_GiaSplitCncStop );
+    }
+    // solve the cubes
+    while ( 1 )
+    {
+        // give the idle workers new cubes
+        for ( i = 0; i < nSlots && Vec_PtrSize(vCubes) > 0; i++ )
+        {
+            if ( ppTasks[i] != NULL )
+                continue;
+            assert( ThData[i].vCube == NULL );
+            ThData[i].vCube = (Vec_Int_t *)Vec_PtrPop( vCubes );
+            ppTasks[i] = Util_PoolSubmit( pPool, Cec_GiaSplitCncTask, ThData + i );
+        }
+        // wait for one of them to be solved
+        i = Util_TaskWaitAny( ppTasks, nSlots );
+        if ( i == -1 ) // all cubes are UNSAT
+        {
+            RetValue = 1;
+            break;
+        }
+        Util_TaskFree( ppTasks[i] );
+        ppTasks[i] = NULL;
+        vCube = ThData[i].vCube;
+        ThData[i].vCube = NULL;
+        if ( ThData[i].Result == 1 )
+            Progress += 1.0 / pow(2, Vec_IntSize(vCube));
+        if ( fVerbose )
+            Cec_GiaSplitPrint( ++nCubes, Vec_IntSize(vCube), sat_solver_nvars(ThData[i].pSat), ThData[i].nConfs, ThData[i].Result, Progress, Abc_Clock() - clkTotal );
+        if ( ThData[i].Result == 0 ) // SAT
+        {
+            p->pCexComb = ThData[i].pCex;  ThData[i].pCex = NULL;
+            Vec_IntFree( vCube );
+            RetValue = 0;
+            goto finish;
+        }
+        if ( ThData[i].Result == 1 ) // UNSAT
+        {
+            Vec_IntFree( vCube );
+            if ( ThData[i].fCoreEmpty )
+            {
+                RetValue = 1;
+                goto finish;
+            }
+            continue;
+        }
+        // UNDEC
+        iVar = ThData[i].iVar;
+        if ( iVar == -1 )
+        {
+            Vec_IntFree( vCube );
+            goto finish;
+        }
+        Vec_PtrPush( vCubes, Vec_IntDup(vCube) );
+        Vec_IntPush( (Vec_Int_t *)Vec_PtrEntryLast(vCubes), Abc_Var2Lit(iVar, 0) );
+        Vec_IntPush( vCube, Abc_Var2Lit(iVar, 1) );
+        Vec_PtrPush( vCubes, vCube );
+        nIter++;
+        if ( nIterMax && nIter >= nIterMax )
+            break;
+    }
+finish:
+    // wait till the running tasks finish; the queued ones are not started
+    for ( i = 0; i < nSlots; i++ )
+    {
+        if ( ppTasks[i] )
+        {
+            Util_TaskCancel( ppTasks[i] );
+            Util_TaskWait( ppTasks[i] );
+            Util_TaskFree( ppTasks[i] );
+        }
+        // cleanup
+        Vec_IntFreeP( &ThData[i].vCube );
+        Vec_IntFree( ThData[i].vLits );
+        Abc_CexFreeP( &ThData[i].pCex );
+        Gia_ManStop( ThData[i].pCopy );
+        sat_solver_delete( ThData[i].pSat );
+    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( ThData );
+    Vec_VecFree( (Vec_Vec_t *)vCubes );
+    Cnf_DataFree( pCnf );
+	if ( !fSilent )
+	{
+		if ( RetValue == 0 )
+			printf( "Problem is SAT " );
+		else if ( RetValue == 1 )
+			printf( "Problem is UNSAT " );
+		else if ( RetValue == -1 )
+			printf( "Problem is UNDECIDED " );
+		else assert( 0 );
+		printf( "after %d case-splits.  ", nIter );
+		Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+		fflush( stdout );
+	}
+    return RetValue;
+}
+
+int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nConfLimit, int nIterMax, int LookAhead, int fCubes, int fVerbose, int fVeryVerbose, int fSilent )
 {
     Abc_Cex_t * pCex = NULL;
     Gia_Man_t * pOne;
@@ -749,8 +1035,10 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
         pOne = Gia_ManDupOutputGroup( p, i, i+1 );
         if ( fVerbose )
             printf( "\nSolving output %d:\n", i );
-        RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
-        Gia_ManStop( pOne );
+        if ( fCubes )
+            RetValue1 = Cec_GiaSplitCnc( pOne, nProcs, nTimeOut, nConfLimit, nIterMax, LookAhead, fVerbose, fVeryVerbose, fSilent );
+        else
+            RetValue1 = Cec_GiaSplitTestInt( pOne, nProcs, nTimeOut, nIterMax, LookAhead,  fVerbose, fVeryVerbose, fSilent );
         // collect the result
         if ( RetValue1 == 0 && RetValue == -1 )
         {
@@ -758,6 +1046,7 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
             pCex->iPo = i;
             RetValue = 0;
         }
+        Gia_ManStop( pOne );
         if ( RetValue1 == -1 )
             fOneUndef = 1;
     }
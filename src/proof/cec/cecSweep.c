@@ -292,6 +292,38 @@ p->timeSim += Abc_Clock() - clk;
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Refines equivalence classes using the shared patterns.]
+
+  Description [Simulates the patterns collected in the pool by the earlier
+  runs of the engines on the AIG with the same CIs. Returns 1 if the miter
+  is found to be failed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManFraClassesPool( Cec_ManFra_t * p, Cec_ManSim_t * pSim, Gia_Pool_t * pPool )
+{
+    int iPat, nPats = Gia_PoolPatNum( pPool );
+    assert( Gia_PoolCiNum(pPool) == Gia_ManCiNum(p->pAig) );
+    if ( nPats == 0 )
+        return 0;
+    Gia_ManCreateValueRefs( p->pAig );
+    for ( iPat = 0; iPat < nPats; iPat += 32 * pSim->nWords )
+    {
+        Gia_ManRandomInfo( pSim->vCiSimInfo, 0, 0, pSim->nWords );
+        Gia_PoolLoadSimInfo( pPool, iPat, pSim->vCiSimInfo, pSim->nWords );
+        if ( Cec_ManSimSimulateRound( pSim, pSim->vCiSimInfo, pSim->vCoSimInfo ) )
+            return 1;
+    }
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Simulated %d patterns from the shared pool.\n", nPats );
+    return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -83,6 +83,8 @@ struct Pdr_Par_t_
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
     abctime timeLastSolved; // the time when the last output was solved
     Vec_Int_t * vOutMap;  // in the multi-output mode, contains status for each PO (0 = sat; 1 = unsat; negative = undecided)
+    int nProcs;           // the number of engines in the portfolio
+    void * pShared;       // the lemma store shared by the engines of the portfolio
 };
 
 ////////////////////////////////////////////////////////////////////////
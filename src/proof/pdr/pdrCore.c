@@ -79,6 +79,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nFailOuts      =       0;  // the number of disproved outputs
     pPars->nDropOuts      =       0;  // the number of timed out outputs
     pPars->timeLastSolved =       0;  // last one solved
+    pPars->nProcs         =       1;  // the number of engines in the portfolio
 }
 
 /**Function*************************************************************
@@ -427,6 +428,7 @@ int ZPdr_ManDown( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCube, Pdr_Set_t * pPred,
                 Vec_IntAddToEntry( p->vPrio, pCubeMin->Lits[i] / 2, 1 << p->nPrioShift );
             }
 
+            Pdr_ManShareExport( p, l, pCubeMin );
             Vec_VecPush( p->vClauses, l, pCubeMin );   // consume ref
             p->nCubes++;
             // add clause
@@ -985,6 +987,7 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
                     p->nAbsFlops++;
                 Vec_IntAddToEntry( p->vPrio, pCubeMin->Lits[i] / 2, 1 << p->nPrioShift );
             }
+            Pdr_ManShareExport( p, k, pCubeMin );
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
             // add clause
@@ -1141,7 +1144,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                     p->pPars->iFrame = iFrame;
                     return -1;
                 }
-                RetValue = Pdr_ManCheckCube( p, iFrame, NULL, &pCube, p->pPars->nConfLimit, 0, 1 );
+                // add the cubes blocked by other engines of the portfolio
+                // (the import fails when a resource limit is reached, as the check below)
+                RetValue = p->pPars->pShared ? Pdr_ManShareImport( p ) : 0;
+                if ( RetValue != -1 )
+                    RetValue = Pdr_ManCheckCube( p, iFrame, NULL, &pCube, p->pPars->nConfLimit, 0, 1 );
                 if ( RetValue == 1 )
                     break;
                 if ( RetValue == -1 )
@@ -1285,8 +1292,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
             Pdr_ManPrintClauses( p, 0 );
         }
+        // add the cubes blocked by other engines of the portfolio
+        RetValue = p->pPars->pShared ? Pdr_ManShareImport( p ) : 0;
         // push clauses into this timeframe
-        RetValue = Pdr_ManPushClauses( p );
+        if ( RetValue != -1 )
+            RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
             if ( p->pPars->fVerbose )
@@ -1411,6 +1421,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSkipGeneral ? "yes" : "no",
             pPars->fSolveAll ?    "yes" : "no" );
     }
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll && !pPars->fUseBridge && !pPars->fUseAbs && pPars->pShared == NULL )
+        return Pdr_ManSolvePortfolio( pAig, pPars );
     ABC_FREE( pAig->pSeqModel );
     p = Pdr_ManStart( pAig, pPars, NULL );
     RetValue = Pdr_ManSolveInt( p );
@@ -138,6 +138,11 @@ struct Pdr_Man_t_
     Vec_Int_t * vVisits;   // intermediate
     Vec_Int_t * vCi2Rem;   // CIs to be removed
     Vec_Int_t * vRes;      // final result
+    Vec_Int_t * vCands;    // CIs to try removing
+    Vec_Int_t * vTsimMap;  // local numbers of the cone objects
+    Vec_Int_t * vTsimProg; // fanin literals of the cone nodes and COs
+    Vec_Wrd_t * vTsim;     // two-rail ternary simulation info
+    Vec_Wrd_t * vTsimMasks;// lanes where the candidate CIs are X
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
     // statistics
@@ -158,6 +163,11 @@ struct Pdr_Man_t_
     int         nQueLim;
     int         nXsimRuns;
     int         nXsimLits;
+    // lemma sharing
+    int         iShareId;  // the engine ID in the portfolio
+    int         iShareNext;// the next shared cube to import
+    int         nShareIn;  // the number of imported cubes
+    int         nShareOut; // the number of exported cubes
     // runtime
     abctime     timeToStop;
     abctime     timeToStopOne;
@@ -202,6 +212,7 @@ extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
 /*=== pdrInv.c ==========================================================*/
 extern Vec_Int_t *     Pdr_ManCountFlopsInv( Pdr_Man_t * p );
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
@@ -216,6 +227,10 @@ extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_In
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+/*=== pdrPth.c ==========================================================*/
+extern void            Pdr_ManShareExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern int             Pdr_ManShareImport( Pdr_Man_t * p );
+extern int             Pdr_ManSolvePortfolio( Aig_Man_t * pAig, Pdr_Par_t * pPars );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
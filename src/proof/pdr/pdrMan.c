@@ -278,6 +278,11 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->vUndo    = Vec_IntAlloc( 100 );  // cone undos
     p->vVisits  = Vec_IntAlloc( 100 );  // intermediate
     p->vCi2Rem  = Vec_IntAlloc( 100 );  // CIs to be removed
+    p->vCands   = Vec_IntAlloc( 100 );  // CIs to try removing
+    p->vTsimMap = Vec_IntAlloc( 0 );    // local numbers of the cone objects
+    p->vTsimProg= Vec_IntAlloc( 100 );  // fanin literals of the cone nodes and COs
+    p->vTsim    = Vec_WrdAlloc( 100 );  // ternary simulation info
+    p->vTsimMasks = Vec_WrdAlloc( 100 );// lanes where the candidate CIs are X
     p->vRes     = Vec_IntAlloc( 100 );  // final result
     p->pCnfMan  = Cnf_ManStart();
     // ternary simulation
@@ -381,6 +386,11 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFree( p->vUndo     );  // cone undos
     Vec_IntFree( p->vVisits   );  // intermediate
     Vec_IntFree( p->vCi2Rem   );  // CIs to be removed
+    Vec_IntFree( p->vCands    );  // CIs to try removing
+    Vec_IntFree( p->vTsimMap  );  // local numbers of the cone objects
+    Vec_IntFree( p->vTsimProg );  // fanin literals of the cone nodes and COs
+    Vec_WrdFree( p->vTsim     );  // ternary simulation info
+    Vec_WrdFree( p->vTsimMasks );  // lanes where the candidate CIs are X
     Vec_IntFree( p->vRes      );  // final result
     Vec_PtrFreeP( &p->vInfCubes );
     ABC_FREE( p->pTime4Outs );
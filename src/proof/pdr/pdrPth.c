@@ -0,0 +1,492 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Portfolio of PDR engines sharing inductive lemmas.]
+
+  Author      [agent]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: pdrPth.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "base/main/main.h"
+#include "misc/util/utilPool.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef ABC_USE_PTHREADS
+
+// the max number of portfolios running at the same time
+#define PDR_PORT_MAX  64
+
+// the lemma store is an append-only array of chunks, which are never moved
+#define PDR_SHR_LOG   12                        // the log2 of the chunk size
+#define PDR_SHR_CHUNK (1 << PDR_SHR_LOG)        // the number of entries in a chunk
+#define PDR_SHR_MAX   1024                      // the max number of chunks
+
+#if defined(__GNUC__)
+#define PDR_SHR_LOAD(p)         __atomic_load_n( p, __ATOMIC_ACQUIRE )
+#define PDR_SHR_STORE(p, v)     __atomic_store_n( p, v, __ATOMIC_RELEASE )
+#define PDR_SHR_ADD(p, v)       __sync_fetch_and_add( p, v )
+#define PDR_SHR_CAS(p, o, n)    __sync_bool_compare_and_swap( p, o, n )
+#else
+#define PDR_SHR_LOAD(p)         (*(p))
+#define PDR_SHR_STORE(p, v)     (*(p) = (v))
+#define PDR_SHR_ADD(p, v)       ((*(p) += (v)) - (v))
+#define PDR_SHR_CAS(p, o, n)    (*(p) == (o) ? (*(p) = (n), 1) : 0)
+#endif
+
+typedef struct Pdr_ShrCube_t_ Pdr_ShrCube_t;
+struct Pdr_ShrCube_t_
+{
+    Pdr_Set_t *      pCube;       // blocked cube (private copy); NULL until published
+    int              Frame;       // the frame where the cube is blocked
+    int              Owner;       // the engine that derived the cube
+};
+
+// lemma store shared by the engines of one portfolio
+typedef struct Pdr_Shr_t_ Pdr_Shr_t;
+struct Pdr_Shr_t_
+{
+    Pdr_ShrCube_t *  pChunks[PDR_SHR_MAX]; // the chunks of the store
+    volatile int     nCubes;      // the number of entries reserved by the engines
+    volatile int     fStop;       // set when one of the engines has solved the problem
+    volatile int     iWinner;     // the engine that solved the problem
+    int              RunIdOld;    // the run ID of the caller
+    int(*pFuncStopOld)(int);      // the stop callback of the caller
+};
+
+typedef struct Pdr_ThData_t_ Pdr_ThData_t;
+struct Pdr_ThData_t_
+{
+    Pdr_Man_t *      pMan;        // the PDR engine
+    Pdr_Shr_t *      pShr;        // the shared lemma store
+    Pdr_Par_t        Pars;        // the parameters of this engine
+    int              RetValue;    // the result of this engine
+};
+
+// the portfolios currently running (indexed by run ID)
+static pthread_mutex_t    s_PortMutex = PTHREAD_MUTEX_INITIALIZER;
+static Pdr_Shr_t * volatile s_PortShrs[PDR_PORT_MAX];
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+void Pdr_ManShareExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube ) {}
+int  Pdr_ManShareImport( Pdr_Man_t * p )                           { return 0; }
+int  Pdr_ManSolvePortfolio( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    pPars->nProcs = 1;
+    return Pdr_ManSolve( pAig, pPars );
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the engines of the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManCallBackToStop( int RunId )
+{
+    Pdr_Shr_t * pShr = s_PortShrs[RunId];
+    assert( RunId >= 0 && RunId < PDR_PORT_MAX && pShr != NULL );
+    if ( PDR_SHR_LOAD(&pShr->fStop) )
+        return 1;
+    return pShr->pFuncStopOld && pShr->pFuncStopOld(pShr->RunIdOld);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the entry of the store.]
+
+  Description [The chunk is allocated by the first engine needing it.
+  The engines losing the race for the chunk free their allocation.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Pdr_ShrCube_t * Pdr_ManShareEntry( Pdr_Shr_t * pShr, int i, int fAlloc )
+{
+    Pdr_ShrCube_t ** ppChunk = pShr->pChunks + (i >> PDR_SHR_LOG);
+    Pdr_ShrCube_t * pChunk = PDR_SHR_LOAD( ppChunk );
+    if ( pChunk == NULL && fAlloc )
+    {
+        pChunk = ABC_CALLOC( Pdr_ShrCube_t, PDR_SHR_CHUNK );
+        if ( !PDR_SHR_CAS( ppChunk, NULL, pChunk ) )
+        {
+            ABC_FREE( pChunk );
+            pChunk = PDR_SHR_LOAD( ppChunk );
+        }
+    }
+    return pChunk ? pChunk + (i & (PDR_SHR_CHUNK - 1)) : NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the cube blocked in frame k.]
+
+  Description [The cube is copied because the reference counters of
+  the cubes are not thread-safe. The engine reserves an entry with an 
+  atomic increment, fills it in, and publishes it by storing the cube 
+  with release semantics, so the engines exporting cubes never wait 
+  for each other. The cube is not shared if the store is full.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShareExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Shr_t * pShr = (Pdr_Shr_t *)p->pPars->pShared;
+    Pdr_ShrCube_t * pEntry;
+    int i;
+    if ( pShr == NULL )
+        return;
+    if ( PDR_SHR_LOAD(&pShr->nCubes) >= PDR_SHR_MAX * PDR_SHR_CHUNK )
+        return;
+    i = PDR_SHR_ADD( &pShr->nCubes, 1 );
+    if ( i >= PDR_SHR_MAX * PDR_SHR_CHUNK )
+        return;
+    pEntry = Pdr_ManShareEntry( pShr, i, 1 );
+    pEntry->Frame = k;
+    pEntry->Owner = p->iShareId;
+    PDR_SHR_STORE( &pEntry->pCube, Pdr_SetDup(pCube) );
+    p->nShareOut++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the cubes published by other engines.]
+
+  Description [A cube blocked in frame k by another engine is added to
+  frame k of this engine (or to the last frame, if there are fewer frames)
+  only if it does not contain an initial state and it is blocked relative
+  to the previous frame. This keeps the frames of this engine inductive
+  relative to each other. The entries reserved but not yet published are
+  imported by a later call. Returns -1 if the resource limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShareImport( Pdr_Man_t * p )
+{
+    Pdr_Shr_t * pShr = (Pdr_Shr_t *)p->pPars->pShared;
+    Pdr_ShrCube_t * pEntry;
+    Pdr_Set_t * pCube;
+    int i, k, kMax, nCubes, RetValue, Counter = 0;
+    if ( pShr == NULL )
+        return 0;
+    kMax = Vec_PtrSize(p->vSolvers)-1;
+    if ( kMax < 1 )
+        return 0;
+    nCubes = Abc_MinInt( PDR_SHR_LOAD(&pShr->nCubes), PDR_SHR_MAX * PDR_SHR_CHUNK );
+    for ( i = p->iShareNext; i < nCubes; i++ )
+    {
+        // stop at the first entry not yet published
+        pEntry = Pdr_ManShareEntry( pShr, i, 0 );
+        if ( pEntry == NULL || (pCube = PDR_SHR_LOAD(&pEntry->pCube)) == NULL )
+            break;
+        if ( pEntry->Owner == p->iShareId )
+            continue;
+        pCube = Pdr_SetDup( pCube );
+        k = Abc_MinInt( pEntry->Frame, kMax );
+        // skip cubes that are not useful or cannot be blocked
+        if ( k < 1 || Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment(p, k, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, 0, 0, 1 );
+        if ( RetValue == -1 )
+        {
+            Pdr_SetDeref( pCube );
+            p->iShareNext = i;
+            return -1;
+        }
+        if ( RetValue == 0 )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        // add the clause to frames 1..k
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        for ( RetValue = 1; RetValue <= k; RetValue++ )
+            Pdr_ManSolverAddClause( p, RetValue, pCube );
+        Counter++;
+    }
+    p->iShareNext = i;
+    p->nShareIn += Counter;
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Diversifies the parameters of the engines.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManPortfolioSetPars( Pdr_Par_t * pPars, int iEngine )
+{
+    switch ( iEngine % 8 )
+    {
+    case 0:                                            break;
+    case 1: pPars->fMonoCnf   ^= 1;                    break;
+    case 2: pPars->fSkipDown  ^= 1;                    break;
+    case 3: pPars->fSkipDown   = 0; pPars->fCtgs = 1;  break;
+    case 4: pPars->fFlopOrder ^= 1;                    break;
+    case 5: pPars->fTwoRounds ^= 1;                    break;
+    case 6: pPars->fFlopPrio  ^= 1;                    break;
+    case 7: pPars->fMonoCnf   ^= 1; pPars->fFlopOrder ^= 1; break;
+    }
+    pPars->nRandomSeed += 1000003 * iEngine;
+}
+char * Pdr_ManPortfolioParsStr( int iEngine )
+{
+    switch ( iEngine % 8 )
+    {
+    case 0: return "default";
+    case 1: return "mono CNF";
+    case 2: return "down";
+    case 3: return "CTGs";
+    case 4: return "flop order";
+    case 5: return "two rounds";
+    case 6: return "flop priority";
+    case 7: return "mono CNF + flop order";
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one engine of the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManPortfolioThread( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    Pdr_Shr_t * pShr = pThData->pShr;
+    pThData->RetValue = Pdr_ManSolveInt( pThData->pMan );
+    if ( pThData->RetValue != -1 )
+    {
+        PDR_SHR_CAS( &pShr->iWinner, -1, pThData->pMan->iShareId );
+        PDR_SHR_STORE( &pShr->fStop, 1 );
+    }
+    return pThData->RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs several PDR engines exchanging the blocked cubes.]
+
+  Description [Each engine works on its own copy of the AIG with its own
+  parameters. The first engine that proves or disproves the property
+  stops the others. Only the single-property mode is supported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePortfolio( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_ThData_t * pThData;
+    Util_Pool_t * pPool;
+    Util_Task_t ** ppTasks;
+    Pdr_Shr_t * pShr;
+    Pdr_ShrCube_t * pEntry;
+    Pdr_Man_t * p;
+    int i, k, RunId = -1, RetValue = -1, nProcs = pPars->nProcs, status;
+    abctime clk = Abc_Clock();
+    assert( nProcs > 1 && !pPars->fSolveAll );
+    // create the shared store
+    pShr = ABC_CALLOC( Pdr_Shr_t, 1 );
+    pShr->iWinner      = -1;
+    pShr->RunIdOld     = pPars->RunId;
+    pShr->pFuncStopOld = pPars->pFuncStop;
+    // register the portfolio
+    status = pthread_mutex_lock( &s_PortMutex );  assert( status == 0 );
+    for ( i = 0; i < PDR_PORT_MAX; i++ )
+        if ( s_PortShrs[i] == NULL )
+        {
+            s_PortShrs[RunId = i] = pShr;
+            break;
+        }
+    status = pthread_mutex_unlock( &s_PortMutex );  assert( status == 0 );
+    if ( RunId == -1 )
+    {
+        Abc_Print( 0, "Too many PDR portfolios are running. Using one engine.\n" );
+        ABC_FREE( pShr );
+        pPars->nProcs = 1;
+        RetValue = Pdr_ManSolve( pAig, pPars );
+        pPars->nProcs = nProcs;
+        return RetValue;
+    }
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running a portfolio of %d PDR engines sharing the blocked cubes.\n", nProcs );
+    // start the engines
+    ABC_FREE( pAig->pSeqModel );
+    pThData  = ABC_CALLOC( Pdr_ThData_t, nProcs );
+    ppTasks  = ABC_CALLOC( Util_Task_t *, nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].Pars           = *pPars;
+        pThData[i].Pars.fVerbose  = 0;
+        pThData[i].Pars.fVeryVerbose = 0;
+        pThData[i].Pars.fNotVerbose = 1;
+        pThData[i].Pars.fSilent   = 1;
+        pThData[i].Pars.fDumpInv  = 0;
+        pThData[i].Pars.vOutMap   = NULL;
+        pThData[i].Pars.nFailOuts = 0;
+        pThData[i].Pars.nProveOuts = 0;
+        pThData[i].Pars.nDropOuts = 0;
+        pThData[i].Pars.RunId     = RunId;
+        pThData[i].Pars.pFuncStop = Pdr_ManCallBackToStop;
+        pThData[i].Pars.pShared   = pShr;
+        Pdr_ManPortfolioSetPars( &pThData[i].Pars, i );
+        pThData[i].pShr           = pShr;
+        pThData[i].RetValue       = -1;
+        pThData[i].pMan           = Pdr_ManStart( Aig_ManDupSimple(pAig), &pThData[i].Pars, NULL );
+        pThData[i].pMan->iShareId = i;
+    }
+    pPool = Util_PoolGlobal( nProcs );
+    for ( i = 0; i < nProcs; i++ )
+        ppTasks[i] = Util_PoolSubmit( pPool, Pdr_ManPortfolioThread, (void *)(pThData + i) );
+    // the engines not started when the problem is solved are skipped
+    while ( (i = Util_TaskWaitAny(ppTasks, nProcs)) >= 0 )
+    {
+        Util_TaskFree( ppTasks[i] );
+        ppTasks[i] = NULL;
+        if ( PDR_SHR_LOAD(&pShr->fStop) )
+            for ( k = 0; k < nProcs; k++ )
+                if ( ppTasks[k] )
+                    Util_TaskCancel( ppTasks[k] );
+    }
+    // unregister the portfolio
+    status = pthread_mutex_lock( &s_PortMutex );  assert( status == 0 );
+    s_PortShrs[RunId] = NULL;
+    status = pthread_mutex_unlock( &s_PortMutex );  assert( status == 0 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pThData[i].Pars.RunId     = pPars->RunId;
+        pThData[i].Pars.pFuncStop = pPars->pFuncStop;
+        pThData[i].Pars.pShared   = NULL;
+    }
+    // collect the results
+    p = pThData[pShr->iWinner >= 0 ? pShr->iWinner : 0].pMan;
+    RetValue = pShr->iWinner >= 0 ? pThData[pShr->iWinner].RetValue : -1;
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nProcs; i++ )
+            Abc_Print( 1, "Engine %d (%-21s) : Frames = %3d.  Cubes = %6d.  Exported = %6d.  Imported = %6d.%s\n",
+                i, Pdr_ManPortfolioParsStr(i), pThData[i].Pars.iFrame, pThData[i].pMan->nCubes,
+                pThData[i].pMan->nShareOut, pThData[i].pMan->nShareIn, i == pShr->iWinner ? "  Solved." : "" );
+        Abc_PrintTime( 1, "Portfolio time", Abc_Clock() - clk );
+    }
+    if ( RetValue == 0 )
+    {
+        assert( p->pAig->pSeqModel != NULL );
+        pAig->pSeqModel = p->pAig->pSeqModel;
+        p->pAig->pSeqModel = NULL;
+    }
+    else if ( RetValue == 1 )
+    {
+        if ( !pPars->fSilent )
+            Pdr_ManReportInvariant( p );
+        if ( !pPars->fSilent )
+            Pdr_ManVerifyInvariant( p );
+    }
+    if ( pPars->fDumpInv )
+    {
+        char * pFileName = Extra_FileNameGenericAppend(pAig->pName, "_inv.pla");
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+        Pdr_ManDumpClauses( p, pFileName, RetValue==1 );
+    }
+    else if ( RetValue == 1 )
+        Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+    pPars->iFrame     = p->pPars->iFrame - 1;
+    pPars->nFailOuts  = p->pPars->nFailOuts;
+    pPars->nProveOuts = p->pPars->nProveOuts;
+    // convert all -2 (unknown) entries into -1 (undec)
+    if ( pPars->vOutMap )
+        for ( k = 0; k < Saig_ManPoNum(pAig); k++ )
+            if ( Vec_IntEntry(pPars->vOutMap, k) == -2 ) // unknown
+                Vec_IntWriteEntry( pPars->vOutMap, k, -1 ); // undec
+    // free the engines
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Aig_Man_t * pTemp = pThData[i].pMan->pAig;
+        Pdr_ManStop( pThData[i].pMan );
+        Aig_ManStop( pTemp );
+    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( pThData );
+    // free the store (all engines are finished)
+    for ( i = 0; i < Abc_MinInt(pShr->nCubes, PDR_SHR_MAX * PDR_SHR_CHUNK); i++ )
+        if ( (pEntry = Pdr_ManShareEntry(pShr, i, 0)) && pEntry->pCube )
+            Pdr_SetDeref( pEntry->pCube );
+    for ( i = 0; i < PDR_SHR_MAX; i++ )
+        ABC_FREE( pShr->pChunks[i] );
+    ABC_FREE( pShr );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+ABC_NAMESPACE_IMPL_END
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "pdrInt.h"
+#include "misc/util/utilTsim.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -260,6 +261,169 @@ void Pdr_ManExtendUndo( Aig_Man_t * pAig, Vec_Int_t * vUndo )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Compiles the cone for bit-parallel ternary simulation.]
+
+  Description [Assigns consecutive local numbers to the constant, the CIs, 
+  and the nodes of the cone, and records the fanin literals of the nodes 
+  and the COs in terms of the local numbers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManTsimCompile( Pdr_Man_t * p )
+{
+    Aig_Obj_t * pObj;
+    int i, nObjs = 1 + Vec_IntSize(p->vCiObjs) + Vec_IntSize(p->vNodes);
+    Vec_IntFillExtra( p->vTsimMap, Aig_ManObjNumMax(p->pAig), -1 );
+    Vec_IntWriteEntry( p->vTsimMap, Aig_ObjId(Aig_ManConst1(p->pAig)), 0 );
+    Aig_ManForEachObjVec( p->vCiObjs, p->pAig, pObj, i )
+        Vec_IntWriteEntry( p->vTsimMap, Aig_ObjId(pObj), 1 + i );
+    Vec_IntClear( p->vTsimProg );
+    Aig_ManForEachObjVec( p->vNodes, p->pAig, pObj, i )
+    {
+        Vec_IntWriteEntry( p->vTsimMap, Aig_ObjId(pObj), 1 + Vec_IntSize(p->vCiObjs) + i );
+        Vec_IntPush( p->vTsimProg, Abc_Var2Lit(Vec_IntEntry(p->vTsimMap, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj)) );
+        Vec_IntPush( p->vTsimProg, Abc_Var2Lit(Vec_IntEntry(p->vTsimMap, Aig_ObjFaninId1(pObj)), Aig_ObjFaninC1(pObj)) );
+    }
+    Aig_ManForEachObjVec( p->vCoObjs, p->pAig, pObj, i )
+        Vec_IntPush( p->vTsimProg, Abc_Var2Lit(Vec_IntEntry(p->vTsimMap, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj)) );
+    Vec_WrdFillExtra( p->vTsim, 2 * nObjs, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the compiled cone for 64 sets of X-valued CIs.]
+
+  Description [The CIs in vCi2Rem are X in all lanes. The i-th CI in vLanes,
+  counting from iLane, is X in the lanes given by the i-th entry of vMasks. 
+  Returns the mask of the lanes, in which all COs keep their values.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Pdr_ManSimDataLanes( Pdr_Man_t * p, Vec_Int_t * vLanes, int iLane, Vec_Wrd_t * vMasks )
+{
+    word * pSim = Vec_WrdArray( p->vTsim );
+    int * pProg = Vec_IntArray( p->vTsimProg );
+    int * pMap  = Vec_IntArray( p->vTsimMap );
+    int nCis    = Vec_IntSize( p->vCiObjs );
+    int nNodes  = Vec_IntSize( p->vNodes );
+    word Mask, Res = ~(word)0;
+    int i, iObj, Lit;
+    // set the CI values
+    Abc_TsimWordsConst( pSim, GIA_ONE, 1 );
+    for ( i = 0; i < nCis; i++ )
+        Abc_TsimWordsConst( pSim + 2 * (1 + i), Vec_IntEntry(p->vCiVals, i) ? GIA_ONE : GIA_ZER, 1 );
+    Vec_IntForEachEntry( p->vCi2Rem, iObj, i )
+        Abc_TsimWordsConst( pSim + 2 * pMap[iObj], GIA_UND, 1 );
+    for ( i = 0; i < Vec_WrdSize(vMasks); i++ )
+        Abc_TsimWordsSetX( pSim + 2 * pMap[Vec_IntEntry(vLanes, iLane + i)], Vec_WrdEntryP(vMasks, i), 1 );
+    // perform ternary simulation
+    for ( i = 0; i < nNodes; i++ )
+        Abc_TsimWordsAnd( pSim + 2 * (1 + nCis + i), 
+            pSim + 2 * Abc_Lit2Var(pProg[2*i]), Abc_LitIsCompl(pProg[2*i]), 
+            pSim + 2 * Abc_Lit2Var(pProg[2*i+1]), Abc_LitIsCompl(pProg[2*i+1]), 1 );
+    // check the results
+    for ( i = 0; i < Vec_IntSize(p->vCoObjs); i++ )
+    {
+        Lit = pProg[2*nNodes+i];
+        Abc_TsimWordsIsConst( &Mask, pSim + 2 * Abc_Lit2Var(Lit), Vec_IntEntry(p->vCoVals, i) ^ Abc_LitIsCompl(Lit), 1 );
+        Res &= Mask;
+    }
+    return Res;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tries to assign ternary value to the CIs in the given order.]
+
+  Description [Produces the same CIs in vCi2Rem as calling Pdr_ManExtendOne()
+  for each CI in vCands, but simulates the cone for 64 sets of CIs at a 
+  time. Because ternary simulation is monotone, removing a prefix of the 
+  CIs succeeds if and only if removing them one by one succeeds for each,
+  and a CI that cannot be removed alone cannot be removed later either.
+  So the lanes first try the prefixes of increasing length spread over 
+  all CIs. If the longest one fails, the lanes try the prefixes ending in 
+  the interval where the first failure happened, which gives the first CI 
+  that cannot be removed, while the remaining lanes try the following CIs 
+  alone and drop those that fail.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManExtendLanes( Pdr_Man_t * p, Vec_Int_t * vCands )
+{
+    Vec_Wrd_t * vMasks = p->vTsimMasks;
+    int pLens[64];
+    word Lanes;
+    int i, k, iBeg = 0, iEnd, nLanes, nCands, nPrev, nInt, nAlone;
+    Pdr_ManTsimCompile( p );
+    while ( (nCands = Vec_IntSize(vCands) - iBeg) > 0 )
+    {
+        // the k-th lane tries the prefix of length pLens[k]
+        nLanes = Abc_MinInt( 64, nCands );
+        for ( k = 0; k < nLanes; k++ )
+            pLens[k] = (int)(((word)(k + 1) * nCands + nLanes - 1) / nLanes);
+        Vec_WrdClear( vMasks );
+        for ( i = k = 0; i < nCands; i++ )
+        {
+            while ( pLens[k] <= i )
+                k++;
+            Vec_WrdPush( vMasks, ~(word)0 << k );
+        }
+        Lanes = Pdr_ManSimDataLanes( p, vCands, iBeg, vMasks );
+        for ( k = 0; k < nLanes && ((Lanes >> k) & 1); k++ );
+        // remove the CIs in the longest successful prefix
+        nPrev = k ? pLens[k-1] : 0;
+        for ( i = 0; i < nPrev; i++ )
+            Vec_IntPush( p->vCi2Rem, Vec_IntEntry(vCands, iBeg + i) );
+        iBeg += nPrev;
+        if ( k == nLanes )
+            break;
+        // the first failure is among the next nInt CIs
+        nInt   = pLens[k] - nPrev;
+        nAlone = nInt < 64 ? Abc_MinInt( 64 - nInt, Vec_IntSize(vCands) - iBeg - nInt ) : 0;
+        nInt   = Abc_MinInt( nInt, 64 );
+        if ( nInt > 1 || nAlone > 0 )
+        {
+            // the first nInt lanes try the prefixes of the interval
+            // while the other lanes try the following CIs alone
+            word IntMask = nInt == 64 ? ~(word)0 : ((word)1 << nInt) - 1;
+            Vec_WrdClear( vMasks );
+            for ( i = 0; i < nInt; i++ )
+                Vec_WrdPush( vMasks, IntMask & (~(word)0 << i) );
+            for ( i = 0; i < nAlone; i++ )
+                Vec_WrdPush( vMasks, (word)1 << (nInt + i) );
+            Lanes = Pdr_ManSimDataLanes( p, vCands, iBeg, vMasks );
+            for ( k = 0; k < nInt && ((Lanes >> k) & 1); k++ );
+        }
+        else
+            Lanes = 0, k = 0;
+        // remove the CIs before the failed one
+        for ( i = 0; i < k; i++ )
+            Vec_IntPush( p->vCi2Rem, Vec_IntEntry(vCands, iBeg + i) );
+        if ( k == nInt ) // the interval was longer than 64 CIs
+        {
+            iBeg += nInt;
+            continue;
+        }
+        // keep the CIs after it, except those that failed alone
+        iEnd = iBeg + nInt + nAlone;
+        for ( i = nInt + nAlone - 1; i > k; i-- )
+            if ( i < nInt || ((Lanes >> i) & 1) )
+                Vec_IntWriteEntry( vCands, --iEnd, Vec_IntEntry(vCands, iBeg + i) );
+        iBeg = iEnd;
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives the resulting cube.]
@@ -358,12 +522,11 @@ Pdr_Set_t * Pdr_ManTernarySim( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
     Vec_Int_t * vCiVals = p->vCiVals;  // cone leaf values (0/1 CI values)
     Vec_Int_t * vCoVals = p->vCoVals;  // cone root values (0/1 CO values)
     Vec_Int_t * vNodes  = p->vNodes;   // cone nodes (node obj IDs)
-    Vec_Int_t * vUndo   = p->vUndo;    // cone undos (node obj IDs)
-    Vec_Int_t * vVisits = p->vVisits;  // intermediate (obj IDs)
+    Vec_Int_t * vCands  = p->vCands;   // CIs to try removing (CI obj IDs)
     Vec_Int_t * vCi2Rem = p->vCi2Rem;  // CIs to be removed (CI obj IDs)
     Vec_Int_t * vRes    = p->vRes;     // final result (flop literals)
     Aig_Obj_t * pObj;
-    int i, Entry, RetValue;
+    int i, Entry;
     //abctime clk = Abc_Clock();
 
     // collect CO objects
@@ -398,11 +561,8 @@ Abc_Print( 1, " in frame %d.\n", k );
     // collect values
     Pdr_ManCollectValues( p, k, vCiObjs, vCiVals );
     Pdr_ManCollectValues( p, k, vCoObjs, vCoVals );
-    // simulate for the first time
 if ( p->pPars->fVeryVerbose )
 Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
-    RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, NULL );
-    assert( RetValue );
 
     // iteratively remove flops
     if ( p->pPars->fFlopPrio )
@@ -419,22 +579,18 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
         Vec_IntSelectSortCost( Vec_IntArray(vRes), Vec_IntSize(vRes), vPrio );
 
         // try removing flops starting from low-priority to high-priority
-        Vec_IntClear( vCi2Rem );
+        Vec_IntClear( vCands );
         Vec_IntForEachEntry( vRes, Entry, i )
         {
             pObj = Aig_ManCi( p->pAig, Saig_ManPiNum(p->pAig) + Entry );
             assert( Saig_ObjIsLo( p->pAig, pObj ) );
-            Vec_IntClear( vUndo );
-            if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-            else
-                Pdr_ManExtendUndo( p->pAig, vUndo );
+            Vec_IntPush( vCands, Aig_ObjId(pObj) );
         }
     }
     else
     {
         // try removing low-priority flops first
-        Vec_IntClear( vCi2Rem );
+        Vec_IntClear( vCands );
         Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
         {
             if ( !Saig_ObjIsLo( p->pAig, pObj ) )
@@ -442,11 +598,7 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
             Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
             if ( Vec_IntEntry(vPrio, Entry) )
                 continue;
-            Vec_IntClear( vUndo );
-            if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-            else
-                Pdr_ManExtendUndo( p->pAig, vUndo );
+            Vec_IntPush( vCands, Aig_ObjId(pObj) );
         }
         // try removing high-priority flops next
         Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
@@ -456,18 +608,15 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
             Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
             if ( !Vec_IntEntry(vPrio, Entry) )
                 continue;
-            Vec_IntClear( vUndo );
-            if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-            else
-                Pdr_ManExtendUndo( p->pAig, vUndo );
+            Vec_IntPush( vCands, Aig_ObjId(pObj) );
         }
     }
+    // the lanes check that the COs keep their values
+    Vec_IntClear( vCi2Rem );
+    Pdr_ManExtendLanes( p, vCands );
 
 if ( p->pPars->fVeryVerbose )
 Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, vCi2Rem );
-    RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, vCi2Rem );
-    assert( RetValue );
 
     // derive the set of resulting registers
     Pdr_ManDeriveResult( p->pAig, vCiObjs, vCiVals, vCi2Rem, vRes, vPiLits );
@@ -357,6 +357,7 @@ clk = Abc_Clock();
         {
             p->nSatCallsSat++;
             Ssc_GiaSavePiPattern( pAig, p->vPattern );
+            Gia_PoolAddValues( Gia_ManPool(pAig), p->vPattern );
             Vec_IntPush( p->vDisPairs, Gia_ObjRepr(p->pAig, i) );
             Vec_IntPush( p->vDisPairs, i );
 //            printf( "Try %2d and %2d: ", Gia_ObjRepr(p->pAig, i), i );
@@ -449,6 +450,7 @@ Gia_Man_t * Ssc_PerformSweepingConstr( Gia_Man_t * p, Ssc_Pars_t * pPars )
 
     pAig = Gia_ManDupLevelized( pResult = pAig );
     Gia_ManStop( pResult );
+    Gia_ManPoolShare( pAig, p );
     pResult = Ssc_PerformSweeping( pAig, pCare, pPars );
     if ( pPars->fAppend )
     {
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "sscInt.h"
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -34,7 +35,8 @@ static inline word Ssc_Random2()           { return ((word)Gia_ManRandom(0) << 3
 static inline void Ssc_SimAnd( word * pSim, word * pSim0, word * pSim1, int nWords, int fComp0, int fComp1 )
 {
     int w;
-    if ( fComp0 && fComp1 ) for ( w = 0; w < nWords; w++ )  pSim[w] = ~(pSim0[w] | pSim1[w]);
+    if ( nWords >= ABC_SIMD_WORDS_MIN ) Abc_SimdAnd( pSim, pSim0, pSim1, nWords, fComp0, fComp1 );
+    else if ( fComp0 && fComp1 ) for ( w = 0; w < nWords; w++ )  pSim[w] = ~(pSim0[w] | pSim1[w]);
     else if ( fComp0 )      for ( w = 0; w < nWords; w++ )  pSim[w] =  ~pSim0[w] & pSim1[w];
     else if ( fComp1 )      for ( w = 0; w < nWords; w++ )  pSim[w] =   pSim0[w] &~pSim1[w];
     else                    for ( w = 0; w < nWords; w++ )  pSim[w] =   pSim0[w] & pSim1[w];
@@ -43,7 +45,8 @@ static inline void Ssc_SimAnd( word * pSim, word * pSim0, word * pSim1, int nWor
 static inline void Ssc_SimDup( word * pSim, word * pSim0, int nWords, int fComp0 )
 {
     int w;
-    if ( fComp0 ) for ( w = 0; w < nWords; w++ )  pSim[w] = ~pSim0[w];
+    if ( nWords >= ABC_SIMD_WORDS_MIN ) Abc_SimdDup( pSim, pSim0, nWords, fComp0 );
+    else if ( fComp0 ) for ( w = 0; w < nWords; w++ )  pSim[w] = ~pSim0[w];
     else          for ( w = 0; w < nWords; w++ )  pSim[w] =  pSim0[w];
 }
 
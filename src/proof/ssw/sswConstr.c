@@ -289,6 +289,7 @@ void Ssw_ManRefineByConstrSim( Ssw_Man_t * p )
         { // copy markB into phase
             Aig_ManForEachObj( p->pAig, pObj, i )
                 pObj->fPhase = pObj->fMarkB;
+            p->pAig->nChanges++;
         }
         else
         { // refine classes
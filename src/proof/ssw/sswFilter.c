@@ -72,6 +72,7 @@ void Ssw_ManRefineByFilterSim( Ssw_Man_t * p, int nFrames )
         { // copy markB into phase
             Aig_ManForEachObj( p->pAig, pObj, i )
                 pObj->fPhase = pObj->fMarkB;
+            p->pAig->nChanges++;
         }
         else
         { // refine classes
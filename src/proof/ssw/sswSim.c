@@ -39,6 +39,10 @@ struct Ssw_Sml_t_
     int              fNonConstOut;      // have seen a non-const-0 output during simulation
     int              nSimRounds;        // statistics
     abctime          timeSim;           // statistics
+    Vec_Int_t *      vNodes;            // internal nodes in the compact form
+    int              nNodesObjs;        // the number of objects when vNodes was derived
+    int              nNodesDels;        // the number of deleted objects when vNodes was derived
+    int              nNodesChanges;     // the number of AIG changes when vNodes was derived
     unsigned         pData[0];          // simulation data for the nodes
 };
 
@@ -694,7 +698,7 @@ void Ssw_SmlAssignDist1Plus( Ssw_Sml_t * p, unsigned * pPat )
 
 /**Function*************************************************************
 
-  Synopsis    [Simulates one node.]
+  Synopsis    [Computes the phase-normalized simulation info of one AND.]
 
   Description []
 
@@ -703,61 +707,133 @@ void Ssw_SmlAssignDist1Plus( Ssw_Sml_t * p, unsigned * pPat )
   SeeAlso     []
 
 ***********************************************************************/
-void Ssw_SmlNodeSimulate( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
+static inline void Ssw_SmlSimulateAnd( unsigned * pSims, unsigned * pSims0, unsigned * pSims1, int fCompl, int fCompl0, int fCompl1, int nWords )
 {
-    unsigned * pSims, * pSims0, * pSims1;
-    int fCompl, fCompl0, fCompl1, i;
-    assert( iFrame < p->nFrames );
-    assert( !Aig_IsComplement(pObj) );
-    assert( Aig_ObjIsNode(pObj) );
-    assert( iFrame == 0 || p->nWordsFrame < p->nWordsTotal );
-    // get hold of the simulation information
-    pSims  = Ssw_ObjSim(p, pObj->Id) + p->nWordsFrame * iFrame;
-    pSims0 = Ssw_ObjSim(p, Aig_ObjFanin0(pObj)->Id) + p->nWordsFrame * iFrame;
-    pSims1 = Ssw_ObjSim(p, Aig_ObjFanin1(pObj)->Id) + p->nWordsFrame * iFrame;
-    // get complemented attributes of the children using their random info
-    fCompl  = pObj->fPhase;
-    fCompl0 = Aig_ObjPhaseReal(Aig_ObjChild0(pObj));
-    fCompl1 = Aig_ObjPhaseReal(Aig_ObjChild1(pObj));
-    // simulate
+    int i;
     if ( fCompl0 && fCompl1 )
     {
         if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
+            for ( i = 0; i < nWords; i++ )
                 pSims[i] = (pSims0[i] | pSims1[i]);
         else
-            for ( i = 0; i < p->nWordsFrame; i++ )
+            for ( i = 0; i < nWords; i++ )
                 pSims[i] = ~(pSims0[i] | pSims1[i]);
     }
     else if ( fCompl0 && !fCompl1 )
     {
         if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
+            for ( i = 0; i < nWords; i++ )
                 pSims[i] = (pSims0[i] | ~pSims1[i]);
         else
-            for ( i = 0; i < p->nWordsFrame; i++ )
+            for ( i = 0; i < nWords; i++ )
                 pSims[i] = (~pSims0[i] & pSims1[i]);
     }
     else if ( !fCompl0 && fCompl1 )
     {
         if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
+            for ( i = 0; i < nWords; i++ )
                 pSims[i] = (~pSims0[i] | pSims1[i]);
         else
-            for ( i = 0; i < p->nWordsFrame; i++ )
+            for ( i = 0; i < nWords; i++ )
                 pSims[i] = (pSims0[i] & ~pSims1[i]);
     }
     else // if ( !fCompl0 && !fCompl1 )
     {
         if ( fCompl )
-            for ( i = 0; i < p->nWordsFrame; i++ )
+            for ( i = 0; i < nWords; i++ )
                 pSims[i] = ~(pSims0[i] & pSims1[i]);
         else
-            for ( i = 0; i < p->nWordsFrame; i++ )
+            for ( i = 0; i < nWords; i++ )
                 pSims[i] = (pSims0[i] & pSims1[i]);
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates one node.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SmlNodeSimulate( Ssw_Sml_t * p, Aig_Obj_t * pObj, int iFrame )
+{
+    unsigned * pSims, * pSims0, * pSims1;
+    int fCompl, fCompl0, fCompl1;
+    assert( iFrame < p->nFrames );
+    assert( !Aig_IsComplement(pObj) );
+    assert( Aig_ObjIsNode(pObj) );
+    assert( iFrame == 0 || p->nWordsFrame < p->nWordsTotal );
+    // get hold of the simulation information
+    pSims  = Ssw_ObjSim(p, pObj->Id) + p->nWordsFrame * iFrame;
+    pSims0 = Ssw_ObjSim(p, Aig_ObjFanin0(pObj)->Id) + p->nWordsFrame * iFrame;
+    pSims1 = Ssw_ObjSim(p, Aig_ObjFanin1(pObj)->Id) + p->nWordsFrame * iFrame;
+    // get complemented attributes of the children using their random info
+    fCompl  = pObj->fPhase;
+    fCompl0 = Aig_ObjPhaseReal(Aig_ObjChild0(pObj));
+    fCompl1 = Aig_ObjPhaseReal(Aig_ObjChild1(pObj));
+    // simulate
+    Ssw_SmlSimulateAnd( pSims, pSims0, pSims1, fCompl, fCompl0, fCompl1, p->nWordsFrame );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the internal nodes in the compact form.]
+
+  Description [The array is derived once and kept in the manager. It is 
+  derived again if objects were added or deleted, or if fanins or phases 
+  were updated in the AIG since then.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Ssw_SmlCompactNodes( Ssw_Sml_t * p )
+{
+    if ( p->vNodes && p->nNodesObjs == Aig_ManObjNumMax(p->pAig) && 
+         p->nNodesDels == p->pAig->nDeleted && p->nNodesChanges == p->pAig->nChanges )
+        return p->vNodes;
+    Vec_IntFreeP( &p->vNodes );
+    p->vNodes        = Aig_ManCompactNodes( p->pAig, 1 );
+    p->nNodesObjs    = Aig_ManObjNumMax(p->pAig);
+    p->nNodesDels    = p->pAig->nDeleted;
+    p->nNodesChanges = p->pAig->nChanges;
+    return p->vNodes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates all internal nodes in the given timeframe.]
+
+  Description [Iterates through the compact node array instead of visiting 
+  the nodes and their fanins.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Ssw_SmlSimulateNodes( Ssw_Sml_t * p, Vec_Int_t * vNodes, int iFrame )
+{
+    unsigned * pSims, * pSims0, * pSims1;
+    int * pNode, * pStop;
+    assert( iFrame < p->nFrames );
+    assert( iFrame == 0 || p->nWordsFrame < p->nWordsTotal );
+    assert( Vec_IntSize(vNodes) == 3 * Aig_ManNodeNum(p->pAig) );
+    pStop = Vec_IntLimit( vNodes );
+    for ( pNode = Vec_IntArray(vNodes); pNode < pStop; pNode += 3 )
+    {
+        pSims  = Ssw_ObjSim(p, Abc_Lit2Var(pNode[0])) + p->nWordsFrame * iFrame;
+        pSims0 = Ssw_ObjSim(p, Abc_Lit2Var(pNode[1])) + p->nWordsFrame * iFrame;
+        pSims1 = Ssw_ObjSim(p, Abc_Lit2Var(pNode[2])) + p->nWordsFrame * iFrame;
+        Ssw_SmlSimulateAnd( pSims, pSims0, pSims1, Abc_LitIsCompl(pNode[0]), Abc_LitIsCompl(pNode[1]), Abc_LitIsCompl(pNode[2]), p->nWordsFrame );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Simulates one node.]
@@ -1005,14 +1081,15 @@ int Ssw_SmlCheckNonConstOutputs( Ssw_Sml_t * p )
 void Ssw_SmlSimulateOne( Ssw_Sml_t * p )
 {
     Aig_Obj_t * pObj, * pObjLi, * pObjLo;
+    Vec_Int_t * vNodes;
     int f, i;
     abctime clk;
 clk = Abc_Clock();
+    vNodes = Ssw_SmlCompactNodes( p );
     for ( f = 0; f < p->nFrames; f++ )
     {
         // simulate the nodes
-        Aig_ManForEachNode( p->pAig, pObj, i )
-            Ssw_SmlNodeSimulate( p, pObj, f );
+        Ssw_SmlSimulateNodes( p, vNodes, f );
         // copy simulation info into outputs
         Saig_ManForEachPo( p->pAig, pObj, i )
             Ssw_SmlNodeCopyFanin( p, pObj, f );
@@ -1117,12 +1194,13 @@ void Ssw_SmlSimulateOneDyn_rec( Ssw_Sml_t * p, Aig_Obj_t * pObj, int f, int * pV
 void Ssw_SmlSimulateOneFrame( Ssw_Sml_t * p )
 {
     Aig_Obj_t * pObj, * pObjLi, * pObjLo;
+    Vec_Int_t * vNodes;
     int i;
     abctime clk;
 clk = Abc_Clock();
     // simulate the nodes
-    Aig_ManForEachNode( p->pAig, pObj, i )
-        Ssw_SmlNodeSimulate( p, pObj, 0 );
+    vNodes = Ssw_SmlCompactNodes( p );
+    Ssw_SmlSimulateNodes( p, vNodes, 0 );
     // copy simulation info into outputs
     Saig_ManForEachLi( p->pAig, pObj, i )
         Ssw_SmlNodeCopyFanin( p, pObj, 0 );
@@ -1210,6 +1288,7 @@ Vec_Ptr_t * Ssw_SmlSimDataPointers( Ssw_Sml_t * p )
 ***********************************************************************/
 void Ssw_SmlStop( Ssw_Sml_t * p )
 {
+    Vec_IntFreeP( &p->vNodes );
     ABC_FREE( p );
 }
 
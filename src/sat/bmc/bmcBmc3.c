@@ -25,6 +25,7 @@
 #include "sat/glucose/AbcGlucose.h"
 #include "misc/vec/vecHsh.h"
 #include "misc/vec/vecWec.h"
+#include "misc/util/utilPool.h"
 #include "bmc.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -1344,6 +1345,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nPisAbstract   =     0;    // the number of PIs to abstract
     p->fSolveAll      =     0;    // stops on the first SAT instance
     p->fDropSatOuts   =     0;    // replace sat outputs by constant 0
+    p->nProcs         =     1;    // the number of threads
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
     p->nLearnedPerce  =    80;    // ratio of learned clause limit
@@ -1447,6 +1449,298 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Partitions the outputs by the overlap of their supports.]
+
+  Description [Each output, in the decreasing order of support sizes, 
+  goes to the partition whose support grows the least, which keeps 
+  together the outputs sharing logic while balancing the partitions. 
+  The supports are structural supports in terms of PIs and flops.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Saig_ManBmcPartition( Aig_Man_t * pAig, int nParts )
+{
+    Vec_Wec_t * vParts;
+    Vec_Ptr_t * vSupps, * vPoSupps;
+    Vec_Int_t * vSupp, * vCosts, * vSizes;
+    Vec_Bit_t * vMarks;
+    int nCis = Aig_ManCiNum(pAig);
+    int i, k, j, iOut, iCi, iBest, Cost, CostBest, * pOrder;
+    // collect supports of the POs (this clears the CI/CO numbers)
+    vSupps = Aig_ManSupports( pAig );
+    Aig_ManSetCioIds( pAig );
+    vPoSupps = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    Vec_PtrForEachEntry( Vec_Int_t *, vSupps, vSupp, i )
+    {
+        iOut = Vec_IntPop( vSupp );
+        if ( iOut < Saig_ManPoNum(pAig) )
+            Vec_PtrWriteEntry( vPoSupps, iOut, vSupp );
+    }
+    vCosts = Vec_IntAlloc( Saig_ManPoNum(pAig) );
+    Vec_PtrForEachEntry( Vec_Int_t *, vPoSupps, vSupp, i )
+        Vec_IntPush( vCosts, Vec_IntSize(vSupp) );
+    pOrder = Abc_QuickSortCost( Vec_IntArray(vCosts), Vec_IntSize(vCosts), 1 );
+    // assign the outputs
+    vParts = Vec_WecStart( nParts );
+    vSizes = Vec_IntStart( nParts );
+    vMarks = Vec_BitStart( nParts * nCis );
+    for ( i = 0; i < Saig_ManPoNum(pAig); i++ )
+    {
+        iOut  = pOrder[i];
+        vSupp = (Vec_Int_t *)Vec_PtrEntry( vPoSupps, iOut );
+        iBest = -1;  CostBest = ABC_INFINITY;
+        for ( k = 0; k < nParts; k++ )
+        {
+            Cost = Vec_IntEntry( vSizes, k );
+            Vec_IntForEachEntry( vSupp, iCi, j )
+                Cost += !Vec_BitEntry( vMarks, k * nCis + iCi );
+            if ( CostBest > Cost || (CostBest == Cost && Vec_IntSize(Vec_WecEntry(vParts, k)) < Vec_IntSize(Vec_WecEntry(vParts, iBest))) )
+                CostBest = Cost, iBest = k;
+        }
+        Vec_IntForEachEntry( vSupp, iCi, j )
+            if ( !Vec_BitEntry( vMarks, iBest * nCis + iCi ) )
+            {
+                Vec_BitWriteEntry( vMarks, iBest * nCis + iCi, 1 );
+                Vec_IntAddToEntry( vSizes, iBest, 1 );
+            }
+        Vec_WecPush( vParts, iBest, iOut );
+    }
+    Vec_WecForEachLevel( vParts, vSupp, i )
+        Vec_IntSort( vSupp, 0 );
+    Vec_WecRemoveEmpty( vParts );
+    // cleanup
+    ABC_FREE( pOrder );
+    Vec_BitFree( vMarks );
+    Vec_IntFree( vSizes );
+    Vec_IntFree( vCosts );
+    Vec_PtrFree( vPoSupps );
+    Vec_VecFree( (Vec_Vec_t *)vSupps );
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the sequential cones of the given outputs.]
+
+  Description [Keeps all primary inputs in the original order, so that 
+  the counter-examples of the partition are valid for the original AIG 
+  up to the number of flops.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_ManBmcDupOutputs_rec( Aig_Man_t * p, Aig_Obj_t * pObj, Vec_Ptr_t * vNodes, Vec_Ptr_t * vRoots )
+{
+    if ( Aig_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(p, pObj);
+    if ( Aig_ObjIsNode(pObj) )
+    {
+        Saig_ManBmcDupOutputs_rec( p, Aig_ObjFanin0(pObj), vNodes, vRoots );
+        Saig_ManBmcDupOutputs_rec( p, Aig_ObjFanin1(pObj), vNodes, vRoots );
+        Vec_PtrPush( vNodes, pObj );
+    }
+    else if ( Aig_ObjIsCo(pObj) )
+        Saig_ManBmcDupOutputs_rec( p, Aig_ObjFanin0(pObj), vNodes, vRoots );
+    else if ( Saig_ObjIsLo(p, pObj) )
+        Vec_PtrPush( vRoots, Saig_ObjLoToLi(p, pObj) );
+}
+Aig_Man_t * Saig_ManBmcDupOutputs( Aig_Man_t * pAig, Vec_Int_t * vOuts )
+{
+    Aig_Man_t * pNew;
+    Vec_Ptr_t * vNodes, * vRoots;
+    Aig_Obj_t * pObj;
+    int i, iOut;
+    vNodes = Vec_PtrAlloc( 100 );
+    vRoots = Vec_PtrAlloc( 100 );
+    Vec_IntForEachEntry( vOuts, iOut, i )
+        Vec_PtrPush( vRoots, Aig_ManCo(pAig, iOut) );
+    // collect the cones; the flops are appended to the roots
+    Aig_ManIncrementTravId( pAig );
+    Aig_ObjSetTravIdCurrent( pAig, Aig_ManConst1(pAig) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vRoots, pObj, i )
+        Saig_ManBmcDupOutputs_rec( pAig, pObj, vNodes, vRoots );
+    // create the new manager
+    pNew = Aig_ManStart( Vec_PtrSize(vNodes) );
+    pNew->pName = Abc_UtilStrsav( pAig->pName );
+    Aig_ManConst1(pAig)->pData = Aig_ManConst1( pNew );
+    Saig_ManForEachPi( pAig, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pNew );
+    Vec_PtrForEachEntryStart( Aig_Obj_t *, vRoots, pObj, i, Vec_IntSize(vOuts) )
+        Saig_ObjLiToLo(pAig, pObj)->pData = Aig_ObjCreateCi( pNew );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vRoots, pObj, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(pObj) );
+    Aig_ManSetRegNum( pNew, Vec_PtrSize(vRoots) - Vec_IntSize(vOuts) );
+    Vec_PtrFree( vNodes );
+    Vec_PtrFree( vRoots );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bounded model checking with the outputs partitioned across threads.]
+
+  Description [The outputs are partitioned by the overlap of their cones 
+  and each partition is unrolled and solved by a separate instance of the 
+  engine in the thread pool. When one output is SAT and all outputs are 
+  not being solved, the remaining partitions are cancelled.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Saig_BmcPart_t_ Saig_BmcPart_t;
+struct Saig_BmcPart_t_
+{
+    Aig_Man_t *     pAig;       // the cones of the outputs
+    Vec_Int_t *     vOuts;      // the outputs in the original AIG
+    Saig_ParBmc_t   Pars;       // the parameters of this partition
+    int             RetValue;   // the result of BMC
+    abctime         clkTotal;   // the runtime of BMC
+};
+static int Saig_ManBmcPartStop( int RunId )
+{
+    return Util_TaskIsCancelled( Util_TaskCurrent() );
+}
+int Saig_ManBmcPartTask( void * pArg )
+{
+    Saig_BmcPart_t * pPart = (Saig_BmcPart_t *)pArg;
+    abctime clk = Abc_Clock();
+    pPart->RetValue = Saig_ManBmcScalable( pPart->pAig, &pPart->Pars );
+    pPart->clkTotal = Abc_Clock() - clk;
+    return pPart->RetValue;
+}
+int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Util_Pool_t * pPool;
+    Util_Task_t ** ppTasks;
+    Saig_BmcPart_t * pParts, * pPart;
+    Vec_Wec_t * vParts;
+    Vec_Ptr_t * vCexes = NULL;
+    Vec_Int_t * vOuts;
+    Abc_Cex_t * pCex;
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
+    int i, k, iOut, nParts, nProved = 0, nFailOuts = 0, iFrameMin = ABC_INFINITY, iFrameMax = -1, RetValue = -1;
+    vParts = Saig_ManBmcPartition( pAig, Abc_MinInt(pPars->nProcs, Saig_ManPoNum(pAig)) );
+    nParts = Vec_WecSize( vParts );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Running \"bmc3\" with %d threads. PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d.\n", 
+            nParts, Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig), Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig) );
+        Abc_Print( 1, "Params: FramesMax = %d. Start = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d.\n", 
+            pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll );
+    }
+    // start the partitions
+    pPool   = Util_PoolGlobal( nParts );
+    ppTasks = ABC_CALLOC( Util_Task_t *, nParts );
+    pParts  = ABC_CALLOC( Saig_BmcPart_t, nParts );
+    Vec_WecForEachLevel( vParts, vOuts, i )
+    {
+        pPart = pParts + i;
+        pPart->pAig  = Saig_ManBmcDupOutputs( pAig, vOuts );
+        pPart->vOuts = vOuts;
+        pPart->Pars  = *pPars;
+        pPart->Pars.nProcs      = 1;
+        pPart->Pars.fStoreCex   = 1;
+        pPart->Pars.fVerbose    = 0;
+        pPart->Pars.fNotVerbose = 1;
+        pPart->Pars.fSilent     = 1;
+        pPart->Pars.pFuncStop   = Saig_ManBmcPartStop;
+        pPart->RetValue = -1;
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Part %3d : PO =%6d. Reg =%7d. And =%8d.\n", i, 
+                Saig_ManPoNum(pPart->pAig), Saig_ManRegNum(pPart->pAig), Aig_ManNodeNum(pPart->pAig) );
+        ppTasks[i] = Util_PoolSubmit( pPool, Saig_ManBmcPartTask, pPart );
+    }
+    // collect the results as the partitions are finished
+    while ( (i = Util_TaskWaitAny( ppTasks, nParts )) != -1 )
+    {
+        Util_TaskFree( ppTasks[i] );
+        ppTasks[i] = NULL;
+        pPart = pParts + i;
+        pPars->nFailOuts += pPart->Pars.nFailOuts;
+        pPars->nDropOuts += pPart->Pars.nDropOuts;
+        if ( pPart->RetValue == 1 )
+            nProved++;
+        else if ( pPart->Pars.nFailOuts < Vec_IntSize(pPart->vOuts) )
+            iFrameMin = Abc_MinInt( iFrameMin, pPart->Pars.iFrame );
+        iFrameMax = Abc_MaxInt( iFrameMax, pPart->Pars.iFrame );
+        // remap the counter-examples
+        if ( pPart->RetValue == 0 && !pPars->fSolveAll && RetValue == -1 )
+        {
+            pCex = pPart->pAig->pSeqModel;
+            ABC_FREE( pAig->pSeqModel );
+            pAig->pSeqModel = Abc_CexDup( pCex, Saig_ManRegNum(pAig) );
+            pAig->pSeqModel->iPo = Vec_IntEntry( pPart->vOuts, pCex->iPo );
+            RetValue = 0;
+            for ( k = 0; k < nParts; k++ )
+                if ( ppTasks[k] )
+                    Util_TaskCancel( ppTasks[k] );
+        }
+        // record the failed outputs of this partition in the original numbering
+        if ( pPars->fSolveAll && pPart->pAig->vSeqModelVec )
+        {
+            Vec_PtrForEachEntry( Abc_Cex_t *, pPart->pAig->vSeqModelVec, pCex, k )
+            {
+                if ( pCex == NULL )
+                    continue;
+                iOut = Vec_IntEntry( pPart->vOuts, k );
+                nFailOuts++;
+                if ( !pPars->fNotVerbose )
+                    Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
+                        nOutDigits, iOut, pCex->iFrame, nOutDigits, nFailOuts, nOutDigits, Saig_ManPoNum(pAig) );
+                if ( vCexes == NULL )
+                    vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+                assert( Vec_PtrEntry(vCexes, iOut) == NULL );
+                if ( pPars->fStoreCex )
+                {
+                    Vec_PtrWriteEntry( vCexes, iOut, Abc_CexDup(pCex, Saig_ManRegNum(pAig)) );
+                    ((Abc_Cex_t *)Vec_PtrEntry(vCexes, iOut))->iPo = iOut;
+                }
+                else
+                    Vec_PtrWriteEntry( vCexes, iOut, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+            }
+            if ( pPart->Pars.nFailOuts )
+                RetValue = 0;
+        }
+        if ( pPars->fVerbose )
+        {
+            Abc_Print( 1, "Part %3d : PO =%6d. Frames =%6d. CEX =%6d. ", i, Vec_IntSize(pPart->vOuts), pPart->Pars.iFrame+1, pPart->Pars.nFailOuts );
+            if ( pPars->nTimeOutOne )
+                Abc_Print( 1, "T/O =%4d. ", pPart->Pars.nDropOuts );
+            Abc_Print( 1, "%s  ", pPart->RetValue == 1 ? "proved   " : (pPart->RetValue == 0 ? "asserted " : "undecided") );
+            Abc_PrintTime( 1, "Time", pPart->clkTotal );
+        }
+        Vec_PtrFreeFree( pPart->pAig->vSeqModelVec );
+        pPart->pAig->vSeqModelVec = NULL;
+        Aig_ManStop( pPart->pAig );
+        pPart->pAig = NULL;
+    }
+    if ( RetValue == -1 && nProved == nParts )
+        RetValue = 1;
+    // all outputs are explored at least up to this frame
+    pPars->iFrame = iFrameMin < ABC_INFINITY ? iFrameMin : iFrameMax;
+    if ( vCexes )
+    {
+        assert( pAig->vSeqModelVec == NULL );
+        pAig->vSeqModelVec = vCexes;
+    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( pParts );
+    Vec_WecFree( vParts );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1471,6 +1765,9 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
+    if ( pPars->nProcs > 1 && Saig_ManPoNum(pAig) > 1 && Saig_ManConstrNum(pAig) == 0 && !pPars->fUseBridge && 
+         !pPars->pLogFileName && !pPars->pFuncOnFail && !pPars->pFuncStop )
+        return Saig_ManBmcScalablePar( pAig, pPars );
     if ( pPars->pLogFileName )
         pLogFile = fopen( pPars->pLogFileName, "wb" );
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
@@ -1531,7 +1828,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC after exploring all reachable states
         if ( !pPars->nFramesJump && Aig_ManRegNum(pAig) < 30 && f == (1 << Aig_ManRegNum(pAig)) )
         {
-            Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
             if ( p->pPars->fUseBridge )
                 Saig_ManForEachPo( pAig, pObj, i )
                     if ( !(p->vCexes && Vec_PtrEntry(p->vCexes, i)) && !(p->pTime4Outs && p->pTime4Outs[i] == 0) ) // not SAT and not timed out
@@ -1542,7 +1840,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         // stop BMC if all targets are solved
         if ( pPars->fSolveAll && pPars->nFailOuts + pPars->nDropOuts >= Saig_ManPoNum(pAig) )
         {
-            Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
             RetValue = pPars->nFailOuts ? 0 : 1;
             goto finish;
         }
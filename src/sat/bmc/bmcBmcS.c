@@ -21,6 +21,7 @@
 #include "bmc.h"
 #include "sat/cnf/cnf.h"
 #include "sat/satoko/satoko.h"
+#include "misc/util/utilPool.h"
 
 
 //#define ABC_USE_EXT_SOLVERS 1
@@ -45,27 +46,12 @@
 #endif
 
 
-
-#ifdef ABC_USE_PTHREADS
-
-#ifdef _WIN32
-    #include "../lib/pthread.h"
-#else
-    #include <pthread.h>
-    #include <unistd.h>
-#endif
-
-#endif
-
-
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-#define PAR_THR_MAX 100
-
 typedef struct Bmcs_Man_t_ Bmcs_Man_t;
 struct Bmcs_Man_t_
 {
@@ -76,7 +62,7 @@ struct Bmcs_Man_t_
     Vec_Ptr_t         vGia2Fr;             // copies of GIA in each timeframe
     Vec_Int_t         vFr2Sat;             // mapping of objects in pFrames into SAT variables
     Vec_Int_t         vCiMap;              // maps CIs of pFrames into CIs/frames of GIA
-    bmc_sat_solver *  pSats[PAR_THR_MAX];  // concurrent SAT solvers
+    bmc_sat_solver ** pSats;               // concurrent SAT solvers
     int               nSatVars;            // number of SAT variables used
     int               nSatVarsOld;         // number of SAT variables used
     int               fStopNow;            // signal when it is time to stop
@@ -381,6 +367,7 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
     Vec_IntGrow( &p->vFr2Sat, 3*Gia_ManCiNum(pGia) );  
     Vec_IntPush( &p->vFr2Sat, 0 );
     Vec_IntGrow( &p->vCiMap, 3*Gia_ManCiNum(pGia) );
+    p->pSats   = ABC_CALLOC( bmc_sat_solver *, pPars->nProcs );
     for ( i = 0; i < pPars->nProcs; i++ )
     {
         // modify parameters to get different SAT solvers
@@ -413,6 +400,7 @@ void Bmcs_ManStop( Bmcs_Man_t * p )
     for ( i = 0; i < p->pPars->nProcs; i++ )
         if ( p->pSats[i] ) 
             bmc_sat_solver_stop( p->pSats[i] );
+    ABC_FREE( p->pSats );
     ABC_FREE( p );
 }
 
@@ -735,74 +723,42 @@ typedef struct Par_ThData_t_
     bmc_sat_solver *  pSat;
     int         iLit;
     int         iThread;
-    int         fWorking;
     int         status;
 } Par_ThData_t;
 
-void * Bmcs_ManWorkerThread( void * pArg )
+int Bmcs_ManWorkerTask( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
-    volatile int * pPlace = &pThData->fWorking;
-    while ( 1 )
-    {
-        while ( *pPlace == 0 );
-        assert( pThData->fWorking );
-        if ( pThData->pSat == NULL )
-        {
-	        pthread_exit( NULL );
-            assert( 0 );
-            return NULL;
-        }
-
-        pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
-
-        //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
-
-        pThData->fWorking = 0;
-    }
-	assert( 0 );
-	return NULL;
+    pThData->status = bmc_sat_solver_solve( pThData->pSat, &pThData->iLit, 1 );
+    //printf( "Thread %d finished with status %d\n", pThData->iThread, pThData->status );
+    return pThData->status;
 }
 
-int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, Par_ThData_t * ThData, int nProcs, int * pSolver )
+int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, Util_Pool_t * pPool, Util_Task_t ** ppTasks, Par_ThData_t * ThData, int nProcs, int * pSolver )
 {
-    int i, status = -1;
-    // set new problem
-    for ( i = 0; i < nProcs; i++ )
-    {
-        ThData[i].iLit = iLit;
-        assert( ThData[i].fWorking == 0 );
-    }
+    int i, status;
     // start solvers on a new problem
     for ( i = 0; i < nProcs; i++ )
-        ThData[i].fWorking = 1;
-    // check if any of the solvers finished
-    while ( i == nProcs )
     {
-        for ( i = 0; i < nProcs; i++ )
-        {
-            if ( ThData[i].fWorking )
-                continue;
-            // set stop request
-            p->fStopNow = 1;
-            // remember status
-            status = ThData[i].status;
-            //printf( "Solver %d returned status %d.\n", i, status );
-            *pSolver = i;
-            break;
-        }
-    }
-    // wait till threads finish
-    while ( i < nProcs )
-    {
-        for ( i = 0; i < nProcs; i++ )
-            if ( ThData[i].fWorking )
-                break;
+        assert( ppTasks[i] == NULL );
+        ThData[i].iLit = iLit;
+        ppTasks[i] = Util_PoolSubmit( pPool, Bmcs_ManWorkerTask, ThData + i );
     }
+    // wait till one of the solvers finishes
+    i = Util_TaskWaitAny( ppTasks, nProcs );
+    assert( i >= 0 && i < nProcs );
+    status = ThData[i].status;
+    //printf( "Solver %d returned status %d.\n", i, status );
+    *pSolver = i;
+    // stop the other solvers (the ones not started yet are skipped)
+    p->fStopNow = 1;
     for ( i = 0; i < nProcs; i++ )
     {
+        Util_TaskCancel( ppTasks[i] );
+        Util_TaskWait( ppTasks[i] );
+        Util_TaskFree( ppTasks[i] );
+        ppTasks[i] = NULL;
         ThData[i].iLit = -1;
-        assert( ThData[i].fWorking == 0 );
     }
     // reset stop request
     p->fStopNow = 0;
@@ -812,20 +768,19 @@ int Bmcs_ManPerform_Solve( Bmcs_Man_t * p, int iLit, pthread_t * WorkerThread, P
 int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 {
     abctime clkStart = Abc_Clock();
-	pthread_t WorkerThread[PAR_THR_MAX];
-    Par_ThData_t ThData[PAR_THR_MAX];
+    Util_Pool_t * pPool = Util_PoolGlobal( pPars->nProcs );
+    Util_Task_t ** ppTasks = ABC_CALLOC( Util_Task_t *, pPars->nProcs );
+    Par_ThData_t * ThData = ABC_CALLOC( Par_ThData_t, pPars->nProcs );
     Bmcs_Man_t * p = Bmcs_ManStart( pGia, pPars );
     int f, k = 0, i = Gia_ManPoNum(pGia), status, RetValue = -1, nClauses = 0, Solver = 0;
     Abc_CexFreeP( &pGia->pCexSeq );
-    // start threads
+    // prepare the tasks
     for ( i = 0; i < pPars->nProcs; i++ )
     {
         ThData[i].pSat     = p->pSats[i];
         ThData[i].iLit     = -1;
         ThData[i].iThread  =  i;
-        ThData[i].fWorking =  0;
         ThData[i].status   = -1;
-        status = pthread_create( WorkerThread + i, NULL, Bmcs_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
     }
     // solve properties in each timeframe
     for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f += pPars->nFramesAdd )
@@ -857,7 +812,7 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
                 int iLit = Abc_Var2Lit( Vec_IntEntry(&p->vFr2Sat, iObj), 0 );
                 if ( pPars->nTimeOut && (Abc_Clock() - clkStart)/CLOCKS_PER_SEC >= pPars->nTimeOut )
                     break;
-                status = Bmcs_ManPerform_Solve( p, iLit, WorkerThread, ThData, pPars->nProcs, &Solver );
+                status = Bmcs_ManPerform_Solve( p, iLit, pPool, ppTasks, ThData, pPars->nProcs, &Solver );
                 p->timeSat += Abc_Clock() - clk;
                 if ( status == l_False ) // unsat
                 {
@@ -892,13 +847,8 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         if ( k < pPars->nFramesAdd )
             break;
     }
-    // stop threads
-    for ( i = 0; i < pPars->nProcs; i++ )
-    {
-        assert( !ThData[i].fWorking );
-        ThData[i].pSat = NULL;
-        ThData[i].fWorking = 1;
-    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( ThData );
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if ( RetValue == -1 && !pPars->fNotVerbose )
         printf( "No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k+1 : 0) );
@@ -924,7 +874,6 @@ int Bmcs_ManPerformMulti( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
 ***********************************************************************/
 int Bmcs_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars ) 
 { 
-    assert( pPars->nProcs < PAR_THR_MAX );
     if ( pPars->nProcs == 1 )
         return Bmcs_ManPerformOne( pGia, pPars );
     else
@@ -179,10 +179,10 @@ void Bmc_ComputeSimTest( Gia_Man_t * p )
 }
 
 
-static abctime clkCheck1 = 0;
-static abctime clkCheck2 = 0;
-static abctime clkCheckS = 0;
-static abctime clkCheckU = 0;
+static ABC_THREAD_LOCAL abctime clkCheck1 = 0;
+static ABC_THREAD_LOCAL abctime clkCheck2 = 0;
+static ABC_THREAD_LOCAL abctime clkCheckS = 0;
+static ABC_THREAD_LOCAL abctime clkCheckU = 0;
 
 // iterator thought the cubes
 #define Bmc_SopForEachCube( pSop, nVars, pCube )  for ( pCube = (pSop); *pCube; pCube += (nVars) + 3 )
@@ -184,7 +184,7 @@ static inline int Maj_ManFindFanin( Maj_Man_t * p, int i, int k )
 }
 static inline int Maj_ManEval( Maj_Man_t * p )
 {
-    static int Flag = 0;
+    static ABC_THREAD_LOCAL int Flag = 0;
     int i, k, iMint; word * pFanins[3];
     for ( i = p->nVars + 2; i < p->nObjs; i++ )
     {
@@ -508,7 +508,7 @@ static inline int Exa_ManFindFanin( Exa_Man_t * p, int i, int k )
 }
 static inline int Exa_ManEval( Exa_Man_t * p )
 {
-    static int Flag = 0;
+    static ABC_THREAD_LOCAL int Flag = 0;
     int i, k, iMint; word * pFanins[2];
     for ( i = p->nVars; i < p->nObjs; i++ )
     {
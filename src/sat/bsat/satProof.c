@@ -315,7 +315,7 @@ void Sat_ProofReduce2( sat_solver2 * s )
     satset * pNode, * pFanin, * pPivot;
     int i, k, hTemp;
     abctime clk = Abc_Clock();
-    static abctime TimeTotal = 0;
+    static ABC_THREAD_LOCAL abctime TimeTotal = 0;
 
     // collect visited nodes
     vUsed = Proof_CollectUsedIter( vProof, vRoots, 1 );
@@ -391,7 +391,7 @@ int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot )
     satset * pNode, * pFanin, * pPivot;
     int i, j, k, hTemp, nSize;
     abctime clk = Abc_Clock();
-    static abctime TimeTotal = 0;
+    static ABC_THREAD_LOCAL abctime TimeTotal = 0;
     int RetValue;
 //Sat_ProofCheck0( vProof );
 
@@ -317,7 +317,7 @@ static inline void act_var_rescale(sat_solver2* s)  {
     s->var_inc *= 1e-100;
 }
 static inline void act_clause2_rescale(sat_solver2* s) {
-    static abctime Total = 0;
+    static ABC_THREAD_LOCAL abctime Total = 0;
     float * act_clas = (float *)veci_begin(&s->act_clas);
     int i;
     abctime clk = Abc_Clock();
@@ -1405,7 +1405,7 @@ void luby2_test()
 // updates clauses, watches, units, and proof
 void sat_solver2_reducedb(sat_solver2* s)
 {
-    static abctime TimeTotal = 0;
+    static ABC_THREAD_LOCAL abctime TimeTotal = 0;
     Sat_Mem_t * pMem = &s->Mem;
     clause * c = NULL;
     int nLearnedOld = veci_size(&s->act_clas);
@@ -1414,7 +1414,7 @@ void sat_solver2_reducedb(sat_solver2* s)
     int i, j, k, Id, nSelected;//, LastSize = 0;
     int Counter, CounterStart;
     abctime clk = Abc_Clock();
-    static int Count = 0;
+    static ABC_THREAD_LOCAL int Count = 0;
     Count++;
     assert( s->nLearntMax );
     s->nDBreduces++;
@@ -1587,7 +1587,7 @@ void sat_solver2_rollback( sat_solver2* s )
 {
     Sat_Mem_t * pMem = &s->Mem;
     int i, k, j;
-    static int Count = 0;
+    static ABC_THREAD_LOCAL int Count = 0;
     Count++;
     assert( s->iVarPivot >= 0 && s->iVarPivot <= s->size );
     assert( s->iTrailPivot >= 0 && s->iTrailPivot <= s->qtail );
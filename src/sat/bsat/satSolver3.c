@@ -1485,7 +1485,7 @@ int sat_solver3_simplify(sat_solver3* s)
 
 void sat_solver3_reducedb(sat_solver3* s)
 {
-    static abctime TimeTotal = 0;
+    static ABC_THREAD_LOCAL abctime TimeTotal = 0;
     abctime clk = Abc_Clock();
     Sat_Mem_t * pMem = &s->Mem;
     int nLearnedOld = veci_size(&s->act_clas);
@@ -1607,7 +1607,7 @@ void sat_solver3_rollback( sat_solver3* s )
 {
     Sat_Mem_t * pMem = &s->Mem;
     int i, k, j;
-    static int Count = 0;
+    static ABC_THREAD_LOCAL int Count = 0;
     Count++;
     assert( s->iVarPivot >= 0 && s->iVarPivot <= s->size );
     assert( s->iTrailPivot >= 0 && s->iTrailPivot <= s->qtail );
@@ -88,6 +88,7 @@ struct Cnf_Man_t_
     int             nMergeLimit;     // the limit on the size of merged cut
     unsigned *      pTruths[4];      // temporary truth tables
     Vec_Int_t *     vMemory;         // memory for intermediate ISOP representation
+    int             nProcs;          // the number of threads
     abctime         timeCuts; 
     abctime         timeMap;
     abctime         timeSave;
@@ -133,6 +134,7 @@ extern Cnf_Dat_t *     Cnf_DeriveOther( Aig_Man_t * pAig, int fSkipTtMin );
 extern Cnf_Dat_t *     Cnf_DeriveOtherWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTtMin );
 extern void            Cnf_ManPrepare();
 extern Cnf_Man_t *     Cnf_ManRead();
+extern int             Cnf_ManProcNum();
 extern void            Cnf_ManFree();
 /*=== cnfCut.c ========================================================*/
 extern Cnf_Cut_t *     Cnf_CutCreate( Cnf_Man_t * p, Aig_Obj_t * pObj );
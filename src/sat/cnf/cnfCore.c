@@ -19,6 +19,8 @@
 ***********************************************************************/
 
 #include "cnf.h"
+#include "base/main/main.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,7 +29,7 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Cnf_Man_t * s_pManCnf = NULL;
+static ABC_THREAD_LOCAL Cnf_Man_t * s_pManCnf = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -49,6 +51,8 @@ void Cnf_ManPrepare()
     {
 //        printf( "\n\nCreating CNF manager!!!!!\n\n" );
         s_pManCnf = Cnf_ManStart();
+        // the manager of a pool worker is freed when the worker exits
+        Util_PoolThreadAtExit( Cnf_ManFree );
     }
 }
 Cnf_Man_t * Cnf_ManRead()
@@ -63,6 +67,23 @@ void Cnf_ManFree()
     s_pManCnf = NULL;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of threads used to derive CNF.]
+
+  Description [The number is set by the command "set cnfprocs <num>".]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_ManProcNum()
+{
+    char * pFlag = Abc_FrameReadFlag( "cnfprocs" );
+    return pFlag ? Abc_MaxInt( 1, atoi(pFlag) ) : 1;
+}
+
 
 /**Function*************************************************************
 
@@ -85,10 +106,11 @@ Vec_Int_t * Cnf_DeriveMappingArray( Aig_Man_t * pAig )
     // allocate the CNF manager
     p = Cnf_ManStart();
     p->pManAig = pAig;
+    p->nProcs = Cnf_ManProcNum();
 
     // generate cuts for all nodes, assign cost, and find best cuts
 clk = Abc_Clock();
-    pMemCuts = Dar_ManComputeCuts( pAig, 10, 0, 0 );
+    pMemCuts = Dar_ManComputeCutsPar( pAig, 10, 0, p->nProcs, 0 );
 p->timeCuts = Abc_Clock() - clk;
 
     // find the mapping
@@ -134,10 +156,11 @@ Cnf_Dat_t * Cnf_DeriveWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int nOutputs )
     abctime clk;
     // connect the managers
     p->pManAig = pAig;
+    p->nProcs = Cnf_ManProcNum();
 
     // generate cuts for all nodes, assign cost, and find best cuts
 clk = Abc_Clock();
-    pMemCuts = Dar_ManComputeCuts( pAig, 10, 0, 0 );
+    pMemCuts = Dar_ManComputeCutsPar( pAig, 10, 0, p->nProcs, 0 );
 p->timeCuts = Abc_Clock() - clk;
 
     // find the mapping
@@ -187,10 +210,11 @@ Cnf_Dat_t * Cnf_DeriveOtherWithMan( Cnf_Man_t * p, Aig_Man_t * pAig, int fSkipTt
     abctime clk;
     // connect the managers
     p->pManAig = pAig;
+    p->nProcs = Cnf_ManProcNum();
 
     // generate cuts for all nodes, assign cost, and find best cuts
 clk = Abc_Clock();
-    pMemCuts = Dar_ManComputeCuts( pAig, 10, fSkipTtMin, 0 );
+    pMemCuts = Dar_ManComputeCutsPar( pAig, 10, fSkipTtMin, p->nProcs, 0 );
 p->timeCuts = Abc_Clock() - clk;
 
     // find the mapping
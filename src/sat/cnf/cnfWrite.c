@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "cnf.h"
+#include "misc/util/utilPool.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,6 +28,20 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the smallest number of mapped nodes per thread
+#define CNF_THREAD_NODES_MIN  10000
+
+typedef struct Cnf_ThData_t_ Cnf_ThData_t;
+struct Cnf_ThData_t_
+{
+    Cnf_Man_t *      p;           // the CNF manager
+    Cnf_Dat_t *      pCnf;        // the CNF being written
+    Vec_Ptr_t *      vMapped;     // the mapped nodes
+    Vec_Int_t *      vStarts;     // the first clause and literal of each mapped node
+    int              iBeg;        // the first node of the thread
+    int              iEnd;        // the last node of the thread (exclusive)
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -183,6 +198,138 @@ int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals )
     return nLits;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of one mapped node.]
+
+  Description [Updates the pointers to the next free clause and literal.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cnf_ManWriteCnfNode( Cnf_Man_t * p, Cnf_Dat_t * pCnf, Aig_Obj_t * pObj, Vec_Int_t * vSopTemp, int *** ppClas, int ** ppLits )
+{
+    Cnf_Cut_t * pCut = Cnf_ObjBestCut( pObj );
+    Vec_Int_t * vCover;
+    int ** pClas = *ppClas, * pLits = *ppLits;
+    int OutVar, pVars[32], k, Cube;
+    unsigned uTruth;
+
+    // save variables of this cut
+    OutVar = pCnf->pVarNums[ pObj->Id ];
+    for ( k = 0; k < (int)pCut->nFanins; k++ )
+    {
+        pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
+        assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
+    }
+
+    // positive polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[1];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        *pClas++ = pLits;
+        *pLits++ = 2 * OutVar; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+    }
+
+    // negative polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
+        Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+        vCover = vSopTemp;
+    }
+    else
+        vCover = pCut->vIsop[0];
+    Vec_IntForEachEntry( vCover, Cube, k )
+    {
+        *pClas++ = pLits;
+        *pLits++ = 2 * OutVar + 1; 
+        pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+    }
+    *ppClas = pClas;
+    *ppLits = pLits;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of the nodes assigned to the thread.]
+
+  Description [The clauses are written directly into the clause array
+  at the positions determined by the counting pass.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cnf_ManWriteCnfWorker( void * pArg )
+{
+    Cnf_ThData_t * pThData = (Cnf_ThData_t *)pArg;
+    Vec_Int_t * vSopTemp = Vec_IntAlloc( 1 << 16 );
+    int ** pClas = pThData->pCnf->pClauses + Vec_IntEntry( pThData->vStarts, 2*pThData->iBeg );
+    int * pLits = pThData->pCnf->pClauses[0] + Vec_IntEntry( pThData->vStarts, 2*pThData->iBeg+1 );
+    int i;
+    for ( i = pThData->iBeg; i < pThData->iEnd; i++ )
+        Cnf_ManWriteCnfNode( pThData->p, pThData->pCnf, (Aig_Obj_t *)Vec_PtrEntry(pThData->vMapped, i), vSopTemp, &pClas, &pLits );
+    assert( pClas - pThData->pCnf->pClauses == Vec_IntEntry(pThData->vStarts, 2*pThData->iEnd) );
+    assert( pLits - pThData->pCnf->pClauses[0] == Vec_IntEntry(pThData->vStarts, 2*pThData->iEnd+1) );
+    Vec_IntFree( vSopTemp );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the clauses of the mapped nodes using several threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_ManWriteCnfNodes( Cnf_Man_t * p, Cnf_Dat_t * pCnf, Vec_Ptr_t * vMapped, Vec_Int_t * vStarts, int nThreads )
+{
+    Cnf_ThData_t * pThData = ABC_CALLOC( Cnf_ThData_t, nThreads );
+    Util_Task_t ** ppTasks = ABC_CALLOC( Util_Task_t *, nThreads );
+    Util_Pool_t * pPool = Util_PoolGlobal( nThreads - 1 );
+    int i, nNodes = Vec_PtrSize(vMapped);
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pThData[i].p       = p;
+        pThData[i].pCnf    = pCnf;
+        pThData[i].vMapped = vMapped;
+        pThData[i].vStarts = vStarts;
+        pThData[i].iBeg    = (int)((word)nNodes * i / nThreads);
+        pThData[i].iEnd    = (int)((word)nNodes * (i + 1) / nThreads);
+    }
+    // the calling thread writes the first share
+    for ( i = 1; i < nThreads; i++ )
+        ppTasks[i] = Util_PoolSubmit( pPool, Cnf_ManWriteCnfWorker, (void *)(pThData + i) );  
+    Cnf_ManWriteCnfWorker( pThData );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        Util_TaskWait( ppTasks[i] );
+        Util_TaskFree( ppTasks[i] );
+    }
+    ABC_FREE( ppTasks );
+    ABC_FREE( pThData );
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Derives CNF for the mapping.]
@@ -202,17 +349,28 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     Aig_Obj_t * pObj;
     Cnf_Dat_t * pCnf;
     Cnf_Cut_t * pCut;
-    Vec_Int_t * vCover, * vSopTemp;
-    int OutVar, PoVar, pVars[32], * pLits, ** pClas;
+    Vec_Int_t * vSopTemp, * vStarts = NULL;
+    int OutVar, PoVar, * pLits, ** pClas;
     unsigned uTruth;
-    int i, k, nLiterals, nClauses, Cube, Number;
+    int i, nLiterals, nClauses, nLiterals0, nClauses0, Number;
+    int nThreads = Abc_MinInt( p->nProcs, Vec_PtrSize(vMapped) / CNF_THREAD_NODES_MIN );
 
     // count the number of literals and clauses
-    nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
-    nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
+    nLiterals = nLiterals0 = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
+    nClauses = nClauses0 = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
+#ifdef ABC_USE_PTHREADS
+    // remember where the clauses of each node start
+    if ( nThreads > 1 )
+        vStarts = Vec_IntAlloc( 2 * Vec_PtrSize(vMapped) + 2 );
+#endif
     Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
     {
         assert( Aig_ObjIsNode(pObj) );
+        if ( vStarts )
+        {
+            Vec_IntPush( vStarts, nClauses - nClauses0 );
+            Vec_IntPush( vStarts, nLiterals - nLiterals0 );
+        }
         pCut = Cnf_ObjBestCut( pObj );
 
         // positive polarity of the cut
@@ -244,6 +402,11 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
 //printf( "%d ", nClauses-(1 + Aig_ManCoNum( p->pManAig )) );
     }
 //printf( "\n" );
+    if ( vStarts )
+    {
+        Vec_IntPush( vStarts, nClauses - nClauses0 );
+        Vec_IntPush( vStarts, nLiterals - nLiterals0 );
+    }
 
     // allocate CNF
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
@@ -318,54 +481,24 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     }
 
     // assign the clauses
-    vSopTemp = Vec_IntAlloc( 1 << 16 );
     pLits = pCnf->pClauses[0];
     pClas = pCnf->pClauses;
-    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+#ifdef ABC_USE_PTHREADS
+    if ( vStarts )
     {
-        pCut = Cnf_ObjBestCut( pObj );
-
-        // save variables of this cut
-        OutVar = pCnf->pVarNums[ pObj->Id ];
-        for ( k = 0; k < (int)pCut->nFanins; k++ )
-        {
-            pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
-            assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
-        }
-
-        // positive polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[1];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
-
-        // negative polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[0];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar + 1; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
+        Cnf_ManWriteCnfNodes( p, pCnf, vMapped, vStarts, nThreads );
+        pClas += Vec_IntEntry( vStarts, 2*Vec_PtrSize(vMapped) );
+        pLits += Vec_IntEntry( vStarts, 2*Vec_PtrSize(vMapped)+1 );
+        Vec_IntFree( vStarts );
+    }
+    else
+#endif
+    {
+        vSopTemp = Vec_IntAlloc( 1 << 16 );
+        Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+            Cnf_ManWriteCnfNode( p, pCnf, pObj, vSopTemp, &pClas, &pLits );
+        Vec_IntFree( vSopTemp );
     }
-    Vec_IntFree( vSopTemp );
  
     // write the constant literal
     OutVar = pCnf->pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
@@ -18,6 +18,8 @@
 
 ***********************************************************************/
 
+#include <atomic>
+
 #include "sat/glucose/System.h"
 #include "sat/glucose/ParseUtils.h"
 #include "sat/glucose/Options.h"
@@ -29,6 +31,8 @@
 #include "aig/gia/gia.h"
 #include "sat/cnf/cnf.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilPool.h"
+#include "base/main/main.h"
 
 using namespace Gluco;
 
@@ -42,12 +46,357 @@ extern "C" {
 
 #define USE_SIMP_SOLVER 1
 
+#define GLUCOSE_PORT_MAX   16          // the largest number of solvers in the portfolio
+#define GLUCOSE_SHARE_RING (1 << 16)   // the number of entries in the ring of each solver
+#define GLUCOSE_SHARE_SIZE 32          // the largest size of a shared clause
+
+// the stop flags are read and written by several threads
+#if defined(__GNUC__)
+#define GLUCOSE_FLAG_READ(p)      __atomic_load_n( p, __ATOMIC_RELAXED )
+#define GLUCOSE_FLAG_WRITE(p, v)  __atomic_store_n( p, v, __ATOMIC_RELAXED )
+#else
+#define GLUCOSE_FLAG_READ(p)      (*(volatile int *)(p))
+#define GLUCOSE_FLAG_WRITE(p, v)  (*(volatile int *)(p) = (v))
+#endif
+
+// portfolio of differently configured solvers exchanging short learned clauses;
+// each solver writes its clauses into its own ring, which is read by all others
+typedef struct Glucose_Port_t_ Glucose_Port_t;
+struct Glucose_Port_t_
+{
+    int                 nSolvers;       // the number of solvers
+    int                 nLbdMax;        // the largest LBD of a shared clause
+    SimpSolver *        pSolvers[GLUCOSE_PORT_MAX]; // solvers (the first one is returned to the user)
+    std::atomic<int> *  pRings[GLUCOSE_PORT_MAX];   // the clauses exported by each solver
+    std::atomic<word>   iHeads[GLUCOSE_PORT_MAX];   // the number of entries written into each ring
+    word                pCursors[GLUCOSE_PORT_MAX][GLUCOSE_PORT_MAX]; // the entries of ring j read by solver i
+    vec<Lit>            vAssumps;       // the assumptions of the current call
+    int                 pStatus[GLUCOSE_PORT_MAX];  // the results of the current call
+    std::atomic<int>    iWinner;        // the solver that finished first
+    int                 fStop;          // set when one of the solvers is done (accessed atomically)
+    int *               pStopUser;      // the stop flag given by the user
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 #ifdef USE_SIMP_SOLVER
-    
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of solvers in the portfolio.]
+
+  Description [Set by "set satprocs <num>". Similarly, "set satlbd <num>" 
+  gives the largest LBD of the learned clauses shared by the solvers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int glucose_port_proc_num()
+{
+    char * pFlag = Abc_FrameReadFlag( (char *)"satprocs" );
+    int nProcs = pFlag ? atoi(pFlag) : 1;
+    return Abc_MinInt( Abc_MaxInt(nProcs, 1), GLUCOSE_PORT_MAX );
+}
+int glucose_port_lbd_max()
+{
+    char * pFlag = Abc_FrameReadFlag( (char *)"satlbd" );
+    return pFlag ? Abc_MaxInt(atoi(pFlag), 1) : 4;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets up the heuristics of the solvers of the portfolio.]
+
+  Description [The first solver keeps the default setting.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void glucose_port_config( Gluco::SimpSolver * S, int iSolver )
+{
+    if ( iSolver == 0 )
+        return;
+    S->random_seed = 91648253 + 7919 * iSolver;
+    if ( iSolver % 4 == 1 )      // random polarities
+        S->rnd_pol = true;
+    else if ( iSolver % 4 == 2 ) // random decisions and fewer restarts
+        S->random_var_freq = 0.02, S->K = 0.7;
+    else if ( iSolver % 4 == 3 ) // no phase saving and more blocked restarts
+        S->phase_saving = 0, S->R = 1.2;
+    else                         // random decisions and slower activity decay
+        S->random_var_freq = 0.01, S->var_decay = 0.9;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exchanges learned clauses among the solvers.]
+
+  Description [Each ring has one writer and is read by the other solvers
+  without locking. The entry of a clause is its size and LBD followed by
+  its literals. The writer does not wait for the readers: a reader falling
+  behind by more than the ring size loses the overwritten clauses, which
+  it detects by re-reading the head after copying the clause.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int glucose_port_find( Glucose_Port_t * p, Solver * S )
+{
+    int i;
+    for ( i = 0; i < p->nSolvers; i++ )
+        if ( p->pSolvers[i] == S )
+            return i;
+    assert( 0 );
+    return -1;
+}
+void glucose_port_export( void * pMan, Solver * S, const vec<Lit>& lits, int lbd )
+{
+    Glucose_Port_t * p = (Glucose_Port_t *)pMan;
+    std::atomic<int> * pRing;
+    word iHead;
+    int i, k;
+    if ( lbd > p->nLbdMax || lits.size() > GLUCOSE_SHARE_SIZE )
+        return;
+    i = glucose_port_find( p, S );
+    pRing = p->pRings[i];
+    iHead = p->iHeads[i].load( std::memory_order_relaxed );
+    // the readers seeing the entries overwritten below also see the previous head
+    std::atomic_thread_fence( std::memory_order_release );
+    pRing[iHead++ % GLUCOSE_SHARE_RING].store( (Abc_MaxInt(lbd, 1) << 16) | lits.size(), std::memory_order_relaxed );
+    for ( k = 0; k < lits.size(); k++ )
+        pRing[iHead++ % GLUCOSE_SHARE_RING].store( toInt(lits[k]), std::memory_order_relaxed );
+    p->iHeads[i].store( iHead, std::memory_order_release );
+}
+int glucose_port_import( void * pMan, Solver * S, vec<Lit>& lits )
+{
+    Glucose_Port_t * p = (Glucose_Port_t *)pMan;
+    SimpSolver * pSimp = (SimpSolver *)S;
+    std::atomic<int> * pRing;
+    word * pCur, iHead;
+    int i, j, k, Entry, nLits, fSkip;
+    // the user's stop flag is checked here because the solvers watch the portfolio's flag
+    if ( p->pStopUser && GLUCOSE_FLAG_READ(p->pStopUser) )
+        GLUCOSE_FLAG_WRITE( &p->fStop, 1 );
+    i = glucose_port_find( p, S );
+    for ( j = 0; j < p->nSolvers; j++ )
+    {
+        if ( j == i )
+            continue;
+        pRing = p->pRings[j];
+        pCur  = &p->pCursors[i][j];
+        iHead = p->iHeads[j].load( std::memory_order_acquire );
+        while ( *pCur < iHead )
+        {
+            if ( iHead - *pCur > GLUCOSE_SHARE_RING - GLUCOSE_SHARE_SIZE - 1 )
+            {
+                *pCur = iHead;
+                break;
+            }
+            Entry = pRing[*pCur % GLUCOSE_SHARE_RING].load( std::memory_order_relaxed );
+            nLits = Entry & 0xFFFF;
+            lits.clear();
+            for ( k = 0, fSkip = 0; k < nLits && k < GLUCOSE_SHARE_SIZE; k++ )
+            {
+                Lit Lit; Lit.x = pRing[(*pCur + 1 + k) % GLUCOSE_SHARE_RING].load( std::memory_order_relaxed );
+                lits.push( Lit );
+            }
+            // make sure the entries were not overwritten while being copied
+            std::atomic_thread_fence( std::memory_order_acquire );
+            iHead = p->iHeads[j].load( std::memory_order_relaxed );
+            if ( iHead + GLUCOSE_SHARE_SIZE + 1 >= *pCur + GLUCOSE_SHARE_RING )
+            {
+                *pCur = iHead;
+                break;
+            }
+            *pCur += nLits + 1;
+            for ( k = 0; k < lits.size(); k++ )
+                if ( var(lits[k]) >= S->nVars() || pSimp->isEliminated(var(lits[k])) )
+                    fSkip = 1;
+            if ( !fSkip )
+                return Entry >> 16;
+        }
+    }
+    lits.clear();
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the portfolio.]
+
+  Description [The helper solvers are created empty. They receive the 
+  same variables and clauses as the first solver from then on.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void glucose_port_start( Gluco::SimpSolver * S, int nSolvers, int nLbdMax )
+{
+    Glucose_Port_t * p;
+    int i;
+    assert( S->pShareMan == NULL );
+    assert( nSolvers > 1 && nSolvers <= GLUCOSE_PORT_MAX );
+    assert( S->nVars() == 0 );
+    p = new Glucose_Port_t;
+    p->nSolvers = nSolvers;
+    p->nLbdMax  = nLbdMax;
+    p->iWinner  = -1;
+    p->fStop    = 0;
+    p->pStopUser = NULL;
+    memset( p->pCursors, 0, sizeof(p->pCursors) );
+    for ( i = 0; i < nSolvers; i++ )
+    {
+        p->pSolvers[i] = i ? new SimpSolver : S;
+        if ( i ) p->pSolvers[i]->setIncrementalMode();
+        glucose_port_config( p->pSolvers[i], i );
+        p->pSolvers[i]->pShareMan    = p;
+        p->pSolvers[i]->pShareExport = glucose_port_export;
+        p->pSolvers[i]->pShareImport = glucose_port_import;
+        p->pRings[i] = new std::atomic<int>[GLUCOSE_SHARE_RING];
+        p->iHeads[i] = 0;
+    }
+}
+void glucose_port_stop( Gluco::SimpSolver * S )
+{
+    Glucose_Port_t * p = (Glucose_Port_t *)S->pShareMan;
+    int i;
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        delete [] p->pRings[i];
+        if ( i ) delete p->pSolvers[i];
+    }
+    S->pShareMan    = NULL;
+    S->pShareExport = NULL;
+    S->pShareImport = NULL;
+    delete p;
+}
+void glucose_port_reset( Gluco::SimpSolver * S )
+{
+    Glucose_Port_t * p = (Glucose_Port_t *)S->pShareMan;
+    int i;
+    for ( i = 1; i < p->nSolvers; i++ )
+    {
+        p->pSolvers[i]->reset();
+        glucose_port_config( p->pSolvers[i], i );
+    }
+    for ( i = 0; i < p->nSolvers; i++ )
+        p->iHeads[i] = 0;
+    memset( p->pCursors, 0, sizeof(p->pCursors) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using all solvers of the portfolio.]
+
+  Description [The first solver runs in the calling thread. The solver 
+  finishing first stops the others and its result is transferred to the
+  first solver, so that the caller reads the model or the final conflict
+  as usual.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Glucose_PortTh_t_ Glucose_PortTh_t;
+struct Glucose_PortTh_t_
+{
+    Glucose_Port_t *    p;
+    int                 iSolver;
+};
+int glucose_port_worker( void * pArg )
+{
+    Glucose_PortTh_t * pThData = (Glucose_PortTh_t *)pArg;
+    Glucose_Port_t * p = pThData->p;
+    int iSolver = pThData->iSolver, iNone = -1;
+    Gluco::lbool res = p->pSolvers[iSolver]->solveLimited( p->vAssumps, 0 );
+    p->pStatus[iSolver] = (res == l_True ? 1 : res == l_False ? -1 : 0);
+    if ( p->pStatus[iSolver] != 0 && p->iWinner.compare_exchange_strong(iNone, iSolver) )
+        GLUCOSE_FLAG_WRITE( &p->fStop, 1 );
+    return p->pStatus[iSolver];
+}
+int glucose_port_solve( Gluco::SimpSolver * S, int * plits, int nlits )
+{
+#ifdef ABC_USE_PTHREADS
+    Glucose_Port_t * p = (Glucose_Port_t *)S->pShareMan;
+    Glucose_PortTh_t pThData[GLUCOSE_PORT_MAX];
+    Util_Task_t * ppTasks[GLUCOSE_PORT_MAX];
+    Util_Pool_t * pPool = Util_PoolGlobal( p->nSolvers - 1 );
+    int64_t nBudget = S->getConfBudget();
+    int i, iWinner;
+    p->vAssumps.clear();
+    for ( i = 0; i < nlits; i++ )
+    {
+        Lit Lit; Lit.x = plits[i];
+        p->vAssumps.push( Lit );
+    }
+    p->pStopUser = S->pstop;
+    GLUCOSE_FLAG_WRITE( &p->fStop, 0 );
+    p->iWinner   = -1;
+    for ( i = 0; i < p->nSolvers; i++ )
+    {
+        if ( i )
+        {
+            p->pSolvers[i]->nRuntimeLimit = S->nRuntimeLimit;
+            if ( nBudget >= 0 )
+                p->pSolvers[i]->setConfBudget( nBudget );
+            else
+                p->pSolvers[i]->budgetOff();
+        }
+        p->pSolvers[i]->pstop = &p->fStop;
+        pThData[i].p       = p;
+        pThData[i].iSolver = i;
+    }
+    for ( i = 1; i < p->nSolvers; i++ )
+        ppTasks[i] = Util_PoolSubmit( pPool, glucose_port_worker, (void *)(pThData + i) );
+    glucose_port_worker( pThData );
+    for ( i = 1; i < p->nSolvers; i++ )
+    {
+        Util_TaskWait( ppTasks[i] );
+        Util_TaskFree( ppTasks[i] );
+    }
+    for ( i = 0; i < p->nSolvers; i++ )
+        p->pSolvers[i]->pstop = NULL;
+    S->pstop = p->pStopUser;
+    iWinner = p->iWinner;
+    if ( iWinner == -1 )
+        return 0;
+    if ( iWinner > 0 )
+    {
+        p->pSolvers[iWinner]->model.copyTo( S->model );
+        p->pSolvers[iWinner]->conflict.copyTo( S->conflict );
+        // the problem is UNSAT without assumptions
+        if ( p->pStatus[iWinner] == -1 && S->conflict.size() == 0 )
+            S->addEmptyClause();
+    }
+    return p->pStatus[iWinner];
+#else
+    assert( 0 );
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 /**Function*************************************************************
 
   Synopsis    []
@@ -68,15 +417,19 @@ Gluco::SimpSolver * glucose_solver_start()
 
 void glucose_solver_stop(Gluco::SimpSolver* S)
 {
+    if ( S->pShareMan )
+        glucose_port_stop( S );
     delete S;
 }
 
 void glucose_solver_reset(Gluco::SimpSolver* S)
 {
     S->reset();
+    if ( S->pShareMan )
+        glucose_port_reset( S );
 }
 
-int glucose_solver_addclause(Gluco::SimpSolver* S, int * plits, int nlits)
+static int glucose_solver_addclause_one(Gluco::SimpSolver* S, int * plits, int nlits)
 {
     vec<Lit> lits;
     for ( int i = 0; i < nlits; i++,plits++)
@@ -91,6 +444,17 @@ int glucose_solver_addclause(Gluco::SimpSolver* S, int * plits, int nlits)
     return S->addClause(lits); // returns 0 if the problem is UNSAT
 }
 
+int glucose_solver_addclause(Gluco::SimpSolver* S, int * plits, int nlits)
+{
+    if ( S->pShareMan )
+    {
+        Glucose_Port_t * p = (Glucose_Port_t *)S->pShareMan;
+        for ( int i = 1; i < p->nSolvers; i++ )
+            glucose_solver_addclause_one( p->pSolvers[i], plits, nlits );
+    }
+    return glucose_solver_addclause_one( S, plits, nlits );
+}
+
 void glucose_solver_setcallback(Gluco::SimpSolver* S, void * pman, int(*pfunc)(void*, int, int*))
 {
     S->pCnfMan = pman;
@@ -101,6 +465,9 @@ void glucose_solver_setcallback(Gluco::SimpSolver* S, void * pman, int(*pfunc)(v
 int glucose_solver_solve(Gluco::SimpSolver* S, int * plits, int nlits)
 {
     vec<Lit> lits;
+    // the portfolio is not used with the callback, which may add clauses to the first solver only
+    if ( S->pShareMan && S->pCnfFunc == NULL )
+        return glucose_port_solve( S, plits, nlits );
     for (int i=0;i<nlits;i++,plits++)
     {
         Lit p;
@@ -113,6 +480,12 @@ int glucose_solver_solve(Gluco::SimpSolver* S, int * plits, int nlits)
 
 int glucose_solver_addvar(Gluco::SimpSolver* S)
 {
+    if ( S->pShareMan )
+    {
+        Glucose_Port_t * p = (Glucose_Port_t *)S->pShareMan;
+        for ( int i = 1; i < p->nSolvers; i++ )
+            p->pSolvers[i]->newVar();
+    }
     S->newVar();
     return S->nVars() - 1;
 }
@@ -141,7 +514,21 @@ void glucose_solver_setstop(Gluco::SimpSolver* S, int * pstop)
 ***********************************************************************/
 bmcg_sat_solver * bmcg_sat_solver_start() 
 {
-    return (bmcg_sat_solver *)glucose_solver_start();
+    Gluco::SimpSolver * S = glucose_solver_start();
+#ifdef ABC_USE_PTHREADS
+    if ( glucose_port_proc_num() > 1 )
+        glucose_port_start( S, glucose_port_proc_num(), glucose_port_lbd_max() );
+#endif
+    return (bmcg_sat_solver *)S;
+}
+bmcg_sat_solver * bmcg_sat_solver_start_portfolio( int nSolvers, int nLbdMax ) 
+{
+    Gluco::SimpSolver * S = glucose_solver_start();
+#ifdef ABC_USE_PTHREADS
+    if ( nSolvers > 1 )
+        glucose_port_start( S, Abc_MinInt(nSolvers, GLUCOSE_PORT_MAX), nLbdMax );
+#endif
+    return (bmcg_sat_solver *)S;
 }
 void bmcg_sat_solver_stop(bmcg_sat_solver* s)
 {
@@ -189,6 +576,9 @@ void bmcg_sat_solver_set_nvars( bmcg_sat_solver* s, int nvars )
 int bmcg_sat_solver_eliminate( bmcg_sat_solver* s, int turn_off_elim )
 {
 //    return 1; 
+    Glucose_Port_t * p = (Glucose_Port_t *)((Gluco::SimpSolver*)s)->pShareMan;
+    for ( int i = 1; p && i < p->nSolvers; i++ )
+        p->pSolvers[i]->eliminate(turn_off_elim != 0);
     return ((Gluco::SimpSolver*)s)->eliminate(turn_off_elim != 0);
 }
 
@@ -200,6 +590,9 @@ int bmcg_sat_solver_var_is_elim( bmcg_sat_solver* s, int v )
 
 void bmcg_sat_solver_var_set_frozen( bmcg_sat_solver* s, int v, int freeze )
 {
+    Glucose_Port_t * p = (Glucose_Port_t *)((Gluco::SimpSolver*)s)->pShareMan;
+    for ( int i = 1; p && i < p->nSolvers; i++ )
+        p->pSolvers[i]->setFrozen(v, freeze != 0);
     ((Gluco::SimpSolver*)s)->setFrozen(v, freeze != 0);
 }
 
@@ -410,6 +803,10 @@ bmcg_sat_solver * bmcg_sat_solver_start()
 {
     return (bmcg_sat_solver *)glucose_solver_start();
 }
+bmcg_sat_solver * bmcg_sat_solver_start_portfolio( int nSolvers, int nLbdMax ) 
+{
+    return bmcg_sat_solver_start();
+}
 void bmcg_sat_solver_stop(bmcg_sat_solver* s)
 {
     glucose_solver_stop((Gluco::Solver*)s);
@@ -71,6 +71,7 @@ typedef void bmcg_sat_solver;
 ////////////////////////////////////////////////////////////////////////
 
 extern bmcg_sat_solver * bmcg_sat_solver_start();
+extern bmcg_sat_solver * bmcg_sat_solver_start_portfolio( int nSolvers, int nLbdMax );
 extern void              bmcg_sat_solver_stop( bmcg_sat_solver* s );
 extern void              bmcg_sat_solver_reset( bmcg_sat_solver* s );
 extern int               bmcg_sat_solver_addclause( bmcg_sat_solver* s, int * plits, int nlits );
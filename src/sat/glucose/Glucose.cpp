@@ -95,6 +95,9 @@ Solver::Solver() :
     , terminate_search_early(false)
     , pstop(NULL)
     , nRuntimeLimit(0)
+    , pShareMan(NULL)
+    , pShareExport(NULL)
+    , pShareImport(NULL)
 
     , verbosity      (0)
     , verbEveryConflicts(10000)
@@ -1072,6 +1075,9 @@ lbool Solver::search(int nof_conflicts)
  
             cancelUntil(backtrack_level);
 
+            if (pShareExport)
+              pShareExport(pShareMan, this, learnt_clause, nblevels);
+
             if (certifiedUNSAT) {
               for (int i = 0; i < learnt_clause.size(); i++)
                 fprintf(certifiedOutput, "%i " , (var(learnt_clause[i]) + 1) *
@@ -1100,7 +1106,7 @@ lbool Solver::search(int nof_conflicts)
         }else{
 
           // Our dynamic restart, see the SAT09 competition compagnion paper 
-          if ( (conflictsRestarts && lbdQueue.isvalid() && lbdQueue.getavg()*K > sumLBD/conflictsRestarts) || (pstop && *pstop) ) {
+          if ( (conflictsRestarts && lbdQueue.isvalid() && lbdQueue.getavg()*K > sumLBD/conflictsRestarts) || stopRequested() ) {
             lbdQueue.fastclear();
             progress_estimate = progressEstimate();
             int bt = 0;
@@ -1161,6 +1167,51 @@ lbool Solver::search(int nof_conflicts)
 }
 
 
+/*_________________________________________________________________________________________________
+|
+|  importShared : ()  ->  [bool]
+|  
+|  Description:
+|    Adds the clauses learned by the other solvers of the portfolio. Called between the restarts.
+|    The clauses are simplified at level 0 and added as learned clauses, so that they can be 
+|    removed by 'reduceDB()'. Returns FALSE if the problem became unsatisfiable.
+|________________________________________________________________________________________________@*/
+bool Solver::importShared()
+{
+    vec<Lit> lits;
+    int lbd, i, j;
+    bool fLevelZero = false;
+    while ((lbd = pShareImport(pShareMan, this, lits)) > 0){
+        if (!fLevelZero){
+            cancelUntil(0);
+            fLevelZero = true;
+        }
+        for (i = j = 0; i < lits.size(); i++){
+            if (value(lits[i]) == l_True)
+                break;
+            if (value(lits[i]) == l_Undef)
+                lits[j++] = lits[i];
+        }
+        if (i < lits.size())
+            continue;
+        lits.shrink(i - j);
+        if (lits.size() == 0)
+            return ok = false;
+        if (lits.size() == 1){
+            uncheckedEnqueue(lits[0]);
+            if (propagate() != CRef_Undef)
+                return ok = false;
+            continue;
+        }
+        CRef cr = ca.alloc(lits, true);
+        ca[cr].setLBD(lbd < lits.size() ? lbd : lits.size());
+        ca[cr].setSizeWithoutSelectors(lits.size());
+        learnts.push(cr);
+        attachClause(cr);
+    }
+    return true;
+}
+
 double Solver::progressEstimate() const
 {
     double  progress = 0;
@@ -1240,8 +1291,9 @@ printf("c ==================================[ Search Statistics (every %6d confl
     int curr_restarts = 0;
     while (status == l_Undef){
       status = search(0); // the parameter is useless in glucose, kept to allow modifications
-        if (!withinBudget() || terminate_search_early || (pstop && *pstop)) break;
+        if (!withinBudget() || terminate_search_early || stopRequested()) break;
         if (nRuntimeLimit && Abc_Clock() > nRuntimeLimit)                   break;
+        if (status == l_Undef && pShareImport && !importShared())           status = l_False;
         curr_restarts++;
     }
 
@@ -63,6 +63,11 @@ public:
     vec<int> user_vec;
     vec<Lit> user_lits;
 
+    // clause sharing in a portfolio
+    void * pShareMan;                                                  // portfolio manager
+    void(*pShareExport)(void * p, Solver * s, const vec<Lit>& lits, int lbd); // called for each learned clause
+    int(*pShareImport)(void * p, Solver * s, vec<Lit>& lits);          // returns the LBD of the next shared clause or 0
+
     // Problem specification:
     //
     Var     newVar    (bool polarity = true, bool dvar = true); // Add a new variable with parameters specifying variable mode.
@@ -126,6 +131,7 @@ public:
     void    setConfBudget(int64_t x);
     void    setPropBudget(int64_t x);
     void    budgetOff();
+    int64_t getConfBudget() const; // The remaining conflict budget (-1 means no budget).
     void    interrupt();          // Trigger a (potentially asynchronous) interruption of the solver.
     void    clearInterrupt();     // Clear interrupt indicator flag.
 
@@ -302,6 +308,7 @@ protected:
     bool     litRedundant     (Lit p, uint32_t abstract_levels);                       // (helper method for 'analyze()')
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
+    bool     importShared     ();                                                      // Adds the clauses learned by other solvers of the portfolio.
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
     void     rebuildOrderHeap ();
@@ -336,6 +343,7 @@ protected:
     int      level            (Var x) const;
     double   progressEstimate ()      const; // DELETE THIS ?? IT'S NOT VERY USEFUL ...
     bool     withinBudget     ()      const;
+    bool     stopRequested    ()      const; // the stop flag may be set by another thread
     inline bool isSelector(Var v) {return (incremental && v>nbVarsInitialFormula);}
 
     // Static helpers:
@@ -431,10 +439,18 @@ inline void     Solver::setPropBudget(int64_t x){ propagation_budget = propagati
 inline void     Solver::interrupt(){ asynch_interrupt = true; }
 inline void     Solver::clearInterrupt(){ asynch_interrupt = false; }
 inline void     Solver::budgetOff(){ conflict_budget = propagation_budget = -1; }
+inline int64_t  Solver::getConfBudget() const { return conflict_budget < 0 ? -1 : conflict_budget - (int64_t)conflicts; }
 inline bool     Solver::withinBudget() const {
     return !asynch_interrupt &&
            (conflict_budget    < 0 || conflicts < (uint64_t)conflict_budget) &&
            (propagation_budget < 0 || propagations < (uint64_t)propagation_budget); }
+inline bool     Solver::stopRequested() const {
+#if defined(__GNUC__)
+    return pstop && __atomic_load_n(pstop, __ATOMIC_RELAXED);
+#else
+    return pstop && *(volatile int *)pstop;
+#endif
+}
 
 // FIXME: after the introduction of asynchronous interrruptions the solve-versions that return a
 // pure bool do not give a safe interface. Either interrupts must be possible to turn off here, or
@@ -162,7 +162,7 @@ void Msat_SolverWriteDimacs( Msat_Solver_t * p, char * pFileName )
 ***********************************************************************/
 char * Msat_TimeStamp()
 {
-    static char Buffer[100];
+    static ABC_THREAD_LOCAL char Buffer[100];
 	time_t ltime;
 	char * TimeStamp;
     // get the current time
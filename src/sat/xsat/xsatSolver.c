@@ -776,7 +776,7 @@ unsigned xSAT_SolverPropagate( xSAT_Solver_t* s )
 ***********************************************************************/
 void xSAT_SolverReduceDB( xSAT_Solver_t * s )
 {
-    static abctime TimeTotal = 0;
+    static ABC_THREAD_LOCAL abctime TimeTotal = 0;
     abctime clk = Abc_Clock();
     int nLearnedOld = Vec_IntSize( s->vLearnts );
     int i, limit;